@@ -67,17 +67,20 @@ Builder::Builder(unsigned int spvVersion, unsigned int magicNumber, SpvBuildLogg
     addressModel(AddressingModelLogical),
     memoryModel(MemoryModelGLSL450),
     builderNumber(magicNumber),
+    previousArena(InstructionArena::current()),
     buildPoint(0),
     uniqueId(0),
     entryPointFunction(0),
     generatingOpCodeForSpecConst(false),
     logger(buildLogger)
 {
+    InstructionArena::current() = &arena;
     clearAccessChain();
 }
 
 Builder::~Builder()
 {
+    InstructionArena::current() = previousArena;
 }
 
 Id Builder::import(const char* name)
@@ -131,6 +134,44 @@ void Builder::addLine(Id fileName, int lineNum, int column)
     buildPoint->addInstruction(std::unique_ptr<Instruction>(line));
 }
 
+// Mix 'count' operand words into 'seed'.  Type lookups seed with the type opcode and constant
+// lookups with the type id; chaining calls gives the same result as hashing all words at once.
+std::size_t Builder::hashWords(std::size_t seed, const unsigned* words, int count)
+{
+    std::size_t hash = seed;
+    for (int w = 0; w < count; ++w)
+        hash = (hash ^ words[w]) * (std::size_t)1099511628211ull;
+
+    return hash;
+}
+
+// Same as hashWords() over the operands of an already built instruction.
+std::size_t Builder::hashOperands(std::size_t seed, const Instruction& inst)
+{
+    std::size_t hash = seed;
+    for (int op = 0; op < inst.getNumOperands(); ++op) {
+        unsigned word = inst.isIdOperand(op) ? inst.getIdOperand(op) : inst.getImmediateOperand(op);
+        hash = hashWords(hash, &word, 1);
+    }
+
+    return hash;
+}
+
+void Builder::addGroupedType(Instruction* type)
+{
+    groupedTypes[type->getOpCode()].push_back(type);
+    hashedTypes[hashOperands(type->getOpCode(), *type)].push_back(type);
+}
+
+void Builder::addGroupedConstant(Op typeClass, Instruction* constant)
+{
+    if (typeClass == OpTypeStruct)
+        groupedStructConstants[constant->getTypeId()].push_back(constant);
+    else
+        groupedConstants[typeClass].push_back(constant);
+    hashedConstants[hashOperands(constant->getTypeId(), *constant)].push_back(constant);
+}
+
 // For creating new groupedTypes (will return old type if the requested one was already made).
 Id Builder::makeVoidType()
 {
@@ -178,9 +219,11 @@ Id Builder::makePointer(StorageClass storageClass, Id pointee)
 {
     // try to find it
     Instruction* type;
-    for (int t = 0; t < (int)groupedTypes[OpTypePointer].size(); ++t) {
-        type = groupedTypes[OpTypePointer][t];
-        if (type->getImmediateOperand(0) == (unsigned)storageClass &&
+    const unsigned words[] = { (unsigned)storageClass, pointee };
+    for (Instruction* candidate : hashedTypes[hashWords(OpTypePointer, words, 2)]) {
+        type = candidate;
+        if (type->getOpCode() == OpTypePointer &&
+            type->getImmediateOperand(0) == (unsigned)storageClass &&
             type->getIdOperand(1) == pointee)
             return type->getResultId();
     }
@@ -189,7 +232,7 @@ Id Builder::makePointer(StorageClass storageClass, Id pointee)
     type = new Instruction(getUniqueId(), NoType, OpTypePointer);
     type->addImmediateOperand(storageClass);
     type->addIdOperand(pointee);
-    groupedTypes[OpTypePointer].push_back(type);
+    addGroupedType(type);
     constantsTypesGlobals.push_back(std::unique_ptr<Instruction>(type));
     module.mapInstruction(type);
 
@@ -213,9 +256,11 @@ Id Builder::makePointerFromForwardPointer(StorageClass storageClass, Id forwardP
 {
     // try to find it
     Instruction* type;
-    for (int t = 0; t < (int)groupedTypes[OpTypePointer].size(); ++t) {
-        type = groupedTypes[OpTypePointer][t];
-        if (type->getImmediateOperand(0) == (unsigned)storageClass &&
+    const unsigned words[] = { (unsigned)storageClass, pointee };
+    for (Instruction* candidate : hashedTypes[hashWords(OpTypePointer, words, 2)]) {
+        type = candidate;
+        if (type->getOpCode() == OpTypePointer &&
+            type->getImmediateOperand(0) == (unsigned)storageClass &&
             type->getIdOperand(1) == pointee)
             return type->getResultId();
     }
@@ -223,7 +268,7 @@ Id Builder::makePointerFromForwardPointer(StorageClass storageClass, Id forwardP
     type = new Instruction(forwardPointerType, NoType, OpTypePointer);
     type->addImmediateOperand(storageClass);
     type->addIdOperand(pointee);
-    groupedTypes[OpTypePointer].push_back(type);
+    addGroupedType(type);
     constantsTypesGlobals.push_back(std::unique_ptr<Instruction>(type));
     module.mapInstruction(type);
 
@@ -239,9 +284,11 @@ Id Builder::makeIntegerType(int width, bool hasSign)
 
     // try to find it
     Instruction* type;
-    for (int t = 0; t < (int)groupedTypes[OpTypeInt].size(); ++t) {
-        type = groupedTypes[OpTypeInt][t];
-        if (type->getImmediateOperand(0) == (unsigned)width &&
+    const unsigned words[] = { (unsigned)width, hasSign ? 1u : 0u };
+    for (Instruction* candidate : hashedTypes[hashWords(OpTypeInt, words, 2)]) {
+        type = candidate;
+        if (type->getOpCode() == OpTypeInt &&
+            type->getImmediateOperand(0) == (unsigned)width &&
             type->getImmediateOperand(1) == (hasSign ? 1u : 0u))
             return type->getResultId();
     }
@@ -250,7 +297,7 @@ Id Builder::makeIntegerType(int width, bool hasSign)
     type = new Instruction(getUniqueId(), NoType, OpTypeInt);
     type->addImmediateOperand(width);
     type->addImmediateOperand(hasSign ? 1 : 0);
-    groupedTypes[OpTypeInt].push_back(type);
+    addGroupedType(type);
     constantsTypesGlobals.push_back(std::unique_ptr<Instruction>(type));
     module.mapInstruction(type);
 
@@ -279,16 +326,18 @@ Id Builder::makeFloatType(int width)
 
     // try to find it
     Instruction* type;
-    for (int t = 0; t < (int)groupedTypes[OpTypeFloat].size(); ++t) {
-        type = groupedTypes[OpTypeFloat][t];
-        if (type->getImmediateOperand(0) == (unsigned)width)
+    const unsigned word = (unsigned)width;
+    for (Instruction* candidate : hashedTypes[hashWords(OpTypeFloat, &word, 1)]) {
+        type = candidate;
+        if (type->getOpCode() == OpTypeFloat &&
+            type->getImmediateOperand(0) == (unsigned)width)
             return type->getResultId();
     }
 
     // not found, make it
     type = new Instruction(getUniqueId(), NoType, OpTypeFloat);
     type->addImmediateOperand(width);
-    groupedTypes[OpTypeFloat].push_back(type);
+    addGroupedType(type);
     constantsTypesGlobals.push_back(std::unique_ptr<Instruction>(type));
     module.mapInstruction(type);
 
@@ -356,9 +405,11 @@ Id Builder::makeVectorType(Id component, int size)
 {
     // try to find it
     Instruction* type;
-    for (int t = 0; t < (int)groupedTypes[OpTypeVector].size(); ++t) {
-        type = groupedTypes[OpTypeVector][t];
-        if (type->getIdOperand(0) == component &&
+    const unsigned words[] = { component, (unsigned)size };
+    for (Instruction* candidate : hashedTypes[hashWords(OpTypeVector, words, 2)]) {
+        type = candidate;
+        if (type->getOpCode() == OpTypeVector &&
+            type->getIdOperand(0) == component &&
             type->getImmediateOperand(1) == (unsigned)size)
             return type->getResultId();
     }
@@ -367,7 +418,7 @@ Id Builder::makeVectorType(Id component, int size)
     type = new Instruction(getUniqueId(), NoType, OpTypeVector);
     type->addIdOperand(component);
     type->addImmediateOperand(size);
-    groupedTypes[OpTypeVector].push_back(type);
+    addGroupedType(type);
     constantsTypesGlobals.push_back(std::unique_ptr<Instruction>(type));
     module.mapInstruction(type);
 
@@ -382,9 +433,11 @@ Id Builder::makeMatrixType(Id component, int cols, int rows)
 
     // try to find it
     Instruction* type;
-    for (int t = 0; t < (int)groupedTypes[OpTypeMatrix].size(); ++t) {
-        type = groupedTypes[OpTypeMatrix][t];
-        if (type->getIdOperand(0) == column &&
+    const unsigned words[] = { column, (unsigned)cols };
+    for (Instruction* candidate : hashedTypes[hashWords(OpTypeMatrix, words, 2)]) {
+        type = candidate;
+        if (type->getOpCode() == OpTypeMatrix &&
+            type->getIdOperand(0) == column &&
             type->getImmediateOperand(1) == (unsigned)cols)
             return type->getResultId();
     }
@@ -393,7 +446,7 @@ Id Builder::makeMatrixType(Id component, int cols, int rows)
     type = new Instruction(getUniqueId(), NoType, OpTypeMatrix);
     type->addIdOperand(column);
     type->addImmediateOperand(cols);
-    groupedTypes[OpTypeMatrix].push_back(type);
+    addGroupedType(type);
     constantsTypesGlobals.push_back(std::unique_ptr<Instruction>(type));
     module.mapInstruction(type);
 
@@ -404,9 +457,11 @@ Id Builder::makeCooperativeMatrixType(Id component, Id scope, Id rows, Id cols)
 {
     // try to find it
     Instruction* type;
-    for (int t = 0; t < (int)groupedTypes[OpTypeCooperativeMatrixNV].size(); ++t) {
-        type = groupedTypes[OpTypeCooperativeMatrixNV][t];
-        if (type->getIdOperand(0) == component &&
+    const unsigned words[] = { component, scope, rows, cols };
+    for (Instruction* candidate : hashedTypes[hashWords(OpTypeCooperativeMatrixNV, words, 4)]) {
+        type = candidate;
+        if (type->getOpCode() == OpTypeCooperativeMatrixNV &&
+            type->getIdOperand(0) == component &&
             type->getIdOperand(1) == scope &&
             type->getIdOperand(2) == rows &&
             type->getIdOperand(3) == cols)
@@ -419,7 +474,7 @@ Id Builder::makeCooperativeMatrixType(Id component, Id scope, Id rows, Id cols)
     type->addIdOperand(scope);
     type->addIdOperand(rows);
     type->addIdOperand(cols);
-    groupedTypes[OpTypeCooperativeMatrixNV].push_back(type);
+    addGroupedType(type);
     constantsTypesGlobals.push_back(std::unique_ptr<Instruction>(type));
     module.mapInstruction(type);
 
@@ -436,9 +491,11 @@ Id Builder::makeArrayType(Id element, Id sizeId, int stride)
     Instruction* type;
     if (stride == 0) {
         // try to find existing type
-        for (int t = 0; t < (int)groupedTypes[OpTypeArray].size(); ++t) {
-            type = groupedTypes[OpTypeArray][t];
-            if (type->getIdOperand(0) == element &&
+        const unsigned words[] = { element, sizeId };
+        for (Instruction* candidate : hashedTypes[hashWords(OpTypeArray, words, 2)]) {
+            type = candidate;
+            if (type->getOpCode() == OpTypeArray &&
+                type->getIdOperand(0) == element &&
                 type->getIdOperand(1) == sizeId)
                 return type->getResultId();
         }
@@ -448,7 +505,7 @@ Id Builder::makeArrayType(Id element, Id sizeId, int stride)
     type = new Instruction(getUniqueId(), NoType, OpTypeArray);
     type->addIdOperand(element);
     type->addIdOperand(sizeId);
-    groupedTypes[OpTypeArray].push_back(type);
+    addGroupedType(type);
     constantsTypesGlobals.push_back(std::unique_ptr<Instruction>(type));
     module.mapInstruction(type);
 
@@ -469,9 +526,12 @@ Id Builder::makeFunctionType(Id returnType, const std::vector<Id>& paramTypes)
 {
     // try to find it
     Instruction* type;
-    for (int t = 0; t < (int)groupedTypes[OpTypeFunction].size(); ++t) {
-        type = groupedTypes[OpTypeFunction][t];
-        if (type->getIdOperand(0) != returnType || (int)paramTypes.size() != type->getNumOperands() - 1)
+    std::size_t key = hashWords(OpTypeFunction, &returnType, 1);
+    key = hashWords(key, paramTypes.data(), (int)paramTypes.size());
+    for (Instruction* candidate : hashedTypes[key]) {
+        type = candidate;
+        if (type->getOpCode() != OpTypeFunction ||
+            type->getIdOperand(0) != returnType || (int)paramTypes.size() != type->getNumOperands() - 1)
             continue;
         bool mismatch = false;
         for (int p = 0; p < (int)paramTypes.size(); ++p) {
@@ -489,7 +549,7 @@ Id Builder::makeFunctionType(Id returnType, const std::vector<Id>& paramTypes)
     type->addIdOperand(returnType);
     for (int p = 0; p < (int)paramTypes.size(); ++p)
         type->addIdOperand(paramTypes[p]);
-    groupedTypes[OpTypeFunction].push_back(type);
+    addGroupedType(type);
     constantsTypesGlobals.push_back(std::unique_ptr<Instruction>(type));
     module.mapInstruction(type);
 
@@ -502,9 +562,12 @@ Id Builder::makeImageType(Id sampledType, Dim dim, bool depth, bool arrayed, boo
 
     // try to find it
     Instruction* type;
-    for (int t = 0; t < (int)groupedTypes[OpTypeImage].size(); ++t) {
-        type = groupedTypes[OpTypeImage][t];
-        if (type->getIdOperand(0) == sampledType &&
+    const unsigned words[] = { sampledType, (unsigned)dim, depth ? 1u : 0u, arrayed ? 1u : 0u, ms ? 1u : 0u,
+                               sampled, (unsigned)format };
+    for (Instruction* candidate : hashedTypes[hashWords(OpTypeImage, words, 7)]) {
+        type = candidate;
+        if (type->getOpCode() == OpTypeImage &&
+            type->getIdOperand(0) == sampledType &&
             type->getImmediateOperand(1) == (unsigned int)dim &&
             type->getImmediateOperand(2) == (  depth ? 1u : 0u) &&
             type->getImmediateOperand(3) == (arrayed ? 1u : 0u) &&
@@ -524,7 +587,7 @@ Id Builder::makeImageType(Id sampledType, Dim dim, bool depth, bool arrayed, boo
     type->addImmediateOperand(sampled);
     type->addImmediateOperand((unsigned int)format);
 
-    groupedTypes[OpTypeImage].push_back(type);
+    addGroupedType(type);
     constantsTypesGlobals.push_back(std::unique_ptr<Instruction>(type));
     module.mapInstruction(type);
 
@@ -583,9 +646,10 @@ Id Builder::makeSampledImageType(Id imageType)
 {
     // try to find it
     Instruction* type;
-    for (int t = 0; t < (int)groupedTypes[OpTypeSampledImage].size(); ++t) {
-        type = groupedTypes[OpTypeSampledImage][t];
-        if (type->getIdOperand(0) == imageType)
+    for (Instruction* candidate : hashedTypes[hashWords(OpTypeSampledImage, &imageType, 1)]) {
+        type = candidate;
+        if (type->getOpCode() == OpTypeSampledImage &&
+            type->getIdOperand(0) == imageType)
             return type->getResultId();
     }
 
@@ -593,7 +657,7 @@ Id Builder::makeSampledImageType(Id imageType)
     type = new Instruction(getUniqueId(), NoType, OpTypeSampledImage);
     type->addIdOperand(imageType);
 
-    groupedTypes[OpTypeSampledImage].push_back(type);
+    addGroupedType(type);
     constantsTypesGlobals.push_back(std::unique_ptr<Instruction>(type));
     module.mapInstruction(type);
 
@@ -783,11 +847,9 @@ bool Builder::containsPhysicalStorageBufferOrArray(Id typeId) const
 
 // See if a scalar constant of this type has already been created, so it
 // can be reused rather than duplicated.  (Required by the specification).
-Id Builder::findScalarConstant(Op typeClass, Op opcode, Id typeId, unsigned value)
+Id Builder::findScalarConstant(Op opcode, Id typeId, unsigned value)
 {
-    Instruction* constant;
-    for (int i = 0; i < (int)groupedConstants[typeClass].size(); ++i) {
-        constant = groupedConstants[typeClass][i];
+    for (Instruction* constant : hashedConstants[hashWords(typeId, &value, 1)]) {
         if (constant->getOpCode() == opcode &&
             constant->getTypeId() == typeId &&
             constant->getImmediateOperand(0) == value)
@@ -798,11 +860,10 @@ Id Builder::findScalarConstant(Op typeClass, Op opcode, Id typeId, unsigned valu
 }
 
 // Version of findScalarConstant (see above) for scalars that take two operands (e.g. a 'double' or 'int64').
-Id Builder::findScalarConstant(Op typeClass, Op opcode, Id typeId, unsigned v1, unsigned v2)
+Id Builder::findScalarConstant(Op opcode, Id typeId, unsigned v1, unsigned v2)
 {
-    Instruction* constant;
-    for (int i = 0; i < (int)groupedConstants[typeClass].size(); ++i) {
-        constant = groupedConstants[typeClass][i];
+    const unsigned words[] = { v1, v2 };
+    for (Instruction* constant : hashedConstants[hashWords(typeId, words, 2)]) {
         if (constant->getOpCode() == opcode &&
             constant->getTypeId() == typeId &&
             constant->getImmediateOperand(0) == v1 &&
@@ -862,8 +923,8 @@ Id Builder::makeBoolConstant(bool b, bool specConstant)
     // must remain distinct for the purpose of applying a SpecId decoration.
     if (! specConstant) {
         Id existing = 0;
-        for (int i = 0; i < (int)groupedConstants[OpTypeBool].size(); ++i) {
-            constant = groupedConstants[OpTypeBool][i];
+        for (Instruction* candidate : hashedConstants[hashWords(typeId, nullptr, 0)]) {
+            constant = candidate;
             if (constant->getTypeId() == typeId && constant->getOpCode() == opcode)
                 existing = constant->getResultId();
         }
@@ -875,7 +936,7 @@ Id Builder::makeBoolConstant(bool b, bool specConstant)
     // Make it
     Instruction* c = new Instruction(getUniqueId(), typeId, opcode);
     constantsTypesGlobals.push_back(std::unique_ptr<Instruction>(c));
-    groupedConstants[OpTypeBool].push_back(c);
+    addGroupedConstant(OpTypeBool, c);
     module.mapInstruction(c);
 
     return c->getResultId();
@@ -888,7 +949,7 @@ Id Builder::makeIntConstant(Id typeId, unsigned value, bool specConstant)
     // See if we already made it. Applies only to regular constants, because specialization constants
     // must remain distinct for the purpose of applying a SpecId decoration.
     if (! specConstant) {
-        Id existing = findScalarConstant(OpTypeInt, opcode, typeId, value);
+        Id existing = findScalarConstant(opcode, typeId, value);
         if (existing)
             return existing;
     }
@@ -896,7 +957,7 @@ Id Builder::makeIntConstant(Id typeId, unsigned value, bool specConstant)
     Instruction* c = new Instruction(getUniqueId(), typeId, opcode);
     c->addImmediateOperand(value);
     constantsTypesGlobals.push_back(std::unique_ptr<Instruction>(c));
-    groupedConstants[OpTypeInt].push_back(c);
+    addGroupedConstant(OpTypeInt, c);
     module.mapInstruction(c);
 
     return c->getResultId();
@@ -912,7 +973,7 @@ Id Builder::makeInt64Constant(Id typeId, unsigned long long value, bool specCons
     // See if we already made it. Applies only to regular constants, because specialization constants
     // must remain distinct for the purpose of applying a SpecId decoration.
     if (! specConstant) {
-        Id existing = findScalarConstant(OpTypeInt, opcode, typeId, op1, op2);
+        Id existing = findScalarConstant(opcode, typeId, op1, op2);
         if (existing)
             return existing;
     }
@@ -921,7 +982,7 @@ Id Builder::makeInt64Constant(Id typeId, unsigned long long value, bool specCons
     c->addImmediateOperand(op1);
     c->addImmediateOperand(op2);
     constantsTypesGlobals.push_back(std::unique_ptr<Instruction>(c));
-    groupedConstants[OpTypeInt].push_back(c);
+    addGroupedConstant(OpTypeInt, c);
     module.mapInstruction(c);
 
     return c->getResultId();
@@ -938,7 +999,7 @@ Id Builder::makeFloatConstant(float f, bool specConstant)
     // See if we already made it. Applies only to regular constants, because specialization constants
     // must remain distinct for the purpose of applying a SpecId decoration.
     if (! specConstant) {
-        Id existing = findScalarConstant(OpTypeFloat, opcode, typeId, value);
+        Id existing = findScalarConstant(opcode, typeId, value);
         if (existing)
             return existing;
     }
@@ -946,7 +1007,7 @@ Id Builder::makeFloatConstant(float f, bool specConstant)
     Instruction* c = new Instruction(getUniqueId(), typeId, opcode);
     c->addImmediateOperand(value);
     constantsTypesGlobals.push_back(std::unique_ptr<Instruction>(c));
-    groupedConstants[OpTypeFloat].push_back(c);
+    addGroupedConstant(OpTypeFloat, c);
     module.mapInstruction(c);
 
     return c->getResultId();
@@ -969,7 +1030,7 @@ Id Builder::makeDoubleConstant(double d, bool specConstant)
     // See if we already made it. Applies only to regular constants, because specialization constants
     // must remain distinct for the purpose of applying a SpecId decoration.
     if (! specConstant) {
-        Id existing = findScalarConstant(OpTypeFloat, opcode, typeId, op1, op2);
+        Id existing = findScalarConstant(opcode, typeId, op1, op2);
         if (existing)
             return existing;
     }
@@ -978,7 +1039,7 @@ Id Builder::makeDoubleConstant(double d, bool specConstant)
     c->addImmediateOperand(op1);
     c->addImmediateOperand(op2);
     constantsTypesGlobals.push_back(std::unique_ptr<Instruction>(c));
-    groupedConstants[OpTypeFloat].push_back(c);
+    addGroupedConstant(OpTypeFloat, c);
     module.mapInstruction(c);
 
     return c->getResultId();
@@ -1003,7 +1064,7 @@ Id Builder::makeFloat16Constant(float f16, bool specConstant)
     // See if we already made it. Applies only to regular constants, because specialization constants
     // must remain distinct for the purpose of applying a SpecId decoration.
     if (!specConstant) {
-        Id existing = findScalarConstant(OpTypeFloat, opcode, typeId, value);
+        Id existing = findScalarConstant(opcode, typeId, value);
         if (existing)
             return existing;
     }
@@ -1011,7 +1072,7 @@ Id Builder::makeFloat16Constant(float f16, bool specConstant)
     Instruction* c = new Instruction(getUniqueId(), typeId, opcode);
     c->addImmediateOperand(value);
     constantsTypesGlobals.push_back(std::unique_ptr<Instruction>(c));
-    groupedConstants[OpTypeFloat].push_back(c);
+    addGroupedConstant(OpTypeFloat, c);
     module.mapInstruction(c);
 
     return c->getResultId();
@@ -1044,12 +1105,12 @@ Id Builder::makeFpConstant(Id type, double d, bool specConstant)
     return NoResult;
 }
 
-Id Builder::findCompositeConstant(Op typeClass, Id typeId, const std::vector<Id>& comps)
+Id Builder::findCompositeConstant(Id typeId, const std::vector<Id>& comps)
 {
     Instruction* constant = 0;
     bool found = false;
-    for (int i = 0; i < (int)groupedConstants[typeClass].size(); ++i) {
-        constant = groupedConstants[typeClass][i];
+    for (Instruction* candidate : hashedConstants[hashWords(typeId, comps.data(), (int)comps.size())]) {
+        constant = candidate;
 
         if (constant->getTypeId() != typeId)
             continue;
@@ -1075,8 +1136,10 @@ Id Builder::findStructConstant(Id typeId, const std::vector<Id>& comps)
 {
     Instruction* constant = 0;
     bool found = false;
-    for (int i = 0; i < (int)groupedStructConstants[typeId].size(); ++i) {
-        constant = groupedStructConstants[typeId][i];
+    for (Instruction* candidate : hashedConstants[hashWords(typeId, comps.data(), (int)comps.size())]) {
+        constant = candidate;
+        if (constant->getTypeId() != typeId)
+            continue;
 
         // same contents?
         bool mismatch = false;
@@ -1108,7 +1171,7 @@ Id Builder::makeCompositeConstant(Id typeId, const std::vector<Id>& members, boo
     case OpTypeMatrix:
     case OpTypeCooperativeMatrixNV:
         if (! specConstant) {
-            Id existing = findCompositeConstant(typeClass, typeId, members);
+            Id existing = findCompositeConstant(typeId, members);
             if (existing)
                 return existing;
         }
@@ -1129,10 +1192,7 @@ Id Builder::makeCompositeConstant(Id typeId, const std::vector<Id>& members, boo
     for (int op = 0; op < (int)members.size(); ++op)
         c->addIdOperand(members[op]);
     constantsTypesGlobals.push_back(std::unique_ptr<Instruction>(c));
-    if (typeClass == OpTypeStruct)
-        groupedStructConstants[typeId].push_back(c);
-    else
-        groupedConstants[typeClass].push_back(c);
+    addGroupedConstant(typeClass, c);
     module.mapInstruction(c);
 
     return c->getResultId();
@@ -701,10 +701,14 @@ public:
  protected:
     Id makeIntConstant(Id typeId, unsigned value, bool specConstant);
     Id makeInt64Constant(Id typeId, unsigned long long value, bool specConstant);
-    Id findScalarConstant(Op typeClass, Op opcode, Id typeId, unsigned value);
-    Id findScalarConstant(Op typeClass, Op opcode, Id typeId, unsigned v1, unsigned v2);
-    Id findCompositeConstant(Op typeClass, Id typeId, const std::vector<Id>& comps);
+    Id findScalarConstant(Op opcode, Id typeId, unsigned value);
+    Id findScalarConstant(Op opcode, Id typeId, unsigned v1, unsigned v2);
+    Id findCompositeConstant(Id typeId, const std::vector<Id>& comps);
     Id findStructConstant(Id typeId, const std::vector<Id>& comps);
+    static std::size_t hashWords(std::size_t seed, const unsigned* words, int count);
+    static std::size_t hashOperands(std::size_t seed, const Instruction& inst);
+    void addGroupedType(Instruction* type);
+    void addGroupedConstant(Op typeClass, Instruction* constant);
     Id collapseAccessChain();
     void remapDynamicSwizzle();
     void transferAccessChainSwizzle(bool dynamic);
@@ -732,6 +736,8 @@ public:
     MemoryModel memoryModel;
     std::set<spv::Capability> capabilities;
     int builderNumber;
+    InstructionArena arena;          // backs every instruction below, so declared (and destroyed) around them
+    InstructionArena* previousArena; // arena that was current when this builder was made
     Module module;
     Block* buildPoint;
     Id uniqueId;
@@ -755,6 +761,11 @@ public:
     std::unordered_map<unsigned int, std::vector<Instruction*>> groupedStructConstants; // map struct-id to constant instructions
     std::unordered_map<unsigned int, std::vector<Instruction*>> groupedTypes;           // map type opcodes to type instructions
 
+    // hash of (opcode or type-id, operand words) to the grouped instructions above with that hash,
+    // in creation order, so canonical lookups don't have to scan every type/constant of a class
+    std::unordered_map<std::size_t, std::vector<Instruction*>> hashedTypes;
+    std::unordered_map<std::size_t, std::vector<Instruction*>> hashedConstants;
+
     // stack of switches
     std::stack<Block*> switchMerges;
 
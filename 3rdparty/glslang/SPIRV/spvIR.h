@@ -51,6 +51,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -86,6 +87,86 @@ struct IdImmediate {
     IdImmediate(bool i, unsigned w) : isId(i), word(w) {}
 };
 
+//
+// Bump allocator for instructions and their operand storage.  A Builder makes its
+// arena current for the thread while it is alive; instructions are never freed
+// one by one, the whole arena is released when the Builder goes away.
+//
+
+class InstructionArena {
+public:
+    enum { ChunkSize = 64 * 1024, Alignment = 16 };
+
+    InstructionArena() : cursor(nullptr), remaining(0) { }
+    ~InstructionArena()
+    {
+        for (int c = 0; c < (int)chunks.size(); ++c)
+            ::operator delete(chunks[c]);
+    }
+
+    void* allocate(size_t size)
+    {
+        size = (size + Alignment - 1) & ~(size_t)(Alignment - 1);
+        if (size > remaining) {
+            // big requests get their own chunk, so the current one keeps filling up
+            if (size > ChunkSize / 4) {
+                chunks.push_back((char*)::operator new(size));
+                return chunks.back();
+            }
+            chunks.push_back((char*)::operator new(ChunkSize));
+            cursor = chunks.back();
+            remaining = ChunkSize;
+        }
+        void* p = cursor;
+        cursor += size;
+        remaining -= size;
+        return p;
+    }
+
+    // arena that new instructions made on this thread are allocated from, if any
+    static InstructionArena*& current()
+    {
+        static thread_local InstructionArena* arena = nullptr;
+        return arena;
+    }
+
+protected:
+    InstructionArena(const InstructionArena&);
+    InstructionArena& operator=(const InstructionArena&);
+
+    std::vector<char*> chunks;
+    char* cursor;
+    size_t remaining;
+};
+
+// Allocator for instruction operands, takes the current arena when constructed
+// and falls back to the heap when there is none.
+template<typename T>
+class ArenaAllocator {
+public:
+    typedef T value_type;
+
+    ArenaAllocator() : arena(InstructionArena::current()) { }
+    template<typename U> ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) { }
+
+    T* allocate(size_t n)
+    {
+        if (arena != nullptr)
+            return (T*)arena->allocate(n * sizeof(T));
+        return (T*)::operator new(n * sizeof(T));
+    }
+    void deallocate(T* p, size_t)
+    {
+        if (arena == nullptr)
+            ::operator delete(p);
+    }
+
+    template<typename U> bool operator==(const ArenaAllocator<U>& other) const { return arena == other.arena; }
+    template<typename U> bool operator!=(const ArenaAllocator<U>& other) const { return arena != other.arena; }
+
+    InstructionArena* arena;
+};
+
 //
 // SPIR-V IR instruction.
 //
@@ -95,6 +176,25 @@ public:
     Instruction(Id resultId, Id typeId, Op opCode) : resultId(resultId), typeId(typeId), opCode(opCode), block(nullptr) { }
     explicit Instruction(Op opCode) : resultId(NoResult), typeId(NoType), opCode(opCode), block(nullptr) { }
     virtual ~Instruction() {}
+
+    // Heap-made instructions come from the current arena when there is one.  The owning
+    // arena is kept in front of the object, so deleting an arena instruction is a no-op.
+    static void* operator new(size_t size)
+    {
+        InstructionArena* arena = InstructionArena::current();
+        char* p = (char*)(arena != nullptr ? arena->allocate(size + HeaderSize) : ::operator new(size + HeaderSize));
+        *(InstructionArena**)p = arena;
+        return p + HeaderSize;
+    }
+    static void operator delete(void* p)
+    {
+        if (p == nullptr)
+            return;
+        char* header = (char*)p - HeaderSize;
+        if (*(InstructionArena**)header == nullptr)
+            ::operator delete(header);
+    }
+
     void addIdOperand(Id id) {
         operands.push_back(id);
         idOperand.push_back(true);
@@ -173,17 +273,18 @@ public:
             out.push_back(resultId);
 
         // Write out the operands
-        for (int op = 0; op < (int)operands.size(); ++op)
-            out.push_back(operands[op]);
+        out.insert(out.end(), operands.begin(), operands.end());
     }
 
 protected:
+    enum { HeaderSize = InstructionArena::Alignment };
+
     Instruction(const Instruction&);
     Id resultId;
     Id typeId;
     Op opCode;
-    std::vector<Id> operands;     // operands, both <id> and immediates (both are unsigned int)
-    std::vector<bool> idOperand;  // true for operands that are <id>, false for immediates
+    std::vector<Id, ArenaAllocator<Id> > operands;      // operands, both <id> and immediates (both are unsigned int)
+    std::vector<bool, ArenaAllocator<bool> > idOperand; // true for operands that are <id>, false for immediates
     Block* block;
 };
 
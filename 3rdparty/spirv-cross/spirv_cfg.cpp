@@ -33,38 +33,137 @@ CFG::CFG(Compiler &compiler_, const SPIRFunction &func_)
 
 uint32_t CFG::find_common_dominator(uint32_t a, uint32_t b) const
 {
-	while (a != b)
+	if (a == b)
+		return a;
+
+	uint32_t ia = get_visit_order(a) - 1;
+	uint32_t ib = get_visit_order(b) - 1;
+	if (dominates_index(ia, ib))
+		return a;
+	if (dominates_index(ib, ia))
+		return b;
+	return post_order[find_common_dominator_index(ia, ib)];
+}
+
+uint32_t CFG::find_common_dominator_index(uint32_t a, uint32_t b) const
+{
+	uint32_t count = uint32_t(post_order.size());
+
+	// Lift the deeper node up to the same depth, then lift both to just below their common dominator.
+	if (dominator_depth[a] < dominator_depth[b])
+		swap(a, b);
+	for (uint32_t k = 0, diff = dominator_depth[a] - dominator_depth[b]; diff; k++, diff >>= 1)
+		if (diff & 1)
+			a = dominator_jumps[k * count + a];
+
+	if (a == b)
+		return a;
+
+	for (uint32_t k = dominator_jump_levels; k; k--)
 	{
-		if (get_visit_order(a) < get_visit_order(b))
-			a = get_immediate_dominator(a);
-		else
-			b = get_immediate_dominator(b);
+		uint32_t ja = dominator_jumps[(k - 1) * count + a];
+		uint32_t jb = dominator_jumps[(k - 1) * count + b];
+		if (ja != jb)
+		{
+			a = ja;
+			b = jb;
+		}
 	}
-	return a;
+	return dominator_jumps[a];
+}
+
+void CFG::set_immediate_dominator_index(uint32_t index, uint32_t dominator_index)
+{
+	uint32_t count = uint32_t(post_order.size());
+	dominator_depth[index] = index == dominator_index ? 0 : dominator_depth[dominator_index] + 1;
+	dominator_jumps[index] = dominator_index;
+	for (uint32_t k = 1; k < dominator_jump_levels; k++)
+		dominator_jumps[k * count + index] = dominator_jumps[(k - 1) * count + dominator_jumps[(k - 1) * count + index]];
 }
 
 void CFG::build_immediate_dominators()
 {
 	// Traverse the post-order in reverse and build up the immediate dominator tree.
+	// Back edges are not part of the CFG, so all predecessors of a block are done before the block itself,
+	// and the common dominator of the predecessors is the immediate dominator.
 	immediate_dominators.clear();
 	immediate_dominators[func.entry_block] = func.entry_block;
 
+	uint32_t count = uint32_t(post_order.size());
+	dominator_jump_levels = 1;
+	while ((1u << dominator_jump_levels) < count)
+		dominator_jump_levels++;
+	dominator_depth.clear();
+	dominator_depth.resize(count);
+	dominator_jumps.clear();
+	dominator_jumps.resize(size_t(count) * dominator_jump_levels);
+
 	for (auto i = post_order.size(); i; i--)
 	{
-		uint32_t block = post_order[i - 1];
+		uint32_t index = uint32_t(i - 1);
+		uint32_t block = post_order[index];
 		auto &pred = preceding_edges[block];
 		if (pred.empty()) // This is for the entry block, but we've already set up the dominators.
+		{
+			set_immediate_dominator_index(index, index);
 			continue;
+		}
 
-		for (auto &edge : pred)
+		uint32_t dominator = get_visit_order(pred.front()) - 1;
+		for (size_t p = 1; p < pred.size(); p++)
+			dominator = find_common_dominator_index(dominator, get_visit_order(pred[p]) - 1);
+
+		immediate_dominators[block] = post_order[dominator];
+		set_immediate_dominator_index(index, dominator);
+	}
+
+	build_dominator_tree_intervals();
+}
+
+void CFG::build_dominator_tree_intervals()
+{
+	uint32_t count = uint32_t(post_order.size());
+	dominator_tree_begin.clear();
+	dominator_tree_begin.resize(count);
+	dominator_tree_end.clear();
+	dominator_tree_end.resize(count);
+	if (count == 0)
+		return;
+
+	// Children of each node, grouped by parent. The entry block is last in post-order and is its own dominator.
+	uint32_t root = count - 1;
+	SmallVector<uint32_t> child_offsets;
+	SmallVector<uint32_t> children;
+	child_offsets.resize(count + 1);
+	children.resize(count);
+	for (uint32_t i = 0; i < root; i++)
+		child_offsets[dominator_jumps[i] + 1]++;
+	for (uint32_t i = 0; i < count; i++)
+		child_offsets[i + 1] += child_offsets[i];
+
+	SmallVector<uint32_t> next_child = child_offsets;
+	for (uint32_t i = 0; i < root; i++)
+		children[next_child[dominator_jumps[i]]++] = i;
+
+	// Number the tree in pre-order, each node's interval covers all the nodes it dominates.
+	SmallVector<uint32_t> stack;
+	next_child = child_offsets;
+	uint32_t counter = 0;
+	dominator_tree_begin[root] = counter++;
+	stack.push_back(root);
+	while (!stack.empty())
+	{
+		uint32_t node = stack.back();
+		if (next_child[node] < child_offsets[node + 1])
 		{
-			if (immediate_dominators[block])
-			{
-				assert(immediate_dominators[edge]);
-				immediate_dominators[block] = find_common_dominator(immediate_dominators[block], edge);
-			}
-			else
-				immediate_dominators[block] = edge;
+			uint32_t child = children[next_child[node]++];
+			dominator_tree_begin[child] = counter++;
+			stack.push_back(child);
+		}
+		else
+		{
+			dominator_tree_end[node] = counter;
+			stack.pop_back();
 		}
 	}
 }
@@ -220,13 +319,27 @@ void CFG::add_branch(uint32_t from, uint32_t to)
 
 uint32_t CFG::find_loop_dominator(uint32_t block_id) const
 {
+	// Every block on the walk up has the same loop dominator as where the walk ends,
+	// remember it for all of them.
+	SmallVector<uint32_t> walked_blocks;
+	const auto finish = [&](uint32_t loop_dominator) -> uint32_t {
+		for (auto &walked : walked_blocks)
+			loop_dominator_cache[walked] = loop_dominator;
+		return loop_dominator;
+	};
+
 	while (block_id != SPIRBlock::NoDominator)
 	{
+		auto cached = loop_dominator_cache.find(block_id);
+		if (cached != end(loop_dominator_cache))
+			return finish(cached->second);
+		walked_blocks.push_back(block_id);
+
 		auto itr = preceding_edges.find(block_id);
 		if (itr == end(preceding_edges))
-			return SPIRBlock::NoDominator;
+			return finish(SPIRBlock::NoDominator);
 		if (itr->second.empty())
-			return SPIRBlock::NoDominator;
+			return finish(SPIRBlock::NoDominator);
 
 		uint32_t pred_block_id = SPIRBlock::NoDominator;
 		bool ignore_loop_header = false;
@@ -261,11 +374,11 @@ uint32_t CFG::find_loop_dominator(uint32_t block_id) const
 		{
 			auto &block = compiler.get<SPIRBlock>(block_id);
 			if (block.merge == SPIRBlock::MergeLoop)
-				return block_id;
+				return finish(block_id);
 		}
 	}
 
-	return block_id;
+	return finish(block_id);
 }
 
 bool CFG::node_terminates_control_flow_in_sub_graph(BlockID from, BlockID to) const
@@ -279,11 +392,26 @@ bool CFG::node_terminates_control_flow_in_sub_graph(BlockID from, BlockID to) co
 	if (from_block.merge == SPIRBlock::MergeLoop)
 		ignore_block_id = from_block.merge_block;
 
+	// The answer for every block on the walk is the same as for the block where the walk ends,
+	// remember it for all of them.
+	uint64_t from_key = uint64_t(uint32_t(from)) << 32;
+	SmallVector<uint32_t> walked_blocks;
+	const auto finish = [&](bool terminates) -> bool {
+		for (auto &walked : walked_blocks)
+			terminates_control_flow_cache[from_key | walked] = terminates;
+		return terminates;
+	};
+
 	while (to != from)
 	{
+		auto cached = terminates_control_flow_cache.find(from_key | uint32_t(to));
+		if (cached != end(terminates_control_flow_cache))
+			return finish(cached->second);
+		walked_blocks.push_back(to);
+
 		auto pred_itr = preceding_edges.find(to);
 		if (pred_itr == end(preceding_edges))
-			return false;
+			return finish(false);
 
 		DominatorBuilder builder(*this);
 		for (auto &edge : pred_itr->second)
@@ -291,7 +419,7 @@ bool CFG::node_terminates_control_flow_in_sub_graph(BlockID from, BlockID to) co
 
 		uint32_t dominator = builder.get_dominator();
 		if (dominator == 0)
-			return false;
+			return finish(false);
 
 		auto &dom = compiler.get<SPIRBlock>(dominator);
 
@@ -317,10 +445,10 @@ bool CFG::node_terminates_control_flow_in_sub_graph(BlockID from, BlockID to) co
 			to = dominator;
 		}
 		else
-			return false;
+			return finish(false);
 	}
 
-	return true;
+	return finish(true);
 }
 
 DominatorBuilder::DominatorBuilder(const CFG &cfg_)
@@ -124,9 +124,31 @@ private:
 	SmallVector<uint32_t> post_order;
 	SmallVector<uint32_t> empty_vector;
 
+	// Dominator tree over post-order indices (visit order - 1), used to answer dominance queries
+	// without walking the tree. Jump k of a node is its 2^k-th dominator, stored at [k * count + node].
+	SmallVector<uint32_t> dominator_depth;
+	SmallVector<uint32_t> dominator_jumps;
+	uint32_t dominator_jump_levels = 0;
+	// Pre-order interval of each node in the dominator tree, a dominates b if a's interval contains b's.
+	SmallVector<uint32_t> dominator_tree_begin;
+	SmallVector<uint32_t> dominator_tree_end;
+
+	// Memoized results of find_loop_dominator() and node_terminates_control_flow_in_sub_graph(),
+	// both walk up the dominator tree and get queried for every block.
+	mutable std::unordered_map<uint32_t, uint32_t> loop_dominator_cache;
+	mutable std::unordered_map<uint64_t, bool> terminates_control_flow_cache;
+
 	void add_branch(uint32_t from, uint32_t to);
 	void build_post_order_visit_order();
 	void build_immediate_dominators();
+	void build_dominator_tree_intervals();
+	void set_immediate_dominator_index(uint32_t index, uint32_t dominator_index);
+	uint32_t find_common_dominator_index(uint32_t a, uint32_t b) const;
+
+	bool dominates_index(uint32_t a, uint32_t b) const
+	{
+		return dominator_tree_begin[a] <= dominator_tree_begin[b] && dominator_tree_end[b] <= dominator_tree_end[a];
+	}
 	bool post_order_visit(uint32_t block);
 	uint32_t visit_count = 0;
 
@@ -150,9 +150,9 @@ GETOPT_API int getopt_next( getopt_context_t* ctx )
 
 			unsigned int name_len = (unsigned int)strlen( opt->name );
 
-			if( getopt__str_case_cmp_len( opt->name, check_option, name_len ) == 0 )
+			if( getopt__str_case_cmp_len( opt->name, curr_token + 2, name_len ) == 0 )
 			{
-				check_option += name_len;
+				check_option = curr_token + 2 + name_len;
 
 				/* find arg if there is any */
 				switch( *check_option )
@@ -0,0 +1,454 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+// glslcc-bench: measures throughput and per-phase latency of the compile pipeline over a shader corpus
+//      every backend compiles the program with libglslcc, which runs the same pipeline as the command line:
+//      parse (glslang, including preprocess and includes) -> link -> SPIR-V -> SPIR-V passes -> SPIRV-Cross
+//      phase times come from glslcc_result.timings, total is the whole glslcc_compile call
+// Results are printed as a table and optionally written to a json file (--output) for tracking regressions
+// after glslang or SPIRV-Cross updates
+//
+#include "sx/allocator.h"
+#include "sx/cmdline.h"
+#include "sx/os.h"
+#include "sx/string.h"
+#include "sx/timer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <string>
+#include <vector>
+
+#include "json-writer.h"
+#include "libglslcc.h"
+
+#ifndef GLSLCC_BENCH_CORPUS_DIR
+#define GLSLCC_BENCH_CORPUS_DIR "shaders"
+#endif
+
+static const sx_alloc* g_alloc = sx_alloc_malloc();
+
+struct bench_case {
+    const char* name;
+    const char* category;
+    const char* vs_filename;
+    const char* fs_filename;
+    const char* cs_filename;
+    const char* defines;        // seperated by ','
+};
+
+// corpus: small UI shaders, PBR uber-shader permutations, compute shaders and include-heavy sets
+static const bench_case k_cases[] = {
+    { "ui", "ui", "ui.vert", "ui.frag", nullptr, nullptr },
+    { "pbr_base", "pbr", "pbr.vert", "pbr.frag", nullptr, nullptr },
+    { "pbr_normalmap", "pbr", "pbr.vert", "pbr.frag", nullptr, "HAS_NORMAL_MAP" },
+    { "pbr_normalmap_shadows", "pbr", "pbr.vert", "pbr.frag", nullptr, "HAS_NORMAL_MAP,HAS_SHADOWS" },
+    { "pbr_ibl", "pbr", "pbr.vert", "pbr.frag", nullptr, "HAS_NORMAL_MAP,HAS_IBL,HAS_EMISSIVE" },
+    { "pbr_full", "pbr", "pbr.vert", "pbr.frag", nullptr, "HAS_NORMAL_MAP,HAS_SHADOWS,HAS_IBL,HAS_EMISSIVE,NUM_LIGHTS=8" },
+    { "pbr_skinned_full", "pbr", "pbr.vert", "pbr.frag", nullptr, "HAS_SKINNING,HAS_NORMAL_MAP,HAS_SHADOWS,HAS_IBL,HAS_EMISSIVE,NUM_LIGHTS=8" },
+    { "blur", "compute", nullptr, nullptr, "blur.comp", nullptr },
+    { "particles", "compute", nullptr, nullptr, "particles.comp", nullptr },
+    { "lit_includes", "include", "lit.vert", "lit.frag", nullptr, nullptr },
+    { "const_lut", "constants", "ui.vert", "lut.frag", nullptr, nullptr },
+    { "nodegraph", "cfg", "ui.vert", "nodegraph.frag", nullptr, nullptr }
+};
+
+enum bench_backend {
+    BENCH_BACKEND_GLES = 0,
+    BENCH_BACKEND_GLSL,
+    BENCH_BACKEND_HLSL,
+    BENCH_BACKEND_MSL,
+    BENCH_BACKEND_COUNT
+};
+
+static const char* k_backend_names[BENCH_BACKEND_COUNT] = {
+    "gles",
+    "glsl",
+    "hlsl",
+    "msl"
+};
+
+static const glslcc_lang k_backend_langs[BENCH_BACKEND_COUNT] = {
+    GLSLCC_LANG_GLES,
+    GLSLCC_LANG_GLSL,
+    GLSLCC_LANG_HLSL,
+    GLSLCC_LANG_MSL
+};
+
+enum bench_phase {
+    BENCH_PHASE_PARSE = 0,
+    BENCH_PHASE_LINK,
+    BENCH_PHASE_SPIRV,
+    BENCH_PHASE_PASSES,
+    BENCH_PHASE_CROSS,
+    BENCH_PHASE_TOTAL,
+    BENCH_PHASE_COUNT
+};
+
+static const char* k_phase_names[BENCH_PHASE_COUNT] = {
+    "parse",
+    "link",
+    "spirv",
+    "passes",
+    "cross",
+    "total"
+};
+
+struct bench_timing {
+    double total_us;
+    double min_us;
+    double max_us;
+    int count;
+};
+
+struct bench_result {
+    const bench_case* c;
+    int num_stages;
+    bench_timing phases[BENCH_BACKEND_COUNT][BENCH_PHASE_COUNT];
+    bool failed;
+};
+
+struct bench_stage {
+    glslcc_stage stage;
+    std::string filepath;
+    std::string source;
+};
+
+struct bench_include {
+    std::string name;
+    std::string data;
+};
+
+static void bench_add_timing(bench_timing* t, double us)
+{
+    if (t->count == 0) {
+        t->min_us = us;
+        t->max_us = us;
+    } else {
+        t->min_us = sx_min(t->min_us, us);
+        t->max_us = sx_max(t->max_us, us);
+    }
+    t->total_us += us;
+    t->count++;
+}
+
+static double bench_mean_us(const bench_timing& t)
+{
+    return t.count > 0 ? t.total_us / (double)t.count : 0;
+}
+
+static void bench_get_defines(const char* defines, std::vector<std::string>* strs, std::vector<glslcc_define>* ds)
+{
+    const char* d = defines;
+    while (d && d[0]) {
+        const char* next = sx_strchar(d, ',');
+        strs->push_back(next ? std::string(d, next) : std::string(d));
+        d = next ? next + 1 : nullptr;
+    }
+
+    // NAME=VALUE is split in place, so the strings should not be reallocated after this
+    for (std::string& s : *strs) {
+        size_t eq = s.find('=');
+        if (eq != std::string::npos) {
+            s[eq] = '\0';
+            ds->push_back({ s.c_str(), s.c_str() + eq + 1 });
+        } else {
+            ds->push_back({ s.c_str(), nullptr });
+        }
+    }
+}
+
+static bool bench_load_file(const std::string& filepath, std::string* text)
+{
+    FILE* f = fopen(filepath.c_str(), "rb");
+    if (!f)
+        return false;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    text->resize((size_t)size);
+    bool r = fread(&(*text)[0], 1, (size_t)size, f) == (size_t)size;
+    fclose(f);
+    return r;
+}
+
+// same search order as glslcc: directory of the includer, then the corpus and its include directory
+static bool bench_include_fn(const char* header_name, const char* includer_name, bool system,
+                             glslcc_include_result* result, void* user_data)
+{
+    sx_unused(system);
+    const char* corpus_dir = (const char*)user_data;
+
+    std::string includer_dir(includer_name);
+    size_t slash = includer_dir.find_last_of("/\\");
+    includer_dir = slash != std::string::npos ? includer_dir.substr(0, slash) : std::string(".");
+
+    const std::string dirs[] = { includer_dir, std::string(corpus_dir), std::string(corpus_dir) + "/include" };
+    for (const std::string& dir : dirs) {
+        bench_include* inc = new bench_include;
+        inc->name = dir + "/" + header_name;
+        if (bench_load_file(inc->name, &inc->data)) {
+            result->name = inc->name.c_str();
+            result->data = inc->data.c_str();
+            result->size = inc->data.length();
+            result->user_data = inc;
+            return true;
+        }
+        delete inc;
+    }
+    return false;
+}
+
+static void bench_release_include_fn(const glslcc_include_result* result, void* user_data)
+{
+    sx_unused(user_data);
+    delete (bench_include*)result->user_data;
+}
+
+static bool bench_run_case(const char* corpus_dir, const bench_case& c, int iterations, bench_result* r)
+{
+    std::vector<bench_stage> stages;
+    struct { const char* filename; glslcc_stage stage; } files[] = {
+        { c.vs_filename, GLSLCC_STAGE_VERTEX },
+        { c.fs_filename, GLSLCC_STAGE_FRAGMENT },
+        { c.cs_filename, GLSLCC_STAGE_COMPUTE }
+    };
+    for (auto& f : files) {
+        if (!f.filename)
+            continue;
+        bench_stage s;
+        s.stage = f.stage;
+        s.filepath = std::string(corpus_dir) + "/" + f.filename;
+        if (!bench_load_file(s.filepath, &s.source)) {
+            printf("opening file '%s' failed\n", s.filepath.c_str());
+            return false;
+        }
+        stages.push_back(s);
+    }
+    bool compute = c.cs_filename != nullptr;
+
+    std::vector<std::string> define_strs;
+    std::vector<glslcc_define> defines;
+    bench_get_defines(c.defines, &define_strs, &defines);
+
+    glslcc_compile_desc desc = {};
+    for (size_t i = 0; i < stages.size(); i++) {
+        desc.stages[i] = { stages[i].stage, stages[i].filepath.c_str(), stages[i].source.c_str(),
+                           stages[i].source.length() };
+    }
+    desc.num_stages = (int)stages.size();
+    desc.defines = defines.empty() ? nullptr : defines.data();
+    desc.num_defines = (int)defines.size();
+    desc.flags = GLSLCC_FLAG_TIMINGS;
+    desc.includer.include_fn = bench_include_fn;
+    desc.includer.release_fn = bench_release_include_fn;
+    desc.includer.user_data = (void*)corpus_dir;
+
+    r->c = &c;
+    r->num_stages = (int)stages.size();
+
+    for (int iter = 0; iter < iterations; iter++) {
+        for (int b = 0; b < BENCH_BACKEND_COUNT; b++) {
+            desc.lang = k_backend_langs[b];
+            switch (desc.lang) {
+            case GLSLCC_LANG_GLES:  desc.profile_ver = compute ? 310 : 300;    break;
+            case GLSLCC_LANG_GLSL:  desc.profile_ver = compute ? 430 : 330;    break;
+            default:                desc.profile_ver = 0;                       break;
+            }
+
+            uint64_t t = sx_tm_now();
+            glslcc_result* res = glslcc_compile(&desc);
+            uint64_t elapsed = sx_tm_since(t);
+            if (!res || !res->ok) {
+                printf("%s (%s): %s\n", c.name, k_backend_names[b], res ? res->log : "out of memory");
+                free(res);
+                return false;
+            }
+
+            bench_timing* phases = r->phases[b];
+            bench_add_timing(&phases[BENCH_PHASE_PARSE], res->timings->parse_us);
+            bench_add_timing(&phases[BENCH_PHASE_LINK], res->timings->link_us);
+            bench_add_timing(&phases[BENCH_PHASE_SPIRV], res->timings->spirv_us);
+            bench_add_timing(&phases[BENCH_PHASE_PASSES], res->timings->passes_us);
+            bench_add_timing(&phases[BENCH_PHASE_CROSS], res->timings->cross_us);
+            bench_add_timing(&phases[BENCH_PHASE_TOTAL], sx_tm_us(elapsed));
+            free(res);
+        }
+    }
+
+    return true;
+}
+
+static double bench_shaders_per_sec(const bench_result& r, int backend)
+{
+    double us = bench_mean_us(r.phases[backend][BENCH_PHASE_TOTAL]);
+    return us > 0 ? (double)r.num_stages * 1000000.0 / us : 0;
+}
+
+// one table of phases per backend
+static void bench_print_results(const std::vector<bench_result>& results)
+{
+    for (int b = 0; b < BENCH_BACKEND_COUNT; b++) {
+        printf("%-24s %6s", k_backend_names[b], "stages");
+        for (int p = 0; p < BENCH_PHASE_COUNT; p++)
+            printf(" %11s", k_phase_names[p]);
+        puts("   (mean us)");
+
+        for (const bench_result& r : results) {
+            if (r.failed) {
+                printf("%-24s FAILED\n", r.c->name);
+                continue;
+            }
+            printf("%-24s %6d", r.c->name, r.num_stages);
+            for (int p = 0; p < BENCH_PHASE_COUNT; p++)
+                printf(" %11.1f", bench_mean_us(r.phases[b][p]));
+            puts("");
+        }
+        puts("");
+    }
+
+    printf("%-24s", "throughput (shaders/s)");
+    for (int b = 0; b < BENCH_BACKEND_COUNT; b++)
+        printf(" %11s", k_backend_names[b]);
+    puts("");
+    for (const bench_result& r : results) {
+        if (r.failed)
+            continue;
+        printf("%-24s", r.c->name);
+        for (int b = 0; b < BENCH_BACKEND_COUNT; b++)
+            printf(" %11.1f", bench_shaders_per_sec(r, b));
+        puts("");
+    }
+}
+
+static bool bench_write_json(const char* filepath, const std::vector<bench_result>& results, int iterations)
+{
+    std::string json;
+    json_writer jw;
+    json_init_writer(&jw, &json, "  ", 4096);
+
+    json_begin_object(&jw);
+    json_put_int(&jw, "iterations", iterations);
+    json_begin_array(&jw, "cases");
+    for (const bench_result& r : results) {
+        json_begin_object(&jw);
+        json_put_string(&jw, "name", r.c->name);
+        json_put_string(&jw, "category", r.c->category);
+        json_put_string(&jw, "defines", r.c->defines ? r.c->defines : "");
+        json_put_int(&jw, "stages", r.num_stages);
+        json_put_bool(&jw, "failed", r.failed);
+        if (!r.failed) {
+            json_begin_object(&jw, "backends");
+            for (int b = 0; b < BENCH_BACKEND_COUNT; b++) {
+                json_begin_object(&jw, k_backend_names[b]);
+                json_begin_object(&jw, "phases");
+                for (int p = 0; p < BENCH_PHASE_COUNT; p++) {
+                    const bench_timing& t = r.phases[b][p];
+                    json_begin_object(&jw, k_phase_names[p]);
+                    json_put_double(&jw, "mean_us", bench_mean_us(t));
+                    json_put_double(&jw, "min_us", t.min_us);
+                    json_put_double(&jw, "max_us", t.max_us);
+                    json_end_object(&jw);
+                }
+                json_end_object(&jw);
+                json_put_double(&jw, "shaders_per_sec", bench_shaders_per_sec(r, b));
+                json_end_object(&jw);
+            }
+            json_end_object(&jw);
+        }
+        json_end_object(&jw);
+    }
+    json_end_array(&jw);
+    json_end_object(&jw);
+
+    FILE* f = fopen(filepath, "wb");
+    if (!f)
+        return false;
+    bool ok = fwrite(json.c_str(), 1, json.length(), f) == json.length();
+    fclose(f);
+    return ok;
+}
+
+int main(int argc, char* argv[])
+{
+    const char* corpus_dir = GLSLCC_BENCH_CORPUS_DIR;
+    const char* out_filepath = nullptr;
+    const char* filter = nullptr;
+    int iterations = 10;
+
+    const sx_cmdline_opt opts[] = {
+        { "help", 'h', SX_CMDLINE_OPTYPE_NO_ARG, 0x0, 'h', "Print this help text", 0x0 },
+        { "corpus", 'c', SX_CMDLINE_OPTYPE_REQUIRED, 0x0, 'c', "Shader corpus directory", "Directory" },
+        { "iterations", 'n', SX_CMDLINE_OPTYPE_REQUIRED, 0x0, 'n', "Number of iterations for each case (default: 10)", "Count" },
+        { "filter", 'f', SX_CMDLINE_OPTYPE_REQUIRED, 0x0, 'f', "Only run cases that their name contains the string", "Name" },
+        { "output", 'o', SX_CMDLINE_OPTYPE_REQUIRED, 0x0, 'o', "Write results to json file", "Filepath" },
+        SX_CMDLINE_OPT_END
+    };
+    sx_cmdline_context* cmdline = sx_cmdline_create_context(g_alloc, argc, (const char**)argv, opts);
+
+    int opt;
+    const char* arg;
+    while ((opt = sx_cmdline_next(cmdline, NULL, &arg)) != -1) {
+        switch (opt) {
+        case 'h': {
+            char buffer[2048];
+            puts(sx_cmdline_create_help_string(cmdline, buffer, sizeof(buffer)));
+            exit(0);
+        }
+        case 'c':
+            corpus_dir = arg;
+            break;
+        case 'n':
+            iterations = sx_max(1, sx_toint(arg));
+            break;
+        case 'f':
+            filter = arg;
+            break;
+        case 'o':
+            out_filepath = arg;
+            break;
+        case '?':
+            printf("Unknown argument: %s\n", arg);
+            exit(-1);
+        case '!':
+            printf("Invalid use of argument: %s\n", arg);
+            exit(-1);
+        default:
+            break;
+        }
+    }
+    sx_cmdline_destroy_context(cmdline, g_alloc);
+
+    sx_tm_init();
+    glslcc_init();
+
+    std::vector<bench_result> results;
+    int r = 0;
+    for (const bench_case& c : k_cases) {
+        if (filter && !sx_strstr(c.name, filter))
+            continue;
+
+        // warm-up run, first compile builds glslang's built-in symbol tables and fills the caches
+        bench_result warmup = {};
+        bench_run_case(corpus_dir, c, 1, &warmup);
+
+        bench_result res = {};
+        res.failed = !bench_run_case(corpus_dir, c, iterations, &res);
+        res.c = &c;
+        if (res.failed)
+            r = -1;
+        results.push_back(res);
+    }
+
+    glslcc_shutdown();
+
+    bench_print_results(results);
+    if (out_filepath && !bench_write_json(out_filepath, results, iterations)) {
+        printf("Writing to '%s' failed\n", out_filepath);
+        r = -1;
+    }
+
+    return r;
+}
@@ -0,0 +1,27 @@
+#ifndef BRDF_H
+#define BRDF_H
+
+#include "common.h"
+
+float d_ggx(float ndoth, float roughness)
+{
+    float a = roughness * roughness;
+    float a2 = a * a;
+    float denom = ndoth * ndoth * (a2 - 1.0) + 1.0;
+    return a2 / (PI * denom * denom);
+}
+
+float v_smith_ggx(float ndotv, float ndotl, float roughness)
+{
+    float a = roughness * roughness;
+    float gv = ndotl * sqrt(ndotv * ndotv * (1.0 - a) + a);
+    float gl = ndotv * sqrt(ndotl * ndotl * (1.0 - a) + a);
+    return 0.5 / (gv + gl);
+}
+
+vec3 f_schlick(float vdoth, vec3 f0)
+{
+    return f0 + (1.0 - f0) * pow(1.0 - vdoth, 5.0);
+}
+
+#endif
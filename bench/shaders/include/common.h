@@ -0,0 +1,22 @@
+#ifndef COMMON_H
+#define COMMON_H
+
+#define PI 3.14159265359
+#define saturate(x) clamp(x, 0.0, 1.0)
+
+vec3 srgb_to_linear(vec3 c)
+{
+    return pow(c, vec3(2.2));
+}
+
+vec3 linear_to_srgb(vec3 c)
+{
+    return pow(c, vec3(1.0 / 2.2));
+}
+
+float luminance(vec3 c)
+{
+    return dot(c, vec3(0.2126, 0.7152, 0.0722));
+}
+
+#endif
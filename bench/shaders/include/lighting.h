@@ -0,0 +1,26 @@
+#ifndef LIGHTING_H
+#define LIGHTING_H
+
+#include "brdf.h"
+#include "shadow.h"
+
+struct light_t {
+    vec4 pos_radius;
+    vec4 color;
+};
+
+vec3 shade_light(light_t light, vec3 pos, vec3 n, vec3 v, vec3 albedo, float roughness, vec3 f0)
+{
+    vec3 l = light.pos_radius.xyz - pos;
+    float dist = length(l);
+    l /= dist;
+    vec3 h = normalize(l + v);
+    float ndotl = saturate(dot(n, l));
+    float ndotv = saturate(dot(n, v)) + 1e-5;
+    float ndoth = saturate(dot(n, h));
+    float atten = saturate(1.0 - dist / light.pos_radius.w);
+    vec3 spec = d_ggx(ndoth, roughness) * v_smith_ggx(ndotv, ndotl, roughness) * f_schlick(saturate(dot(v, h)), f0);
+    return (albedo / PI + spec) * light.color.rgb * ndotl * atten * atten;
+}
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef SHADOW_H
+#define SHADOW_H
+
+#include "common.h"
+
+float shadow_pcf(sampler2DShadow tex, vec4 shadow_pos, float texel)
+{
+    vec3 p = shadow_pos.xyz / shadow_pos.w * 0.5 + 0.5;
+    float s = 0.0;
+    for (int i = 0; i < 4; i++) {
+        vec2 o = vec2(float(i & 1), float(i >> 1)) - 0.5;
+        s += texture(tex, vec3(p.xy + o * texel, p.z));
+    }
+    return s * 0.25;
+}
+
+#endif
@@ -0,0 +1,34 @@
+#version 450
+
+precision highp float;
+
+#include "lighting.h"
+
+layout (location = TEXCOORD0) in vec2 f_uv;
+layout (location = TEXCOORD1) in vec3 f_pos;
+layout (location = TEXCOORD2) in vec4 f_shadow_pos;
+layout (location = NORMAL)    in vec3 f_normal;
+
+layout (location = SV_Target0) out vec4 frag_color;
+
+layout (binding = 1, std140) uniform scene {
+    light_t lights[8];
+    vec4 camera_pos;
+    vec4 roughness_metal;
+};
+
+layout (binding = 0) uniform sampler2D tex_albedo;
+layout (binding = 1) uniform sampler2DShadow tex_shadow;
+
+void main()
+{
+    vec3 albedo = srgb_to_linear(texture(tex_albedo, f_uv).rgb);
+    vec3 n = normalize(f_normal);
+    vec3 v = normalize(camera_pos.xyz - f_pos);
+    vec3 f0 = mix(vec3(0.04), albedo, roughness_metal.y);
+    vec3 color = vec3(0.0);
+    for (int i = 0; i < 8; i++)
+        color += shade_light(lights[i], f_pos, n, v, albedo, roughness_metal.x, f0);
+    color *= shadow_pcf(tex_shadow, f_shadow_pos, 1.0 / 2048.0);
+    frag_color = vec4(linear_to_srgb(color), 1.0);
+}
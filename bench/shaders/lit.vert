@@ -0,0 +1,26 @@
+#version 450
+
+layout (location = POSITION)  in vec3 a_pos;
+layout (location = NORMAL)    in vec3 a_normal;
+layout (location = TEXCOORD0) in vec2 a_uv;
+
+layout (location = TEXCOORD0) out vec2 f_uv;
+layout (location = TEXCOORD1) out vec3 f_pos;
+layout (location = TEXCOORD2) out vec4 f_shadow_pos;
+layout (location = NORMAL)    out vec3 f_normal;
+
+layout (binding = 0, std140) uniform transforms {
+    mat4 view_proj;
+    mat4 world;
+    mat4 shadow_mat;
+};
+
+void main()
+{
+    vec4 pos = world * vec4(a_pos, 1.0);
+    f_pos = pos.xyz;
+    f_normal = mat3(world) * a_normal;
+    f_uv = a_uv;
+    f_shadow_pos = shadow_mat * pos;
+    gl_Position = view_proj * pos;
+}
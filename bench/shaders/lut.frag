@@ -0,0 +1,603 @@
+#version 450
+
+precision mediump float;
+
+layout (location = TEXCOORD0) in vec2 f_uv;
+layout (location = COLOR0)    in vec4 f_color;
+
+layout (location = SV_Target0) out vec4 frag_color;
+
+layout (binding = 0) uniform sampler2D tex_image;
+
+// 4096 entry tone-curve table, exercises constant creation/dedup in the SPIR-V builder
+const float k_curve[4096] = float[4096](
+    0.000000, 0.022807, 0.031253, 0.037579, 0.042828, 0.047400, 0.051496, 0.055233,
+    0.058690, 0.061917, 0.064955, 0.067831, 0.070567, 0.073182, 0.075689, 0.078100,
+    0.080425, 0.082673, 0.084849, 0.086960, 0.089011, 0.091007, 0.092952, 0.094849,
+    0.096702, 0.098513, 0.100285, 0.102020, 0.103721, 0.105388, 0.107025, 0.108632,
+    0.110211, 0.111764, 0.113290, 0.114793, 0.116272, 0.117730, 0.119165, 0.120581,
+    0.121976, 0.123353, 0.124712, 0.126053, 0.127377, 0.128685, 0.129977, 0.131253,
+    0.132516, 0.133763, 0.134997, 0.136218, 0.137426, 0.138621, 0.139804, 0.140974,
+    0.142134, 0.143282, 0.144419, 0.145546, 0.146662, 0.147768, 0.148864, 0.149951,
+    0.151028, 0.152096, 0.153155, 0.154206, 0.155248, 0.156281, 0.157307, 0.158324,
+    0.159334, 0.160336, 0.161331, 0.162318, 0.163298, 0.164271, 0.165238, 0.166197,
+    0.167150, 0.168097, 0.169037, 0.169971, 0.170899, 0.171821, 0.172736, 0.173647,
+    0.174551, 0.175450, 0.176343, 0.177231, 0.178114, 0.178991, 0.179863, 0.180731,
+    0.181593, 0.182450, 0.183303, 0.184151, 0.184994, 0.185832, 0.186667, 0.187496,
+    0.188321, 0.189142, 0.189959, 0.190772, 0.191580, 0.192384, 0.193184, 0.193981,
+    0.194773, 0.195562, 0.196346, 0.197128, 0.197905, 0.198679, 0.199449, 0.200215,
+    0.200978, 0.201738, 0.202494, 0.203247, 0.203996, 0.204742, 0.205485, 0.206225,
+    0.206961, 0.207695, 0.208425, 0.209152, 0.209876, 0.210598, 0.211316, 0.212031,
+    0.212744, 0.213453, 0.214160, 0.214864, 0.215565, 0.216264, 0.216960, 0.217653,
+    0.218343, 0.219031, 0.219717, 0.220400, 0.221080, 0.221758, 0.222433, 0.223106,
+    0.223776, 0.224444, 0.225110, 0.225773, 0.226434, 0.227092, 0.227749, 0.228403,
+    0.229055, 0.229704, 0.230352, 0.230997, 0.231640, 0.232281, 0.232920, 0.233557,
+    0.234191, 0.234824, 0.235454, 0.236083, 0.236710, 0.237334, 0.237957, 0.238577,
+    0.239196, 0.239813, 0.240428, 0.241041, 0.241652, 0.242261, 0.242869, 0.243474,
+    0.244078, 0.244680, 0.245281, 0.245879, 0.246476, 0.247071, 0.247664, 0.248256,
+    0.248846, 0.249434, 0.250021, 0.250606, 0.251189, 0.251771, 0.252351, 0.252930,
+    0.253507, 0.254082, 0.254656, 0.255228, 0.255799, 0.256368, 0.256936, 0.257502,
+    0.258066, 0.258630, 0.259191, 0.259752, 0.260311, 0.260868, 0.261424, 0.261979,
+    0.262532, 0.263083, 0.263634, 0.264183, 0.264731, 0.265277, 0.265822, 0.266365,
+    0.266908, 0.267449, 0.267988, 0.268527, 0.269064, 0.269599, 0.270134, 0.270667,
+    0.271199, 0.271730, 0.272259, 0.272788, 0.273315, 0.273840, 0.274365, 0.274888,
+    0.275411, 0.275932, 0.276451, 0.276970, 0.277488, 0.278004, 0.278519, 0.279033,
+    0.279546, 0.280058, 0.280569, 0.281078, 0.281587, 0.282094, 0.282600, 0.283105,
+    0.283610, 0.284113, 0.284615, 0.285116, 0.285615, 0.286114, 0.286612, 0.287109,
+    0.287604, 0.288099, 0.288593, 0.289085, 0.289577, 0.290068, 0.290557, 0.291046,
+    0.291534, 0.292020, 0.292506, 0.292991, 0.293475, 0.293957, 0.294439, 0.294920,
+    0.295400, 0.295879, 0.296358, 0.296835, 0.297311, 0.297786, 0.298261, 0.298735,
+    0.299207, 0.299679, 0.300150, 0.300620, 0.301089, 0.301557, 0.302025, 0.302491,
+    0.302957, 0.303422, 0.303886, 0.304349, 0.304811, 0.305272, 0.305733, 0.306193,
+    0.306652, 0.307110, 0.307567, 0.308023, 0.308479, 0.308934, 0.309388, 0.309841,
+    0.310294, 0.310745, 0.311196, 0.311646, 0.312096, 0.312544, 0.312992, 0.313439,
+    0.313885, 0.314331, 0.314775, 0.315219, 0.315663, 0.316105, 0.316547, 0.316988,
+    0.317428, 0.317868, 0.318306, 0.318745, 0.319182, 0.319619, 0.320054, 0.320490,
+    0.320924, 0.321358, 0.321791, 0.322223, 0.322655, 0.323086, 0.323517, 0.323946,
+    0.324375, 0.324803, 0.325231, 0.325658, 0.326084, 0.326510, 0.326935, 0.327359,
+    0.327783, 0.328205, 0.328628, 0.329049, 0.329470, 0.329891, 0.330310, 0.330730,
+    0.331148, 0.331566, 0.331983, 0.332399, 0.332815, 0.333231, 0.333645, 0.334059,
+    0.334473, 0.334886, 0.335298, 0.335710, 0.336121, 0.336531, 0.336941, 0.337350,
+    0.337759, 0.338167, 0.338574, 0.338981, 0.339387, 0.339793, 0.340198, 0.340602,
+    0.341006, 0.341410, 0.341812, 0.342215, 0.342616, 0.343017, 0.343418, 0.343818,
+    0.344217, 0.344616, 0.345015, 0.345412, 0.345810, 0.346206, 0.346602, 0.346998,
+    0.347393, 0.347787, 0.348181, 0.348575, 0.348968, 0.349360, 0.349752, 0.350143,
+    0.350534, 0.350924, 0.351314, 0.351703, 0.352092, 0.352480, 0.352868, 0.353255,
+    0.353642, 0.354028, 0.354413, 0.354799, 0.355183, 0.355567, 0.355951, 0.356334,
+    0.356717, 0.357099, 0.357481, 0.357862, 0.358243, 0.358623, 0.359003, 0.359382,
+    0.359761, 0.360139, 0.360517, 0.360894, 0.361271, 0.361647, 0.362023, 0.362399,
+    0.362774, 0.363148, 0.363522, 0.363896, 0.364269, 0.364642, 0.365014, 0.365386,
+    0.365757, 0.366128, 0.366498, 0.366868, 0.367238, 0.367607, 0.367976, 0.368344,
+    0.368712, 0.369079, 0.369446, 0.369812, 0.370178, 0.370544, 0.370909, 0.371274,
+    0.371638, 0.372002, 0.372365, 0.372728, 0.373091, 0.373453, 0.373815, 0.374176,
+    0.374537, 0.374897, 0.375257, 0.375617, 0.375976, 0.376335, 0.376694, 0.377052,
+    0.377409, 0.377766, 0.378123, 0.378480, 0.378835, 0.379191, 0.379546, 0.379901,
+    0.380255, 0.380609, 0.380963, 0.381316, 0.381669, 0.382021, 0.382373, 0.382725,
+    0.383076, 0.383427, 0.383778, 0.384128, 0.384478, 0.384827, 0.385176, 0.385524,
+    0.385873, 0.386220, 0.386568, 0.386915, 0.387262, 0.387608, 0.387954, 0.388299,
+    0.388645, 0.388990, 0.389334, 0.389678, 0.390022, 0.390365, 0.390708, 0.391051,
+    0.391393, 0.391735, 0.392077, 0.392418, 0.392759, 0.393099, 0.393440, 0.393779,
+    0.394119, 0.394458, 0.394797, 0.395135, 0.395473, 0.395811, 0.396148, 0.396485,
+    0.396822, 0.397158, 0.397494, 0.397830, 0.398165, 0.398500, 0.398835, 0.399169,
+    0.399503, 0.399837, 0.400170, 0.400503, 0.400836, 0.401168, 0.401500, 0.401832,
+    0.402163, 0.402494, 0.402825, 0.403155, 0.403485, 0.403815, 0.404144, 0.404473,
+    0.404802, 0.405131, 0.405459, 0.405786, 0.406114, 0.406441, 0.406768, 0.407094,
+    0.407421, 0.407746, 0.408072, 0.408397, 0.408722, 0.409047, 0.409371, 0.409695,
+    0.410019, 0.410342, 0.410665, 0.410988, 0.411311, 0.411633, 0.411955, 0.412276,
+    0.412598, 0.412919, 0.413239, 0.413560, 0.413880, 0.414200, 0.414519, 0.414838,
+    0.415157, 0.415476, 0.415794, 0.416112, 0.416430, 0.416747, 0.417065, 0.417381,
+    0.417698, 0.418014, 0.418330, 0.418646, 0.418961, 0.419277, 0.419592, 0.419906,
+    0.420220, 0.420534, 0.420848, 0.421162, 0.421475, 0.421788, 0.422100, 0.422413,
+    0.422725, 0.423037, 0.423348, 0.423659, 0.423970, 0.424281, 0.424591, 0.424901,
+    0.425211, 0.425521, 0.425830, 0.426139, 0.426448, 0.426757, 0.427065, 0.427373,
+    0.427681, 0.427988, 0.428295, 0.428602, 0.428909, 0.429215, 0.429521, 0.429827,
+    0.430133, 0.430438, 0.430743, 0.431048, 0.431353, 0.431657, 0.431961, 0.432265,
+    0.432569, 0.432872, 0.433175, 0.433478, 0.433780, 0.434083, 0.434385, 0.434686,
+    0.434988, 0.435289, 0.435590, 0.435891, 0.436192, 0.436492, 0.436792, 0.437092,
+    0.437391, 0.437691, 0.437990, 0.438288, 0.438587, 0.438885, 0.439183, 0.439481,
+    0.439779, 0.440076, 0.440373, 0.440670, 0.440967, 0.441263, 0.441559, 0.441855,
+    0.442151, 0.442446, 0.442741, 0.443036, 0.443331, 0.443626, 0.443920, 0.444214,
+    0.444508, 0.444801, 0.445095, 0.445388, 0.445681, 0.445973, 0.446266, 0.446558,
+    0.446850, 0.447141, 0.447433, 0.447724, 0.448015, 0.448306, 0.448597, 0.448887,
+    0.449177, 0.449467, 0.449757, 0.450046, 0.450335, 0.450624, 0.450913, 0.451202,
+    0.451490, 0.451778, 0.452066, 0.452354, 0.452641, 0.452929, 0.453216, 0.453502,
+    0.453789, 0.454075, 0.454361, 0.454647, 0.454933, 0.455219, 0.455504, 0.455789,
+    0.456074, 0.456359, 0.456643, 0.456927, 0.457211, 0.457495, 0.457779, 0.458062,
+    0.458345, 0.458628, 0.458911, 0.459193, 0.459476, 0.459758, 0.460040, 0.460322,
+    0.460603, 0.460884, 0.461165, 0.461446, 0.461727, 0.462008, 0.462288, 0.462568,
+    0.462848, 0.463127, 0.463407, 0.463686, 0.463965, 0.464244, 0.464523, 0.464801,
+    0.465079, 0.465357, 0.465635, 0.465913, 0.466190, 0.466468, 0.466745, 0.467022,
+    0.467298, 0.467575, 0.467851, 0.468127, 0.468403, 0.468679, 0.468954, 0.469230,
+    0.469505, 0.469780, 0.470054, 0.470329, 0.470603, 0.470877, 0.471151, 0.471425,
+    0.471699, 0.471972, 0.472245, 0.472518, 0.472791, 0.473064, 0.473336, 0.473608,
+    0.473880, 0.474152, 0.474424, 0.474695, 0.474967, 0.475238, 0.475509, 0.475780,
+    0.476050, 0.476321, 0.476591, 0.476861, 0.477131, 0.477400, 0.477670, 0.477939,
+    0.478208, 0.478477, 0.478746, 0.479014, 0.479283, 0.479551, 0.479819, 0.480087,
+    0.480355, 0.480622, 0.480889, 0.481157, 0.481423, 0.481690, 0.481957, 0.482223,
+    0.482489, 0.482756, 0.483021, 0.483287, 0.483553, 0.483818, 0.484083, 0.484348,
+    0.484613, 0.484878, 0.485142, 0.485407, 0.485671, 0.485935, 0.486199, 0.486462,
+    0.486726, 0.486989, 0.487252, 0.487515, 0.487778, 0.488040, 0.488303, 0.488565,
+    0.488827, 0.489089, 0.489351, 0.489613, 0.489874, 0.490135, 0.490396, 0.490657,
+    0.490918, 0.491179, 0.491439, 0.491699, 0.491959, 0.492219, 0.492479, 0.492739,
+    0.492998, 0.493258, 0.493517, 0.493776, 0.494034, 0.494293, 0.494551, 0.494810,
+    0.495068, 0.495326, 0.495584, 0.495841, 0.496099, 0.496356, 0.496613, 0.496870,
+    0.497127, 0.497384, 0.497641, 0.497897, 0.498153, 0.498409, 0.498665, 0.498921,
+    0.499176, 0.499432, 0.499687, 0.499942, 0.500197, 0.500452, 0.500707, 0.500961,
+    0.501216, 0.501470, 0.501724, 0.501978, 0.502231, 0.502485, 0.502738, 0.502992,
+    0.503245, 0.503498, 0.503751, 0.504003, 0.504256, 0.504508, 0.504760, 0.505012,
+    0.505264, 0.505516, 0.505768, 0.506019, 0.506270, 0.506522, 0.506773, 0.507023,
+    0.507274, 0.507525, 0.507775, 0.508025, 0.508275, 0.508525, 0.508775, 0.509025,
+    0.509274, 0.509524, 0.509773, 0.510022, 0.510271, 0.510520, 0.510768, 0.511017,
+    0.511265, 0.511514, 0.511762, 0.512010, 0.512257, 0.512505, 0.512752, 0.513000,
+    0.513247, 0.513494, 0.513741, 0.513988, 0.514234, 0.514481, 0.514727, 0.514973,
+    0.515220, 0.515465, 0.515711, 0.515957, 0.516202, 0.516448, 0.516693, 0.516938,
+    0.517183, 0.517428, 0.517672, 0.517917, 0.518161, 0.518406, 0.518650, 0.518894,
+    0.519138, 0.519381, 0.519625, 0.519868, 0.520112, 0.520355, 0.520598, 0.520841,
+    0.521083, 0.521326, 0.521568, 0.521811, 0.522053, 0.522295, 0.522537, 0.522779,
+    0.523021, 0.523262, 0.523503, 0.523745, 0.523986, 0.524227, 0.524468, 0.524708,
+    0.524949, 0.525190, 0.525430, 0.525670, 0.525910, 0.526150, 0.526390, 0.526630,
+    0.526869, 0.527109, 0.527348, 0.527587, 0.527826, 0.528065, 0.528304, 0.528542,
+    0.528781, 0.529019, 0.529258, 0.529496, 0.529734, 0.529972, 0.530209, 0.530447,
+    0.530684, 0.530922, 0.531159, 0.531396, 0.531633, 0.531870, 0.532107, 0.532343,
+    0.532580, 0.532816, 0.533052, 0.533288, 0.533524, 0.533760, 0.533996, 0.534231,
+    0.534467, 0.534702, 0.534937, 0.535173, 0.535408, 0.535642, 0.535877, 0.536112,
+    0.536346, 0.536581, 0.536815, 0.537049, 0.537283, 0.537517, 0.537750, 0.537984,
+    0.538218, 0.538451, 0.538684, 0.538917, 0.539150, 0.539383, 0.539616, 0.539849,
+    0.540081, 0.540314, 0.540546, 0.540778, 0.541010, 0.541242, 0.541474, 0.541706,
+    0.541937, 0.542169, 0.542400, 0.542631, 0.542862, 0.543093, 0.543324, 0.543555,
+    0.543786, 0.544016, 0.544246, 0.544477, 0.544707, 0.544937, 0.545167, 0.545397,
+    0.545626, 0.545856, 0.546085, 0.546315, 0.546544, 0.546773, 0.547002, 0.547231,
+    0.547460, 0.547689, 0.547917, 0.548145, 0.548374, 0.548602, 0.548830, 0.549058,
+    0.549286, 0.549514, 0.549741, 0.549969, 0.550196, 0.550424, 0.550651, 0.550878,
+    0.551105, 0.551332, 0.551558, 0.551785, 0.552011, 0.552238, 0.552464, 0.552690,
+    0.552916, 0.553142, 0.553368, 0.553594, 0.553820, 0.554045, 0.554271, 0.554496,
+    0.554721, 0.554946, 0.555171, 0.555396, 0.555621, 0.555845, 0.556070, 0.556294,
+    0.556519, 0.556743, 0.556967, 0.557191, 0.557415, 0.557638, 0.557862, 0.558086,
+    0.558309, 0.558532, 0.558756, 0.558979, 0.559202, 0.559425, 0.559648, 0.559870,
+    0.560093, 0.560315, 0.560538, 0.560760, 0.560982, 0.561204, 0.561426, 0.561648,
+    0.561870, 0.562091, 0.562313, 0.562534, 0.562756, 0.562977, 0.563198, 0.563419,
+    0.563640, 0.563861, 0.564082, 0.564302, 0.564523, 0.564743, 0.564963, 0.565184,
+    0.565404, 0.565624, 0.565844, 0.566063, 0.566283, 0.566503, 0.566722, 0.566941,
+    0.567161, 0.567380, 0.567599, 0.567818, 0.568037, 0.568255, 0.568474, 0.568693,
+    0.568911, 0.569130, 0.569348, 0.569566, 0.569784, 0.570002, 0.570220, 0.570438,
+    0.570655, 0.570873, 0.571090, 0.571308, 0.571525, 0.571742, 0.571959, 0.572176,
+    0.572393, 0.572610, 0.572826, 0.573043, 0.573259, 0.573476, 0.573692, 0.573908,
+    0.574124, 0.574340, 0.574556, 0.574772, 0.574988, 0.575203, 0.575419, 0.575634,
+    0.575849, 0.576065, 0.576280, 0.576495, 0.576710, 0.576924, 0.577139, 0.577354,
+    0.577568, 0.577783, 0.577997, 0.578211, 0.578426, 0.578640, 0.578854, 0.579067,
+    0.579281, 0.579495, 0.579708, 0.579922, 0.580135, 0.580349, 0.580562, 0.580775,
+    0.580988, 0.581201, 0.581414, 0.581627, 0.581839, 0.582052, 0.582264, 0.582477,
+    0.582689, 0.582901, 0.583113, 0.583325, 0.583537, 0.583749, 0.583960, 0.584172,
+    0.584384, 0.584595, 0.584806, 0.585018, 0.585229, 0.585440, 0.585651, 0.585862,
+    0.586073, 0.586283, 0.586494, 0.586704, 0.586915, 0.587125, 0.587336, 0.587546,
+    0.587756, 0.587966, 0.588176, 0.588385, 0.588595, 0.588805, 0.589014, 0.589224,
+    0.589433, 0.589642, 0.589852, 0.590061, 0.590270, 0.590479, 0.590687, 0.590896,
+    0.591105, 0.591313, 0.591522, 0.591730, 0.591939, 0.592147, 0.592355, 0.592563,
+    0.592771, 0.592979, 0.593187, 0.593394, 0.593602, 0.593809, 0.594017, 0.594224,
+    0.594431, 0.594638, 0.594846, 0.595053, 0.595259, 0.595466, 0.595673, 0.595880,
+    0.596086, 0.596293, 0.596499, 0.596705, 0.596912, 0.597118, 0.597324, 0.597530,
+    0.597736, 0.597941, 0.598147, 0.598353, 0.598558, 0.598764, 0.598969, 0.599174,
+    0.599380, 0.599585, 0.599790, 0.599995, 0.600199, 0.600404, 0.600609, 0.600814,
+    0.601018, 0.601223, 0.601427, 0.601631, 0.601835, 0.602039, 0.602243, 0.602447,
+    0.602651, 0.602855, 0.603059, 0.603262, 0.603466, 0.603669, 0.603873, 0.604076,
+    0.604279, 0.604482, 0.604685, 0.604888, 0.605091, 0.605294, 0.605497, 0.605699,
+    0.605902, 0.606104, 0.606307, 0.606509, 0.606711, 0.606913, 0.607115, 0.607317,
+    0.607519, 0.607721, 0.607923, 0.608125, 0.608326, 0.608528, 0.608729, 0.608930,
+    0.609132, 0.609333, 0.609534, 0.609735, 0.609936, 0.610137, 0.610338, 0.610538,
+    0.610739, 0.610939, 0.611140, 0.611340, 0.611541, 0.611741, 0.611941, 0.612141,
+    0.612341, 0.612541, 0.612741, 0.612941, 0.613140, 0.613340, 0.613539, 0.613739,
+    0.613938, 0.614137, 0.614337, 0.614536, 0.614735, 0.614934, 0.615133, 0.615332,
+    0.615530, 0.615729, 0.615928, 0.616126, 0.616325, 0.616523, 0.616721, 0.616919,
+    0.617118, 0.617316, 0.617514, 0.617711, 0.617909, 0.618107, 0.618305, 0.618502,
+    0.618700, 0.618897, 0.619095, 0.619292, 0.619489, 0.619686, 0.619883, 0.620080,
+    0.620277, 0.620474, 0.620671, 0.620868, 0.621064, 0.621261, 0.621457, 0.621654,
+    0.621850, 0.622046, 0.622243, 0.622439, 0.622635, 0.622831, 0.623027, 0.623222,
+    0.623418, 0.623614, 0.623809, 0.624005, 0.624200, 0.624396, 0.624591, 0.624786,
+    0.624981, 0.625176, 0.625371, 0.625566, 0.625761, 0.625956, 0.626151, 0.626345,
+    0.626540, 0.626734, 0.626929, 0.627123, 0.627317, 0.627512, 0.627706, 0.627900,
+    0.628094, 0.628288, 0.628482, 0.628675, 0.628869, 0.629063, 0.629256, 0.629450,
+    0.629643, 0.629836, 0.630030, 0.630223, 0.630416, 0.630609, 0.630802, 0.630995,
+    0.631188, 0.631381, 0.631573, 0.631766, 0.631959, 0.632151, 0.632343, 0.632536,
+    0.632728, 0.632920, 0.633112, 0.633305, 0.633497, 0.633688, 0.633880, 0.634072,
+    0.634264, 0.634456, 0.634647, 0.634839, 0.635030, 0.635221, 0.635413, 0.635604,
+    0.635795, 0.635986, 0.636177, 0.636368, 0.636559, 0.636750, 0.636941, 0.637131,
+    0.637322, 0.637513, 0.637703, 0.637894, 0.638084, 0.638274, 0.638464, 0.638654,
+    0.638845, 0.639035, 0.639225, 0.639414, 0.639604, 0.639794, 0.639984, 0.640173,
+    0.640363, 0.640552, 0.640742, 0.640931, 0.641120, 0.641309, 0.641499, 0.641688,
+    0.641877, 0.642066, 0.642254, 0.642443, 0.642632, 0.642821, 0.643009, 0.643198,
+    0.643386, 0.643575, 0.643763, 0.643951, 0.644139, 0.644328, 0.644516, 0.644704,
+    0.644892, 0.645079, 0.645267, 0.645455, 0.645643, 0.645830, 0.646018, 0.646205,
+    0.646393, 0.646580, 0.646767, 0.646955, 0.647142, 0.647329, 0.647516, 0.647703,
+    0.647890, 0.648076, 0.648263, 0.648450, 0.648637, 0.648823, 0.649010, 0.649196,
+    0.649382, 0.649569, 0.649755, 0.649941, 0.650127, 0.650313, 0.650499, 0.650685,
+    0.650871, 0.651057, 0.651243, 0.651428, 0.651614, 0.651800, 0.651985, 0.652171,
+    0.652356, 0.652541, 0.652726, 0.652912, 0.653097, 0.653282, 0.653467, 0.653652,
+    0.653836, 0.654021, 0.654206, 0.654391, 0.654575, 0.654760, 0.654944, 0.655129,
+    0.655313, 0.655497, 0.655682, 0.655866, 0.656050, 0.656234, 0.656418, 0.656602,
+    0.656786, 0.656970, 0.657153, 0.657337, 0.657521, 0.657704, 0.657888, 0.658071,
+    0.658254, 0.658438, 0.658621, 0.658804, 0.658987, 0.659170, 0.659353, 0.659536,
+    0.659719, 0.659902, 0.660085, 0.660267, 0.660450, 0.660633, 0.660815, 0.660998,
+    0.661180, 0.661362, 0.661545, 0.661727, 0.661909, 0.662091, 0.662273, 0.662455,
+    0.662637, 0.662819, 0.663001, 0.663182, 0.663364, 0.663546, 0.663727, 0.663909,
+    0.664090, 0.664271, 0.664453, 0.664634, 0.664815, 0.664996, 0.665177, 0.665358,
+    0.665539, 0.665720, 0.665901, 0.666082, 0.666263, 0.666443, 0.666624, 0.666805,
+    0.666985, 0.667165, 0.667346, 0.667526, 0.667706, 0.667887, 0.668067, 0.668247,
+    0.668427, 0.668607, 0.668787, 0.668967, 0.669146, 0.669326, 0.669506, 0.669685,
+    0.669865, 0.670044, 0.670224, 0.670403, 0.670583, 0.670762, 0.670941, 0.671120,
+    0.671299, 0.671478, 0.671657, 0.671836, 0.672015, 0.672194, 0.672373, 0.672551,
+    0.672730, 0.672909, 0.673087, 0.673266, 0.673444, 0.673622, 0.673801, 0.673979,
+    0.674157, 0.674335, 0.674513, 0.674691, 0.674869, 0.675047, 0.675225, 0.675403,
+    0.675581, 0.675758, 0.675936, 0.676114, 0.676291, 0.676468, 0.676646, 0.676823,
+    0.677001, 0.677178, 0.677355, 0.677532, 0.677709, 0.677886, 0.678063, 0.678240,
+    0.678417, 0.678594, 0.678770, 0.678947, 0.679124, 0.679300, 0.679477, 0.679653,
+    0.679830, 0.680006, 0.680182, 0.680359, 0.680535, 0.680711, 0.680887, 0.681063,
+    0.681239, 0.681415, 0.681591, 0.681766, 0.681942, 0.682118, 0.682294, 0.682469,
+    0.682645, 0.682820, 0.682996, 0.683171, 0.683346, 0.683522, 0.683697, 0.683872,
+    0.684047, 0.684222, 0.684397, 0.684572, 0.684747, 0.684922, 0.685096, 0.685271,
+    0.685446, 0.685620, 0.685795, 0.685970, 0.686144, 0.686318, 0.686493, 0.686667,
+    0.686841, 0.687016, 0.687190, 0.687364, 0.687538, 0.687712, 0.687886, 0.688060,
+    0.688233, 0.688407, 0.688581, 0.688755, 0.688928, 0.689102, 0.689275, 0.689449,
+    0.689622, 0.689795, 0.689969, 0.690142, 0.690315, 0.690488, 0.690661, 0.690834,
+    0.691007, 0.691180, 0.691353, 0.691526, 0.691699, 0.691872, 0.692044, 0.692217,
+    0.692389, 0.692562, 0.692734, 0.692907, 0.693079, 0.693251, 0.693424, 0.693596,
+    0.693768, 0.693940, 0.694112, 0.694284, 0.694456, 0.694628, 0.694800, 0.694972,
+    0.695144, 0.695315, 0.695487, 0.695659, 0.695830, 0.696002, 0.696173, 0.696344,
+    0.696516, 0.696687, 0.696858, 0.697029, 0.697201, 0.697372, 0.697543, 0.697714,
+    0.697885, 0.698056, 0.698226, 0.698397, 0.698568, 0.698739, 0.698909, 0.699080,
+    0.699250, 0.699421, 0.699591, 0.699762, 0.699932, 0.700102, 0.700273, 0.700443,
+    0.700613, 0.700783, 0.700953, 0.701123, 0.701293, 0.701463, 0.701633, 0.701803,
+    0.701972, 0.702142, 0.702312, 0.702481, 0.702651, 0.702820, 0.702990, 0.703159,
+    0.703329, 0.703498, 0.703667, 0.703836, 0.704005, 0.704175, 0.704344, 0.704513,
+    0.704682, 0.704850, 0.705019, 0.705188, 0.705357, 0.705526, 0.705694, 0.705863,
+    0.706032, 0.706200, 0.706369, 0.706537, 0.706705, 0.706874, 0.707042, 0.707210,
+    0.707378, 0.707547, 0.707715, 0.707883, 0.708051, 0.708219, 0.708387, 0.708554,
+    0.708722, 0.708890, 0.709058, 0.709225, 0.709393, 0.709561, 0.709728, 0.709896,
+    0.710063, 0.710230, 0.710398, 0.710565, 0.710732, 0.710899, 0.711067, 0.711234,
+    0.711401, 0.711568, 0.711735, 0.711902, 0.712068, 0.712235, 0.712402, 0.712569,
+    0.712735, 0.712902, 0.713069, 0.713235, 0.713402, 0.713568, 0.713734, 0.713901,
+    0.714067, 0.714233, 0.714400, 0.714566, 0.714732, 0.714898, 0.715064, 0.715230,
+    0.715396, 0.715562, 0.715728, 0.715893, 0.716059, 0.716225, 0.716391, 0.716556,
+    0.716722, 0.716887, 0.717053, 0.717218, 0.717383, 0.717549, 0.717714, 0.717879,
+    0.718045, 0.718210, 0.718375, 0.718540, 0.718705, 0.718870, 0.719035, 0.719200,
+    0.719364, 0.719529, 0.719694, 0.719859, 0.720023, 0.720188, 0.720353, 0.720517,
+    0.720682, 0.720846, 0.721010, 0.721175, 0.721339, 0.721503, 0.721667, 0.721832,
+    0.721996, 0.722160, 0.722324, 0.722488, 0.722652, 0.722816, 0.722979, 0.723143,
+    0.723307, 0.723471, 0.723634, 0.723798, 0.723962, 0.724125, 0.724289, 0.724452,
+    0.724615, 0.724779, 0.724942, 0.725105, 0.725269, 0.725432, 0.725595, 0.725758,
+    0.725921, 0.726084, 0.726247, 0.726410, 0.726573, 0.726736, 0.726898, 0.727061,
+    0.727224, 0.727386, 0.727549, 0.727712, 0.727874, 0.728037, 0.728199, 0.728361,
+    0.728524, 0.728686, 0.728848, 0.729011, 0.729173, 0.729335, 0.729497, 0.729659,
+    0.729821, 0.729983, 0.730145, 0.730307, 0.730469, 0.730630, 0.730792, 0.730954,
+    0.731116, 0.731277, 0.731439, 0.731600, 0.731762, 0.731923, 0.732085, 0.732246,
+    0.732407, 0.732569, 0.732730, 0.732891, 0.733052, 0.733213, 0.733374, 0.733535,
+    0.733696, 0.733857, 0.734018, 0.734179, 0.734340, 0.734500, 0.734661, 0.734822,
+    0.734983, 0.735143, 0.735304, 0.735464, 0.735625, 0.735785, 0.735945, 0.736106,
+    0.736266, 0.736426, 0.736587, 0.736747, 0.736907, 0.737067, 0.737227, 0.737387,
+    0.737547, 0.737707, 0.737867, 0.738027, 0.738186, 0.738346, 0.738506, 0.738666,
+    0.738825, 0.738985, 0.739144, 0.739304, 0.739463, 0.739623, 0.739782, 0.739942,
+    0.740101, 0.740260, 0.740419, 0.740579, 0.740738, 0.740897, 0.741056, 0.741215,
+    0.741374, 0.741533, 0.741692, 0.741851, 0.742009, 0.742168, 0.742327, 0.742486,
+    0.742644, 0.742803, 0.742961, 0.743120, 0.743278, 0.743437, 0.743595, 0.743754,
+    0.743912, 0.744070, 0.744228, 0.744387, 0.744545, 0.744703, 0.744861, 0.745019,
+    0.745177, 0.745335, 0.745493, 0.745651, 0.745809, 0.745966, 0.746124, 0.746282,
+    0.746440, 0.746597, 0.746755, 0.746912, 0.747070, 0.747227, 0.747385, 0.747542,
+    0.747700, 0.747857, 0.748014, 0.748172, 0.748329, 0.748486, 0.748643, 0.748800,
+    0.748957, 0.749114, 0.749271, 0.749428, 0.749585, 0.749742, 0.749899, 0.750055,
+    0.750212, 0.750369, 0.750525, 0.750682, 0.750839, 0.750995, 0.751152, 0.751308,
+    0.751465, 0.751621, 0.751777, 0.751934, 0.752090, 0.752246, 0.752402, 0.752558,
+    0.752715, 0.752871, 0.753027, 0.753183, 0.753339, 0.753494, 0.753650, 0.753806,
+    0.753962, 0.754118, 0.754273, 0.754429, 0.754585, 0.754740, 0.754896, 0.755051,
+    0.755207, 0.755362, 0.755518, 0.755673, 0.755829, 0.755984, 0.756139, 0.756294,
+    0.756449, 0.756605, 0.756760, 0.756915, 0.757070, 0.757225, 0.757380, 0.757535,
+    0.757690, 0.757844, 0.757999, 0.758154, 0.758309, 0.758463, 0.758618, 0.758773,
+    0.758927, 0.759082, 0.759236, 0.759391, 0.759545, 0.759700, 0.759854, 0.760008,
+    0.760162, 0.760317, 0.760471, 0.760625, 0.760779, 0.760933, 0.761087, 0.761241,
+    0.761395, 0.761549, 0.761703, 0.761857, 0.762011, 0.762165, 0.762318, 0.762472,
+    0.762626, 0.762779, 0.762933, 0.763087, 0.763240, 0.763394, 0.763547, 0.763700,
+    0.763854, 0.764007, 0.764160, 0.764314, 0.764467, 0.764620, 0.764773, 0.764926,
+    0.765079, 0.765233, 0.765386, 0.765539, 0.765691, 0.765844, 0.765997, 0.766150,
+    0.766303, 0.766456, 0.766608, 0.766761, 0.766914, 0.767066, 0.767219, 0.767371,
+    0.767524, 0.767676, 0.767829, 0.767981, 0.768133, 0.768286, 0.768438, 0.768590,
+    0.768743, 0.768895, 0.769047, 0.769199, 0.769351, 0.769503, 0.769655, 0.769807,
+    0.769959, 0.770111, 0.770263, 0.770414, 0.770566, 0.770718, 0.770870, 0.771021,
+    0.771173, 0.771325, 0.771476, 0.771628, 0.771779, 0.771931, 0.772082, 0.772233,
+    0.772385, 0.772536, 0.772687, 0.772839, 0.772990, 0.773141, 0.773292, 0.773443,
+    0.773594, 0.773745, 0.773896, 0.774047, 0.774198, 0.774349, 0.774500, 0.774651,
+    0.774801, 0.774952, 0.775103, 0.775254, 0.775404, 0.775555, 0.775705, 0.775856,
+    0.776006, 0.776157, 0.776307, 0.776458, 0.776608, 0.776758, 0.776909, 0.777059,
+    0.777209, 0.777359, 0.777510, 0.777660, 0.777810, 0.777960, 0.778110, 0.778260,
+    0.778410, 0.778560, 0.778709, 0.778859, 0.779009, 0.779159, 0.779309, 0.779458,
+    0.779608, 0.779758, 0.779907, 0.780057, 0.780206, 0.780356, 0.780505, 0.780655,
+    0.780804, 0.780953, 0.781103, 0.781252, 0.781401, 0.781550, 0.781700, 0.781849,
+    0.781998, 0.782147, 0.782296, 0.782445, 0.782594, 0.782743, 0.782892, 0.783041,
+    0.783190, 0.783338, 0.783487, 0.783636, 0.783785, 0.783933, 0.784082, 0.784231,
+    0.784379, 0.784528, 0.784676, 0.784825, 0.784973, 0.785122, 0.785270, 0.785418,
+    0.785567, 0.785715, 0.785863, 0.786011, 0.786159, 0.786308, 0.786456, 0.786604,
+    0.786752, 0.786900, 0.787048, 0.787196, 0.787344, 0.787491, 0.787639, 0.787787,
+    0.787935, 0.788083, 0.788230, 0.788378, 0.788526, 0.788673, 0.788821, 0.788968,
+    0.789116, 0.789263, 0.789411, 0.789558, 0.789706, 0.789853, 0.790000, 0.790147,
+    0.790295, 0.790442, 0.790589, 0.790736, 0.790883, 0.791030, 0.791177, 0.791324,
+    0.791471, 0.791618, 0.791765, 0.791912, 0.792059, 0.792206, 0.792353, 0.792499,
+    0.792646, 0.792793, 0.792939, 0.793086, 0.793233, 0.793379, 0.793526, 0.793672,
+    0.793819, 0.793965, 0.794111, 0.794258, 0.794404, 0.794550, 0.794697, 0.794843,
+    0.794989, 0.795135, 0.795281, 0.795427, 0.795574, 0.795720, 0.795866, 0.796012,
+    0.796157, 0.796303, 0.796449, 0.796595, 0.796741, 0.796887, 0.797032, 0.797178,
+    0.797324, 0.797470, 0.797615, 0.797761, 0.797906, 0.798052, 0.798197, 0.798343,
+    0.798488, 0.798634, 0.798779, 0.798924, 0.799070, 0.799215, 0.799360, 0.799505,
+    0.799650, 0.799796, 0.799941, 0.800086, 0.800231, 0.800376, 0.800521, 0.800666,
+    0.800811, 0.800956, 0.801100, 0.801245, 0.801390, 0.801535, 0.801680, 0.801824,
+    0.801969, 0.802114, 0.802258, 0.802403, 0.802547, 0.802692, 0.802836, 0.802981,
+    0.803125, 0.803270, 0.803414, 0.803558, 0.803703, 0.803847, 0.803991, 0.804135,
+    0.804279, 0.804424, 0.804568, 0.804712, 0.804856, 0.805000, 0.805144, 0.805288,
+    0.805432, 0.805576, 0.805719, 0.805863, 0.806007, 0.806151, 0.806295, 0.806438,
+    0.806582, 0.806726, 0.806869, 0.807013, 0.807156, 0.807300, 0.807443, 0.807587,
+    0.807730, 0.807874, 0.808017, 0.808160, 0.808304, 0.808447, 0.808590, 0.808734,
+    0.808877, 0.809020, 0.809163, 0.809306, 0.809449, 0.809592, 0.809735, 0.809878,
+    0.810021, 0.810164, 0.810307, 0.810450, 0.810593, 0.810735, 0.810878, 0.811021,
+    0.811164, 0.811306, 0.811449, 0.811592, 0.811734, 0.811877, 0.812019, 0.812162,
+    0.812304, 0.812447, 0.812589, 0.812731, 0.812874, 0.813016, 0.813158, 0.813301,
+    0.813443, 0.813585, 0.813727, 0.813869, 0.814011, 0.814153, 0.814296, 0.814438,
+    0.814580, 0.814721, 0.814863, 0.815005, 0.815147, 0.815289, 0.815431, 0.815573,
+    0.815714, 0.815856, 0.815998, 0.816139, 0.816281, 0.816423, 0.816564, 0.816706,
+    0.816847, 0.816989, 0.817130, 0.817272, 0.817413, 0.817554, 0.817696, 0.817837,
+    0.817978, 0.818120, 0.818261, 0.818402, 0.818543, 0.818684, 0.818825, 0.818966,
+    0.819108, 0.819249, 0.819390, 0.819530, 0.819671, 0.819812, 0.819953, 0.820094,
+    0.820235, 0.820376, 0.820516, 0.820657, 0.820798, 0.820938, 0.821079, 0.821220,
+    0.821360, 0.821501, 0.821641, 0.821782, 0.821922, 0.822063, 0.822203, 0.822344,
+    0.822484, 0.822624, 0.822765, 0.822905, 0.823045, 0.823185, 0.823325, 0.823466,
+    0.823606, 0.823746, 0.823886, 0.824026, 0.824166, 0.824306, 0.824446, 0.824586,
+    0.824726, 0.824866, 0.825005, 0.825145, 0.825285, 0.825425, 0.825564, 0.825704,
+    0.825844, 0.825983, 0.826123, 0.826263, 0.826402, 0.826542, 0.826681, 0.826821,
+    0.826960, 0.827099, 0.827239, 0.827378, 0.827518, 0.827657, 0.827796, 0.827935,
+    0.828075, 0.828214, 0.828353, 0.828492, 0.828631, 0.828770, 0.828909, 0.829048,
+    0.829187, 0.829326, 0.829465, 0.829604, 0.829743, 0.829882, 0.830021, 0.830159,
+    0.830298, 0.830437, 0.830576, 0.830714, 0.830853, 0.830992, 0.831130, 0.831269,
+    0.831407, 0.831546, 0.831684, 0.831823, 0.831961, 0.832100, 0.832238, 0.832376,
+    0.832515, 0.832653, 0.832791, 0.832929, 0.833068, 0.833206, 0.833344, 0.833482,
+    0.833620, 0.833758, 0.833896, 0.834034, 0.834172, 0.834310, 0.834448, 0.834586,
+    0.834724, 0.834862, 0.835000, 0.835138, 0.835275, 0.835413, 0.835551, 0.835689,
+    0.835826, 0.835964, 0.836101, 0.836239, 0.836377, 0.836514, 0.836652, 0.836789,
+    0.836927, 0.837064, 0.837201, 0.837339, 0.837476, 0.837613, 0.837751, 0.837888,
+    0.838025, 0.838162, 0.838300, 0.838437, 0.838574, 0.838711, 0.838848, 0.838985,
+    0.839122, 0.839259, 0.839396, 0.839533, 0.839670, 0.839807, 0.839944, 0.840080,
+    0.840217, 0.840354, 0.840491, 0.840628, 0.840764, 0.840901, 0.841038, 0.841174,
+    0.841311, 0.841447, 0.841584, 0.841720, 0.841857, 0.841993, 0.842130, 0.842266,
+    0.842402, 0.842539, 0.842675, 0.842811, 0.842948, 0.843084, 0.843220, 0.843356,
+    0.843493, 0.843629, 0.843765, 0.843901, 0.844037, 0.844173, 0.844309, 0.844445,
+    0.844581, 0.844717, 0.844853, 0.844989, 0.845124, 0.845260, 0.845396, 0.845532,
+    0.845668, 0.845803, 0.845939, 0.846075, 0.846210, 0.846346, 0.846482, 0.846617,
+    0.846753, 0.846888, 0.847024, 0.847159, 0.847295, 0.847430, 0.847565, 0.847701,
+    0.847836, 0.847971, 0.848107, 0.848242, 0.848377, 0.848512, 0.848647, 0.848783,
+    0.848918, 0.849053, 0.849188, 0.849323, 0.849458, 0.849593, 0.849728, 0.849863,
+    0.849998, 0.850133, 0.850268, 0.850402, 0.850537, 0.850672, 0.850807, 0.850941,
+    0.851076, 0.851211, 0.851345, 0.851480, 0.851615, 0.851749, 0.851884, 0.852018,
+    0.852153, 0.852287, 0.852422, 0.852556, 0.852691, 0.852825, 0.852959, 0.853094,
+    0.853228, 0.853362, 0.853497, 0.853631, 0.853765, 0.853899, 0.854033, 0.854167,
+    0.854302, 0.854436, 0.854570, 0.854704, 0.854838, 0.854972, 0.855106, 0.855240,
+    0.855373, 0.855507, 0.855641, 0.855775, 0.855909, 0.856043, 0.856176, 0.856310,
+    0.856444, 0.856577, 0.856711, 0.856845, 0.856978, 0.857112, 0.857245, 0.857379,
+    0.857512, 0.857646, 0.857779, 0.857913, 0.858046, 0.858180, 0.858313, 0.858446,
+    0.858580, 0.858713, 0.858846, 0.858979, 0.859112, 0.859246, 0.859379, 0.859512,
+    0.859645, 0.859778, 0.859911, 0.860044, 0.860177, 0.860310, 0.860443, 0.860576,
+    0.860709, 0.860842, 0.860975, 0.861108, 0.861240, 0.861373, 0.861506, 0.861639,
+    0.861771, 0.861904, 0.862037, 0.862169, 0.862302, 0.862434, 0.862567, 0.862700,
+    0.862832, 0.862965, 0.863097, 0.863229, 0.863362, 0.863494, 0.863627, 0.863759,
+    0.863891, 0.864024, 0.864156, 0.864288, 0.864420, 0.864552, 0.864685, 0.864817,
+    0.864949, 0.865081, 0.865213, 0.865345, 0.865477, 0.865609, 0.865741, 0.865873,
+    0.866005, 0.866137, 0.866269, 0.866401, 0.866533, 0.866664, 0.866796, 0.866928,
+    0.867060, 0.867191, 0.867323, 0.867455, 0.867586, 0.867718, 0.867850, 0.867981,
+    0.868113, 0.868244, 0.868376, 0.868507, 0.868639, 0.868770, 0.868901, 0.869033,
+    0.869164, 0.869295, 0.869427, 0.869558, 0.869689, 0.869821, 0.869952, 0.870083,
+    0.870214, 0.870345, 0.870476, 0.870607, 0.870738, 0.870870, 0.871001, 0.871132,
+    0.871263, 0.871393, 0.871524, 0.871655, 0.871786, 0.871917, 0.872048, 0.872179,
+    0.872309, 0.872440, 0.872571, 0.872702, 0.872832, 0.872963, 0.873094, 0.873224,
+    0.873355, 0.873485, 0.873616, 0.873747, 0.873877, 0.874008, 0.874138, 0.874268,
+    0.874399, 0.874529, 0.874660, 0.874790, 0.874920, 0.875051, 0.875181, 0.875311,
+    0.875441, 0.875571, 0.875702, 0.875832, 0.875962, 0.876092, 0.876222, 0.876352,
+    0.876482, 0.876612, 0.876742, 0.876872, 0.877002, 0.877132, 0.877262, 0.877392,
+    0.877522, 0.877652, 0.877781, 0.877911, 0.878041, 0.878171, 0.878300, 0.878430,
+    0.878560, 0.878689, 0.878819, 0.878949, 0.879078, 0.879208, 0.879337, 0.879467,
+    0.879596, 0.879726, 0.879855, 0.879985, 0.880114, 0.880243, 0.880373, 0.880502,
+    0.880631, 0.880761, 0.880890, 0.881019, 0.881148, 0.881277, 0.881407, 0.881536,
+    0.881665, 0.881794, 0.881923, 0.882052, 0.882181, 0.882310, 0.882439, 0.882568,
+    0.882697, 0.882826, 0.882955, 0.883084, 0.883213, 0.883341, 0.883470, 0.883599,
+    0.883728, 0.883856, 0.883985, 0.884114, 0.884243, 0.884371, 0.884500, 0.884628,
+    0.884757, 0.884886, 0.885014, 0.885143, 0.885271, 0.885400, 0.885528, 0.885656,
+    0.885785, 0.885913, 0.886042, 0.886170, 0.886298, 0.886427, 0.886555, 0.886683,
+    0.886811, 0.886939, 0.887068, 0.887196, 0.887324, 0.887452, 0.887580, 0.887708,
+    0.887836, 0.887964, 0.888092, 0.888220, 0.888348, 0.888476, 0.888604, 0.888732,
+    0.888860, 0.888988, 0.889115, 0.889243, 0.889371, 0.889499, 0.889627, 0.889754,
+    0.889882, 0.890010, 0.890137, 0.890265, 0.890392, 0.890520, 0.890648, 0.890775,
+    0.890903, 0.891030, 0.891158, 0.891285, 0.891413, 0.891540, 0.891667, 0.891795,
+    0.891922, 0.892049, 0.892177, 0.892304, 0.892431, 0.892558, 0.892686, 0.892813,
+    0.892940, 0.893067, 0.893194, 0.893321, 0.893448, 0.893575, 0.893703, 0.893830,
+    0.893957, 0.894083, 0.894210, 0.894337, 0.894464, 0.894591, 0.894718, 0.894845,
+    0.894972, 0.895098, 0.895225, 0.895352, 0.895479, 0.895605, 0.895732, 0.895859,
+    0.895985, 0.896112, 0.896239, 0.896365, 0.896492, 0.896618, 0.896745, 0.896871,
+    0.896998, 0.897124, 0.897251, 0.897377, 0.897504, 0.897630, 0.897756, 0.897883,
+    0.898009, 0.898135, 0.898261, 0.898388, 0.898514, 0.898640, 0.898766, 0.898892,
+    0.899019, 0.899145, 0.899271, 0.899397, 0.899523, 0.899649, 0.899775, 0.899901,
+    0.900027, 0.900153, 0.900279, 0.900405, 0.900531, 0.900656, 0.900782, 0.900908,
+    0.901034, 0.901160, 0.901285, 0.901411, 0.901537, 0.901663, 0.901788, 0.901914,
+    0.902040, 0.902165, 0.902291, 0.902416, 0.902542, 0.902667, 0.902793, 0.902918,
+    0.903044, 0.903169, 0.903295, 0.903420, 0.903545, 0.903671, 0.903796, 0.903921,
+    0.904047, 0.904172, 0.904297, 0.904422, 0.904548, 0.904673, 0.904798, 0.904923,
+    0.905048, 0.905173, 0.905299, 0.905424, 0.905549, 0.905674, 0.905799, 0.905924,
+    0.906049, 0.906174, 0.906298, 0.906423, 0.906548, 0.906673, 0.906798, 0.906923,
+    0.907048, 0.907172, 0.907297, 0.907422, 0.907547, 0.907671, 0.907796, 0.907921,
+    0.908045, 0.908170, 0.908294, 0.908419, 0.908544, 0.908668, 0.908793, 0.908917,
+    0.909042, 0.909166, 0.909290, 0.909415, 0.909539, 0.909664, 0.909788, 0.909912,
+    0.910037, 0.910161, 0.910285, 0.910409, 0.910534, 0.910658, 0.910782, 0.910906,
+    0.911030, 0.911154, 0.911278, 0.911403, 0.911527, 0.911651, 0.911775, 0.911899,
+    0.912023, 0.912147, 0.912271, 0.912394, 0.912518, 0.912642, 0.912766, 0.912890,
+    0.913014, 0.913138, 0.913261, 0.913385, 0.913509, 0.913633, 0.913756, 0.913880,
+    0.914004, 0.914127, 0.914251, 0.914374, 0.914498, 0.914622, 0.914745, 0.914869,
+    0.914992, 0.915116, 0.915239, 0.915362, 0.915486, 0.915609, 0.915733, 0.915856,
+    0.915979, 0.916103, 0.916226, 0.916349, 0.916473, 0.916596, 0.916719, 0.916842,
+    0.916965, 0.917089, 0.917212, 0.917335, 0.917458, 0.917581, 0.917704, 0.917827,
+    0.917950, 0.918073, 0.918196, 0.918319, 0.918442, 0.918565, 0.918688, 0.918811,
+    0.918934, 0.919056, 0.919179, 0.919302, 0.919425, 0.919548, 0.919670, 0.919793,
+    0.919916, 0.920038, 0.920161, 0.920284, 0.920406, 0.920529, 0.920652, 0.920774,
+    0.920897, 0.921019, 0.921142, 0.921264, 0.921387, 0.921509, 0.921632, 0.921754,
+    0.921876, 0.921999, 0.922121, 0.922243, 0.922366, 0.922488, 0.922610, 0.922733,
+    0.922855, 0.922977, 0.923099, 0.923221, 0.923343, 0.923466, 0.923588, 0.923710,
+    0.923832, 0.923954, 0.924076, 0.924198, 0.924320, 0.924442, 0.924564, 0.924686,
+    0.924808, 0.924930, 0.925052, 0.925174, 0.925295, 0.925417, 0.925539, 0.925661,
+    0.925783, 0.925904, 0.926026, 0.926148, 0.926269, 0.926391, 0.926513, 0.926634,
+    0.926756, 0.926878, 0.926999, 0.927121, 0.927242, 0.927364, 0.927485, 0.927607,
+    0.927728, 0.927850, 0.927971, 0.928093, 0.928214, 0.928335, 0.928457, 0.928578,
+    0.928699, 0.928821, 0.928942, 0.929063, 0.929184, 0.929306, 0.929427, 0.929548,
+    0.929669, 0.929790, 0.929911, 0.930033, 0.930154, 0.930275, 0.930396, 0.930517,
+    0.930638, 0.930759, 0.930880, 0.931001, 0.931122, 0.931243, 0.931363, 0.931484,
+    0.931605, 0.931726, 0.931847, 0.931968, 0.932088, 0.932209, 0.932330, 0.932451,
+    0.932571, 0.932692, 0.932813, 0.932933, 0.933054, 0.933175, 0.933295, 0.933416,
+    0.933536, 0.933657, 0.933777, 0.933898, 0.934018, 0.934139, 0.934259, 0.934380,
+    0.934500, 0.934621, 0.934741, 0.934861, 0.934982, 0.935102, 0.935222, 0.935343,
+    0.935463, 0.935583, 0.935703, 0.935823, 0.935944, 0.936064, 0.936184, 0.936304,
+    0.936424, 0.936544, 0.936664, 0.936784, 0.936904, 0.937025, 0.937145, 0.937264,
+    0.937384, 0.937504, 0.937624, 0.937744, 0.937864, 0.937984, 0.938104, 0.938224,
+    0.938344, 0.938463, 0.938583, 0.938703, 0.938823, 0.938942, 0.939062, 0.939182,
+    0.939301, 0.939421, 0.939541, 0.939660, 0.939780, 0.939899, 0.940019, 0.940139,
+    0.940258, 0.940378, 0.940497, 0.940617, 0.940736, 0.940855, 0.940975, 0.941094,
+    0.941214, 0.941333, 0.941452, 0.941572, 0.941691, 0.941810, 0.941930, 0.942049,
+    0.942168, 0.942287, 0.942406, 0.942526, 0.942645, 0.942764, 0.942883, 0.943002,
+    0.943121, 0.943240, 0.943359, 0.943478, 0.943597, 0.943716, 0.943835, 0.943954,
+    0.944073, 0.944192, 0.944311, 0.944430, 0.944549, 0.944668, 0.944787, 0.944905,
+    0.945024, 0.945143, 0.945262, 0.945381, 0.945499, 0.945618, 0.945737, 0.945855,
+    0.945974, 0.946093, 0.946211, 0.946330, 0.946449, 0.946567, 0.946686, 0.946804,
+    0.946923, 0.947041, 0.947160, 0.947278, 0.947397, 0.947515, 0.947633, 0.947752,
+    0.947870, 0.947989, 0.948107, 0.948225, 0.948343, 0.948462, 0.948580, 0.948698,
+    0.948817, 0.948935, 0.949053, 0.949171, 0.949289, 0.949407, 0.949526, 0.949644,
+    0.949762, 0.949880, 0.949998, 0.950116, 0.950234, 0.950352, 0.950470, 0.950588,
+    0.950706, 0.950824, 0.950942, 0.951060, 0.951177, 0.951295, 0.951413, 0.951531,
+    0.951649, 0.951767, 0.951884, 0.952002, 0.952120, 0.952238, 0.952355, 0.952473,
+    0.952591, 0.952708, 0.952826, 0.952944, 0.953061, 0.953179, 0.953296, 0.953414,
+    0.953531, 0.953649, 0.953766, 0.953884, 0.954001, 0.954119, 0.954236, 0.954354,
+    0.954471, 0.954588, 0.954706, 0.954823, 0.954940, 0.955058, 0.955175, 0.955292,
+    0.955410, 0.955527, 0.955644, 0.955761, 0.955878, 0.955996, 0.956113, 0.956230,
+    0.956347, 0.956464, 0.956581, 0.956698, 0.956815, 0.956932, 0.957049, 0.957166,
+    0.957283, 0.957400, 0.957517, 0.957634, 0.957751, 0.957868, 0.957985, 0.958102,
+    0.958218, 0.958335, 0.958452, 0.958569, 0.958686, 0.958802, 0.958919, 0.959036,
+    0.959153, 0.959269, 0.959386, 0.959503, 0.959619, 0.959736, 0.959852, 0.959969,
+    0.960086, 0.960202, 0.960319, 0.960435, 0.960552, 0.960668, 0.960785, 0.960901,
+    0.961018, 0.961134, 0.961250, 0.961367, 0.961483, 0.961599, 0.961716, 0.961832,
+    0.961948, 0.962065, 0.962181, 0.962297, 0.962413, 0.962530, 0.962646, 0.962762,
+    0.962878, 0.962994, 0.963110, 0.963227, 0.963343, 0.963459, 0.963575, 0.963691,
+    0.963807, 0.963923, 0.964039, 0.964155, 0.964271, 0.964387, 0.964503, 0.964619,
+    0.964735, 0.964850, 0.964966, 0.965082, 0.965198, 0.965314, 0.965430, 0.965545,
+    0.965661, 0.965777, 0.965893, 0.966008, 0.966124, 0.966240, 0.966355, 0.966471,
+    0.966587, 0.966702, 0.966818, 0.966933, 0.967049, 0.967164, 0.967280, 0.967396,
+    0.967511, 0.967627, 0.967742, 0.967857, 0.967973, 0.968088, 0.968204, 0.968319,
+    0.968434, 0.968550, 0.968665, 0.968780, 0.968896, 0.969011, 0.969126, 0.969241,
+    0.969357, 0.969472, 0.969587, 0.969702, 0.969817, 0.969933, 0.970048, 0.970163,
+    0.970278, 0.970393, 0.970508, 0.970623, 0.970738, 0.970853, 0.970968, 0.971083,
+    0.971198, 0.971313, 0.971428, 0.971543, 0.971658, 0.971773, 0.971888, 0.972003,
+    0.972117, 0.972232, 0.972347, 0.972462, 0.972577, 0.972691, 0.972806, 0.972921,
+    0.973036, 0.973150, 0.973265, 0.973380, 0.973494, 0.973609, 0.973723, 0.973838,
+    0.973953, 0.974067, 0.974182, 0.974296, 0.974411, 0.974525, 0.974640, 0.974754,
+    0.974869, 0.974983, 0.975098, 0.975212, 0.975326, 0.975441, 0.975555, 0.975669,
+    0.975784, 0.975898, 0.976012, 0.976127, 0.976241, 0.976355, 0.976469, 0.976583,
+    0.976698, 0.976812, 0.976926, 0.977040, 0.977154, 0.977268, 0.977383, 0.977497,
+    0.977611, 0.977725, 0.977839, 0.977953, 0.978067, 0.978181, 0.978295, 0.978409,
+    0.978523, 0.978637, 0.978750, 0.978864, 0.978978, 0.979092, 0.979206, 0.979320,
+    0.979434, 0.979547, 0.979661, 0.979775, 0.979889, 0.980002, 0.980116, 0.980230,
+    0.980343, 0.980457, 0.980571, 0.980684, 0.980798, 0.980912, 0.981025, 0.981139,
+    0.981252, 0.981366, 0.981479, 0.981593, 0.981706, 0.981820, 0.981933, 0.982047,
+    0.982160, 0.982274, 0.982387, 0.982500, 0.982614, 0.982727, 0.982841, 0.982954,
+    0.983067, 0.983180, 0.983294, 0.983407, 0.983520, 0.983633, 0.983747, 0.983860,
+    0.983973, 0.984086, 0.984199, 0.984312, 0.984426, 0.984539, 0.984652, 0.984765,
+    0.984878, 0.984991, 0.985104, 0.985217, 0.985330, 0.985443, 0.985556, 0.985669,
+    0.985782, 0.985895, 0.986008, 0.986121, 0.986233, 0.986346, 0.986459, 0.986572,
+    0.986685, 0.986797, 0.986910, 0.987023, 0.987136, 0.987249, 0.987361, 0.987474,
+    0.987587, 0.987699, 0.987812, 0.987925, 0.988037, 0.988150, 0.988262, 0.988375,
+    0.988488, 0.988600, 0.988713, 0.988825, 0.988938, 0.989050, 0.989163, 0.989275,
+    0.989387, 0.989500, 0.989612, 0.989725, 0.989837, 0.989949, 0.990062, 0.990174,
+    0.990286, 0.990399, 0.990511, 0.990623, 0.990736, 0.990848, 0.990960, 0.991072,
+    0.991184, 0.991297, 0.991409, 0.991521, 0.991633, 0.991745, 0.991857, 0.991969,
+    0.992081, 0.992193, 0.992305, 0.992418, 0.992530, 0.992642, 0.992754, 0.992865,
+    0.992977, 0.993089, 0.993201, 0.993313, 0.993425, 0.993537, 0.993649, 0.993761,
+    0.993872, 0.993984, 0.994096, 0.994208, 0.994320, 0.994431, 0.994543, 0.994655,
+    0.994767, 0.994878, 0.994990, 0.995102, 0.995213, 0.995325, 0.995437, 0.995548,
+    0.995660, 0.995771, 0.995883, 0.995994, 0.996106, 0.996217, 0.996329, 0.996440,
+    0.996552, 0.996663, 0.996775, 0.996886, 0.996998, 0.997109, 0.997220, 0.997332,
+    0.997443, 0.997554, 0.997666, 0.997777, 0.997888, 0.998000, 0.998111, 0.998222,
+    0.998333, 0.998445, 0.998556, 0.998667, 0.998778, 0.998889, 0.999000, 0.999112,
+    0.999223, 0.999334, 0.999445, 0.999556, 0.999667, 0.999778, 0.999889, 1.000000
+);
+
+// 256 entry color palette
+const vec3 k_palette[256] = vec3[256](
+    vec3(0.5000, 0.9331, 0.0672), vec3(0.5499, 0.9060, 0.0444), vec3(0.5993, 0.8748, 0.0261), vec3(0.6478, 0.8399, 0.0125),
+    vec3(0.6947, 0.8016, 0.0039), vec3(0.7397, 0.7603, 0.0001), vec3(0.7823, 0.7164, 0.0014), vec3(0.8221, 0.6703, 0.0077),
+    vec3(0.8587, 0.6225, 0.0189), vec3(0.8917, 0.5735, 0.0349), vec3(0.9207, 0.5238, 0.0555), vec3(0.9456, 0.4738, 0.0806),
+    vec3(0.9660, 0.4241, 0.1098), vec3(0.9818, 0.3751, 0.1430), vec3(0.9927, 0.3274, 0.1797), vec3(0.9987, 0.2814, 0.2197),
+    vec3(0.9998, 0.2376, 0.2624), vec3(0.9958, 0.1964, 0.3075), vec3(0.9869, 0.1583, 0.3545), vec3(0.9732, 0.1236, 0.4030),
+    vec3(0.9546, 0.0926, 0.4525), vec3(0.9316, 0.0657, 0.5024), vec3(0.9042, 0.0431, 0.5523), vec3(0.8729, 0.0251, 0.6017),
+    vec3(0.8377, 0.0119, 0.6501), vec3(0.7992, 0.0035, 0.6969), vec3(0.7578, 0.0001, 0.7418), vec3(0.7137, 0.0017, 0.7843),
+    vec3(0.6675, 0.0082, 0.8239), vec3(0.6196, 0.0197, 0.8604), vec3(0.5706, 0.0360, 0.8932), vec3(0.5208, 0.0569, 0.9220),
+    vec3(0.4708, 0.0822, 0.9467), vec3(0.4211, 0.1117, 0.9669), vec3(0.3722, 0.1451, 0.9824), vec3(0.3246, 0.1820, 0.9931),
+    vec3(0.2787, 0.2222, 0.9989), vec3(0.2351, 0.2650, 0.9997), vec3(0.1941, 0.3103, 0.9955), vec3(0.1561, 0.3574, 0.9864),
+    vec3(0.1216, 0.4060, 0.9724), vec3(0.0909, 0.4555, 0.9536), vec3(0.0642, 0.5054, 0.9304), vec3(0.0419, 0.5553, 0.9028),
+    vec3(0.0242, 0.6046, 0.8712), vec3(0.0112, 0.6529, 0.8360), vec3(0.0032, 0.6997, 0.7973), vec3(0.0000, 0.7444, 0.7557),
+    vec3(0.0019, 0.7868, 0.7115), vec3(0.0088, 0.8262, 0.6652), vec3(0.0205, 0.8624, 0.6173), vec3(0.0371, 0.8950, 0.5682),
+    vec3(0.0583, 0.9236, 0.5184), vec3(0.0839, 0.9480, 0.4684), vec3(0.1136, 0.9680, 0.4188), vec3(0.1472, 0.9832, 0.3699),
+    vec3(0.1844, 0.9936, 0.3224), vec3(0.2247, 0.9991, 0.2766), vec3(0.2677, 0.9996, 0.2330), vec3(0.3131, 0.9951, 0.1922),
+    vec3(0.3603, 0.9857, 0.1544), vec3(0.4089, 0.9714, 0.1200), vec3(0.4585, 0.9524, 0.0895), vec3(0.5084, 0.9288, 0.0630),
+    vec3(0.5583, 0.9010, 0.0410), vec3(0.6076, 0.8692, 0.0235), vec3(0.6558, 0.8337, 0.0107), vec3(0.7024, 0.7949, 0.0029),
+    vec3(0.7471, 0.7531, 0.0000), vec3(0.7892, 0.7088, 0.0021), vec3(0.8285, 0.6624, 0.0092), vec3(0.8645, 0.6144, 0.0212),
+    vec3(0.8968, 0.5652, 0.0380), vec3(0.9252, 0.5154, 0.0594), vec3(0.9494, 0.4654, 0.0852), vec3(0.9690, 0.4158, 0.1152),
+    vec3(0.9840, 0.3670, 0.1489), vec3(0.9941, 0.3196, 0.1862), vec3(0.9993, 0.2739, 0.2267), vec3(0.9995, 0.2305, 0.2698),
+    vec3(0.9947, 0.1898, 0.3153), vec3(0.9849, 0.1522, 0.3626), vec3(0.9704, 0.1181, 0.4113), vec3(0.9511, 0.0878, 0.4609),
+    vec3(0.9273, 0.0616, 0.5108), vec3(0.8992, 0.0398, 0.5607), vec3(0.8672, 0.0226, 0.6099), vec3(0.8315, 0.0101, 0.6581),
+    vec3(0.7925, 0.0026, 0.7046), vec3(0.7505, 0.0000, 0.7491), vec3(0.7061, 0.0024, 0.7912), vec3(0.6595, 0.0098, 0.8303),
+    vec3(0.6114, 0.0221, 0.8661), vec3(0.5622, 0.0392, 0.8983), vec3(0.5124, 0.0608, 0.9265), vec3(0.4624, 0.0869, 0.9504),
+    vec3(0.4128, 0.1171, 0.9698), vec3(0.3641, 0.1511, 0.9846), vec3(0.3168, 0.1886, 0.9944), vec3(0.2712, 0.2292, 0.9994),
+    vec3(0.2280, 0.2725, 0.9994), vec3(0.1875, 0.3181, 0.9943), vec3(0.1501, 0.3655, 0.9844), vec3(0.1162, 0.4142, 0.9695),
+    vec3(0.0861, 0.4638, 0.9500), vec3(0.0602, 0.5138, 0.9260), vec3(0.0386, 0.5636, 0.8978), vec3(0.0217, 0.6128, 0.8656),
+    vec3(0.0095, 0.6609, 0.8297), vec3(0.0023, 0.7074, 0.7905), vec3(0.0000, 0.7517, 0.7484), vec3(0.0027, 0.7936, 0.7039),
+    vec3(0.0104, 0.8326, 0.6573), vec3(0.0230, 0.8682, 0.6091), vec3(0.0403, 0.9001, 0.5598), vec3(0.0623, 0.9280, 0.5100),
+    vec3(0.0886, 0.9517, 0.4600), vec3(0.1190, 0.9708, 0.4105), vec3(0.1532, 0.9853, 0.3618), vec3(0.1909, 0.9949, 0.3145),
+    vec3(0.2317, 0.9995, 0.2691), vec3(0.2752, 0.9992, 0.2260), vec3(0.3209, 0.9939, 0.1856), vec3(0.3684, 0.9836, 0.1483),
+    vec3(0.4172, 0.9685, 0.1146), vec3(0.4668, 0.9487, 0.0847), vec3(0.5168, 0.9245, 0.0590), vec3(0.5666, 0.8960, 0.0377),
+    vec3(0.6158, 0.8635, 0.0210), vec3(0.6637, 0.8274, 0.0091), vec3(0.7101, 0.7881, 0.0021), vec3(0.7543, 0.7458, 0.0000),
+    vec3(0.7960, 0.7011, 0.0030), vec3(0.8348, 0.6544, 0.0109), vec3(0.8702, 0.6062, 0.0237), vec3(0.9019, 0.5569, 0.0413),
+    vec3(0.9296, 0.5070, 0.0634), vec3(0.9530, 0.4570, 0.0900), vec3(0.9718, 0.4075, 0.1206), vec3(0.9860, 0.3589, 0.1550),
+    vec3(0.9953, 0.3117, 0.1928), vec3(0.9997, 0.2664, 0.2337), vec3(0.9990, 0.2235, 0.2773), vec3(0.9934, 0.1833, 0.3231),
+    vec3(0.9828, 0.1462, 0.3707), vec3(0.9674, 0.1127, 0.4196), vec3(0.9474, 0.0831, 0.4692), vec3(0.9229, 0.0576, 0.5192),
+    vec3(0.8941, 0.0366, 0.5690), vec3(0.8614, 0.0201, 0.6181), vec3(0.8251, 0.0085, 0.6660), vec3(0.7856, 0.0018, 0.7123),
+    vec3(0.7432, 0.0001, 0.7564), vec3(0.6984, 0.0033, 0.7980), vec3(0.6516, 0.0115, 0.8366), vec3(0.6032, 0.0246, 0.8718),
+    vec3(0.5539, 0.0425, 0.9033), vec3(0.5040, 0.0649, 0.9308), vec3(0.4540, 0.0917, 0.9540), vec3(0.4046, 0.1225, 0.9726),
+    vec3(0.3560, 0.1572, 0.9866), vec3(0.3090, 0.1952, 0.9956), vec3(0.2638, 0.2363, 0.9997), vec3(0.2210, 0.2800, 0.9989),
+    vec3(0.1809, 0.3259, 0.9930), vec3(0.1441, 0.3736, 0.9822), vec3(0.1108, 0.4225, 0.9666), vec3(0.0814, 0.4722, 0.9463),
+    vec3(0.0562, 0.5222, 0.9216), vec3(0.0354, 0.5720, 0.8926), vec3(0.0193, 0.6210, 0.8598), vec3(0.0080, 0.6688, 0.8233),
+    vec3(0.0015, 0.7150, 0.7836), vec3(0.0001, 0.7590, 0.7411), vec3(0.0037, 0.8004, 0.6962), vec3(0.0122, 0.8388, 0.6493),
+    vec3(0.0256, 0.8738, 0.6009), vec3(0.0437, 0.9051, 0.5515), vec3(0.0664, 0.9323, 0.5016), vec3(0.0934, 0.9552, 0.4516),
+    vec3(0.1245, 0.9736, 0.4022), vec3(0.1593, 0.9872, 0.3537), vec3(0.1976, 0.9960, 0.3067), vec3(0.2388, 0.9998, 0.2617),
+    vec3(0.2827, 0.9986, 0.2190), vec3(0.3288, 0.9925, 0.1791), vec3(0.3765, 0.9814, 0.1424), vec3(0.4255, 0.9655, 0.1093),
+    vec3(0.4752, 0.9450, 0.0801), vec3(0.5252, 0.9200, 0.0551), vec3(0.5749, 0.8908, 0.0346), vec3(0.6239, 0.8577, 0.0186),
+    vec3(0.6717, 0.8210, 0.0075), vec3(0.7177, 0.7811, 0.0014), vec3(0.7615, 0.7385, 0.0002), vec3(0.8028, 0.6934, 0.0040),
+    vec3(0.8410, 0.6464, 0.0127), vec3(0.8758, 0.5979, 0.0263), vec3(0.9068, 0.5485, 0.0447), vec3(0.9338, 0.4986, 0.0676),
+    vec3(0.9565, 0.4487, 0.0948), vec3(0.9746, 0.3993, 0.1261), vec3(0.9879, 0.3509, 0.1611), vec3(0.9964, 0.3040, 0.1995),
+    vec3(0.9999, 0.2590, 0.2409), vec3(0.9984, 0.2165, 0.2849), vec3(0.9920, 0.1768, 0.3310), vec3(0.9806, 0.1403, 0.3788),
+    vec3(0.9644, 0.1075, 0.4279), vec3(0.9436, 0.0785, 0.4776), vec3(0.9183, 0.0538, 0.5276), vec3(0.8889, 0.0335, 0.5773),
+    vec3(0.8556, 0.0178, 0.6262), vec3(0.8187, 0.0070, 0.6739), vec3(0.7787, 0.0012, 0.7198), vec3(0.7358, 0.0003, 0.7636),
+    vec3(0.6906, 0.0044, 0.8047), vec3(0.6435, 0.0134, 0.8427), vec3(0.5950, 0.0273, 0.8774), vec3(0.5455, 0.0459, 0.9082),
+    vec3(0.4956, 0.0691, 0.9350), vec3(0.4457, 0.0966, 0.9574), vec3(0.3963, 0.1281, 0.9753), vec3(0.3480, 0.1633, 0.9884),
+    vec3(0.3012, 0.2019, 0.9967), vec3(0.2564, 0.2435, 0.9999), vec3(0.2140, 0.2876, 0.9982), vec3(0.1745, 0.3338, 0.9915),
+    vec3(0.1383, 0.3818, 0.9799), vec3(0.1056, 0.4309, 0.9635), vec3(0.0769, 0.4806, 0.9425), vec3(0.0524, 0.5306, 0.9170),
+    vec3(0.0324, 0.5803, 0.8874), vec3(0.0171, 0.6291, 0.8539), vec3(0.0065, 0.6767, 0.8169), vec3(0.0010, 0.7225, 0.7767),
+    vec3(0.0004, 0.7661, 0.7337), vec3(0.0048, 0.8071, 0.6884), vec3(0.0141, 0.8449, 0.6412), vec3(0.0283, 0.8793, 0.5926),
+    vec3(0.0472, 0.9100, 0.5431), vec3(0.0706, 0.9365, 0.4932), vec3(0.0984, 0.9587, 0.4433), vec3(0.1301, 0.9762, 0.3940),
+    vec3(0.1655, 0.9891, 0.3457), vec3(0.2043, 0.9970, 0.2990), vec3(0.2461, 1.0000, 0.2543), vec3(0.2903, 0.9980, 0.2121),
+    vec3(0.3367, 0.9910, 0.1727), vec3(0.3847, 0.9791, 0.1366), vec3(0.4338, 0.9624, 0.1041), vec3(0.4836, 0.9411, 0.0756),
+    vec3(0.5336, 0.9153, 0.0513), vec3(0.5832, 0.8855, 0.0315), vec3(0.6320, 0.8518, 0.0164), vec3(0.6795, 0.8145, 0.0062)
+);
+
+void main()
+{
+    vec4 color = f_color * texture(tex_image, f_uv);
+    ivec3 idx = ivec3(clamp(color.rgb, 0.0, 1.0) * 4095.0);
+    vec3 graded = vec3(k_curve[idx.r], k_curve[idx.g], k_curve[idx.b]);
+    graded *= k_palette[int(color.a * 255.0)];
+    frag_color = vec4(graded, color.a);
+}
@@ -0,0 +1,6939 @@
+#version 450
+
+precision highp float;
+
+// node graph evaluator with every node expanded inline, like the output of a material
+// editor: one switch per node in sequence, so the CFG has thousands of blocks and a
+// very deep dominator tree
+
+layout (location = TEXCOORD0) in vec2 f_uv;
+layout (location = COLOR0)    in vec4 f_color;
+
+layout (location = SV_Target0) out vec4 frag_color;
+
+layout (binding = 0, std140) uniform graph_params {
+    vec4 node_params[64];
+    ivec4 node_ops[64];
+};
+
+layout (binding = 1) uniform sampler2D tex_input;
+
+void main()
+{
+    vec4 acc = f_color;
+    vec4 tmp = texture(tex_input, f_uv);
+    float mask = 0.0;
+    // node 0
+    switch (node_ops[0][0]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[0];
+        break;
+    case 1:
+        if (acc.x > node_params[0].w) {
+            acc = mix(acc, tmp, node_params[0].x);
+        } else {
+            acc = max(acc, node_params[0]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[0], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 1
+    switch (node_ops[1][1]) {
+    case 0:
+        acc = acc * node_params[1] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[1].w) {
+            acc = acc * node_params[3] + tmp;
+        } else {
+            mask += dot(acc, node_params[5]);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[7] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 2
+    switch (node_ops[2][2]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[2];
+        break;
+    case 1:
+        if (acc.x > node_params[2].w) {
+            mask += dot(acc, node_params[6]);
+        } else {
+            acc = acc * node_params[10] + tmp;
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[14]);
+        break;
+    default:
+        break;
+    }
+    // node 3
+    switch (node_ops[3][3]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[3].x);
+        break;
+    case 1:
+        if (acc.x > node_params[3].w) {
+            acc = acc * node_params[9] + tmp;
+        } else {
+            acc = acc * node_params[15] + tmp;
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[21]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 4
+    switch (node_ops[4][0]) {
+    case 0:
+        acc = max(acc, node_params[4]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[4].w) {
+            acc = acc * node_params[12] + tmp;
+        } else {
+            acc = mix(acc, tmp, node_params[20].x);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[28] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 5
+    switch (node_ops[5][1]) {
+    case 0:
+        mask += dot(acc, node_params[5]);
+        break;
+    case 1:
+        if (acc.x > node_params[5].w) {
+            acc = max(acc, node_params[15]) - tmp * 0.5;
+        } else {
+            acc = acc * node_params[25] + tmp;
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[35]);
+        break;
+    default:
+        break;
+    }
+    // node 6
+    switch (node_ops[6][2]) {
+    case 0:
+        acc = acc * node_params[6] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[6].w) {
+            acc = mix(acc, tmp, node_params[18].x);
+        } else {
+            acc = clamp(acc + node_params[30], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[42], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 7
+    switch (node_ops[7][3]) {
+    case 0:
+        mask += dot(acc, node_params[7]);
+        break;
+    case 1:
+        if (acc.x > node_params[7].w) {
+            acc = acc * node_params[21] + tmp;
+        } else {
+            mask += dot(acc, node_params[35]);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[49]);
+        break;
+    default:
+        break;
+    }
+    // node 8
+    switch (node_ops[8][0]) {
+    case 0:
+        acc = max(acc, node_params[8]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[8].w) {
+            acc = acc * node_params[24] + tmp;
+        } else {
+            acc = mix(acc, tmp, node_params[40].x);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[56] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 9
+    switch (node_ops[9][1]) {
+    case 0:
+        mask += dot(acc, node_params[9]);
+        break;
+    case 1:
+        if (acc.x > node_params[9].w) {
+            acc = mix(acc, tmp, node_params[27].x);
+        } else {
+            tmp = tmp.yzwx * node_params[45];
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[63]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 10
+    switch (node_ops[10][2]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[10].x);
+        break;
+    case 1:
+        if (acc.x > node_params[10].w) {
+            mask += dot(acc, node_params[30]);
+        } else {
+            acc = acc * node_params[50] + tmp;
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[6]);
+        break;
+    default:
+        break;
+    }
+    // node 11
+    switch (node_ops[11][3]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[11];
+        break;
+    case 1:
+        if (acc.x > node_params[11].w) {
+            mask += dot(acc, node_params[33]);
+        } else {
+            acc = clamp(acc + node_params[55], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[13].x);
+        break;
+    default:
+        break;
+    }
+    // node 12
+    switch (node_ops[12][0]) {
+    case 0:
+        acc = acc * node_params[12] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[12].w) {
+            mask += dot(acc, node_params[36]);
+        } else {
+            mask += dot(acc, node_params[60]);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[20], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 13
+    switch (node_ops[13][1]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[13].x);
+        break;
+    case 1:
+        if (acc.x > node_params[13].w) {
+            tmp = tmp.yzwx * node_params[39];
+        } else {
+            acc = acc * node_params[1] + tmp;
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[27]);
+        break;
+    default:
+        break;
+    }
+    // node 14
+    switch (node_ops[14][2]) {
+    case 0:
+        acc = clamp(acc + node_params[14], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[14].w) {
+            acc = acc * node_params[42] + tmp;
+        } else {
+            mask += dot(acc, node_params[6]);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[34] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 15
+    switch (node_ops[15][3]) {
+    case 0:
+        mask += dot(acc, node_params[15]);
+        break;
+    case 1:
+        if (acc.x > node_params[15].w) {
+            acc = mix(acc, tmp, node_params[45].x);
+        } else {
+            acc = max(acc, node_params[11]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[41], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 16
+    switch (node_ops[16][0]) {
+    case 0:
+        mask += dot(acc, node_params[16]);
+        break;
+    case 1:
+        if (acc.x > node_params[16].w) {
+            acc = max(acc, node_params[48]) - tmp * 0.5;
+        } else {
+            tmp = tmp.yzwx * node_params[16];
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[48]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 17
+    switch (node_ops[17][1]) {
+    case 0:
+        mask += dot(acc, node_params[17]);
+        break;
+    case 1:
+        if (acc.x > node_params[17].w) {
+            acc = max(acc, node_params[51]) - tmp * 0.5;
+        } else {
+            tmp = tmp.yzwx * node_params[21];
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[55];
+        break;
+    default:
+        break;
+    }
+    // node 18
+    switch (node_ops[18][2]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[18].x);
+        break;
+    case 1:
+        if (acc.x > node_params[18].w) {
+            acc = mix(acc, tmp, node_params[54].x);
+        } else {
+            acc = clamp(acc + node_params[26], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[62].x);
+        break;
+    default:
+        break;
+    }
+    // node 19
+    switch (node_ops[19][3]) {
+    case 0:
+        acc = acc * node_params[19] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[19].w) {
+            mask += dot(acc, node_params[57]);
+        } else {
+            tmp = tmp.yzwx * node_params[31];
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[5]);
+        break;
+    default:
+        break;
+    }
+    // node 20
+    switch (node_ops[20][0]) {
+    case 0:
+        acc = max(acc, node_params[20]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[20].w) {
+            tmp = tmp.yzwx * node_params[60];
+        } else {
+            acc = clamp(acc + node_params[36], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[12]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 21
+    switch (node_ops[21][1]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[21];
+        break;
+    case 1:
+        if (acc.x > node_params[21].w) {
+            mask += dot(acc, node_params[63]);
+        } else {
+            acc = acc * node_params[41] + tmp;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[19] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 22
+    switch (node_ops[22][2]) {
+    case 0:
+        mask += dot(acc, node_params[22]);
+        break;
+    case 1:
+        if (acc.x > node_params[22].w) {
+            acc = max(acc, node_params[2]) - tmp * 0.5;
+        } else {
+            acc = mix(acc, tmp, node_params[46].x);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[26];
+        break;
+    default:
+        break;
+    }
+    // node 23
+    switch (node_ops[23][3]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[23].x);
+        break;
+    case 1:
+        if (acc.x > node_params[23].w) {
+            acc = max(acc, node_params[5]) - tmp * 0.5;
+        } else {
+            acc = max(acc, node_params[51]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[33] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 24
+    switch (node_ops[24][0]) {
+    case 0:
+        acc = clamp(acc + node_params[24], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[24].w) {
+            acc = acc * node_params[8] + tmp;
+        } else {
+            mask += dot(acc, node_params[56]);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[40]);
+        break;
+    default:
+        break;
+    }
+    // node 25
+    switch (node_ops[25][1]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[25];
+        break;
+    case 1:
+        if (acc.x > node_params[25].w) {
+            tmp = tmp.yzwx * node_params[11];
+        } else {
+            acc = clamp(acc + node_params[61], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[47];
+        break;
+    default:
+        break;
+    }
+    // node 26
+    switch (node_ops[26][2]) {
+    case 0:
+        mask += dot(acc, node_params[26]);
+        break;
+    case 1:
+        if (acc.x > node_params[26].w) {
+            acc = max(acc, node_params[14]) - tmp * 0.5;
+        } else {
+            mask += dot(acc, node_params[2]);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[54]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 27
+    switch (node_ops[27][3]) {
+    case 0:
+        acc = acc * node_params[27] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[27].w) {
+            acc = acc * node_params[17] + tmp;
+        } else {
+            tmp = tmp.yzwx * node_params[7];
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[61]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 28
+    switch (node_ops[28][0]) {
+    case 0:
+        acc = clamp(acc + node_params[28], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[28].w) {
+            acc = clamp(acc + node_params[20], 0.0, 1.0);
+        } else {
+            acc = acc * node_params[12] + tmp;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[4] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 29
+    switch (node_ops[29][1]) {
+    case 0:
+        acc = clamp(acc + node_params[29], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[29].w) {
+            acc = clamp(acc + node_params[23], 0.0, 1.0);
+        } else {
+            tmp = tmp.yzwx * node_params[17];
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[11], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 30
+    switch (node_ops[30][2]) {
+    case 0:
+        mask += dot(acc, node_params[30]);
+        break;
+    case 1:
+        if (acc.x > node_params[30].w) {
+            acc = clamp(acc + node_params[26], 0.0, 1.0);
+        } else {
+            acc = max(acc, node_params[22]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[18];
+        break;
+    default:
+        break;
+    }
+    // node 31
+    switch (node_ops[31][3]) {
+    case 0:
+        acc = clamp(acc + node_params[31], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[31].w) {
+            acc = max(acc, node_params[29]) - tmp * 0.5;
+        } else {
+            acc = clamp(acc + node_params[27], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[25];
+        break;
+    default:
+        break;
+    }
+    // node 32
+    switch (node_ops[32][0]) {
+    case 0:
+        acc = acc * node_params[32] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[32].w) {
+            acc = max(acc, node_params[32]) - tmp * 0.5;
+        } else {
+            tmp = tmp.yzwx * node_params[32];
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[32].x);
+        break;
+    default:
+        break;
+    }
+    // node 33
+    switch (node_ops[33][1]) {
+    case 0:
+        mask += dot(acc, node_params[33]);
+        break;
+    case 1:
+        if (acc.x > node_params[33].w) {
+            acc = acc * node_params[35] + tmp;
+        } else {
+            acc = max(acc, node_params[37]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[39] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 34
+    switch (node_ops[34][2]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[34].x);
+        break;
+    case 1:
+        if (acc.x > node_params[34].w) {
+            tmp = tmp.yzwx * node_params[38];
+        } else {
+            acc = mix(acc, tmp, node_params[42].x);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[46], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 35
+    switch (node_ops[35][3]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[35].x);
+        break;
+    case 1:
+        if (acc.x > node_params[35].w) {
+            acc = max(acc, node_params[41]) - tmp * 0.5;
+        } else {
+            acc = max(acc, node_params[47]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[53]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 36
+    switch (node_ops[36][0]) {
+    case 0:
+        acc = acc * node_params[36] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[36].w) {
+            acc = mix(acc, tmp, node_params[44].x);
+        } else {
+            acc = max(acc, node_params[52]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[60]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 37
+    switch (node_ops[37][1]) {
+    case 0:
+        mask += dot(acc, node_params[37]);
+        break;
+    case 1:
+        if (acc.x > node_params[37].w) {
+            tmp = tmp.yzwx * node_params[47];
+        } else {
+            acc = mix(acc, tmp, node_params[57].x);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[3]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 38
+    switch (node_ops[38][2]) {
+    case 0:
+        mask += dot(acc, node_params[38]);
+        break;
+    case 1:
+        if (acc.x > node_params[38].w) {
+            tmp = tmp.yzwx * node_params[50];
+        } else {
+            acc = clamp(acc + node_params[62], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[10]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 39
+    switch (node_ops[39][3]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[39];
+        break;
+    case 1:
+        if (acc.x > node_params[39].w) {
+            acc = clamp(acc + node_params[53], 0.0, 1.0);
+        } else {
+            acc = max(acc, node_params[3]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[17].x);
+        break;
+    default:
+        break;
+    }
+    // node 40
+    switch (node_ops[40][0]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[40].x);
+        break;
+    case 1:
+        if (acc.x > node_params[40].w) {
+            acc = acc * node_params[56] + tmp;
+        } else {
+            acc = mix(acc, tmp, node_params[8].x);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[24].x);
+        break;
+    default:
+        break;
+    }
+    // node 41
+    switch (node_ops[41][1]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[41].x);
+        break;
+    case 1:
+        if (acc.x > node_params[41].w) {
+            acc = clamp(acc + node_params[59], 0.0, 1.0);
+        } else {
+            acc = mix(acc, tmp, node_params[13].x);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[31] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 42
+    switch (node_ops[42][2]) {
+    case 0:
+        acc = max(acc, node_params[42]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[42].w) {
+            mask += dot(acc, node_params[62]);
+        } else {
+            acc = mix(acc, tmp, node_params[18].x);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[38];
+        break;
+    default:
+        break;
+    }
+    // node 43
+    switch (node_ops[43][3]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[43];
+        break;
+    case 1:
+        if (acc.x > node_params[43].w) {
+            acc = acc * node_params[1] + tmp;
+        } else {
+            acc = mix(acc, tmp, node_params[23].x);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[45]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 44
+    switch (node_ops[44][0]) {
+    case 0:
+        mask += dot(acc, node_params[44]);
+        break;
+    case 1:
+        if (acc.x > node_params[44].w) {
+            tmp = tmp.yzwx * node_params[4];
+        } else {
+            mask += dot(acc, node_params[28]);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[52]);
+        break;
+    default:
+        break;
+    }
+    // node 45
+    switch (node_ops[45][1]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[45];
+        break;
+    case 1:
+        if (acc.x > node_params[45].w) {
+            acc = mix(acc, tmp, node_params[7].x);
+        } else {
+            acc = clamp(acc + node_params[33], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[59]);
+        break;
+    default:
+        break;
+    }
+    // node 46
+    switch (node_ops[46][2]) {
+    case 0:
+        mask += dot(acc, node_params[46]);
+        break;
+    case 1:
+        if (acc.x > node_params[46].w) {
+            acc = clamp(acc + node_params[10], 0.0, 1.0);
+        } else {
+            acc = clamp(acc + node_params[38], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[2], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 47
+    switch (node_ops[47][3]) {
+    case 0:
+        acc = acc * node_params[47] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[47].w) {
+            acc = max(acc, node_params[13]) - tmp * 0.5;
+        } else {
+            acc = clamp(acc + node_params[43], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[9]);
+        break;
+    default:
+        break;
+    }
+    // node 48
+    switch (node_ops[48][0]) {
+    case 0:
+        acc = max(acc, node_params[48]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[48].w) {
+            acc = max(acc, node_params[16]) - tmp * 0.5;
+        } else {
+            acc = max(acc, node_params[48]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[16]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 49
+    switch (node_ops[49][1]) {
+    case 0:
+        acc = acc * node_params[49] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[49].w) {
+            acc = max(acc, node_params[19]) - tmp * 0.5;
+        } else {
+            acc = clamp(acc + node_params[53], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[23]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 50
+    switch (node_ops[50][2]) {
+    case 0:
+        acc = acc * node_params[50] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[50].w) {
+            acc = mix(acc, tmp, node_params[22].x);
+        } else {
+            acc = acc * node_params[58] + tmp;
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[30].x);
+        break;
+    default:
+        break;
+    }
+    // node 51
+    switch (node_ops[51][3]) {
+    case 0:
+        acc = max(acc, node_params[51]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[51].w) {
+            acc = mix(acc, tmp, node_params[25].x);
+        } else {
+            acc = acc * node_params[63] + tmp;
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[37];
+        break;
+    default:
+        break;
+    }
+    // node 52
+    switch (node_ops[52][0]) {
+    case 0:
+        mask += dot(acc, node_params[52]);
+        break;
+    case 1:
+        if (acc.x > node_params[52].w) {
+            acc = acc * node_params[28] + tmp;
+        } else {
+            acc = acc * node_params[4] + tmp;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[44] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 53
+    switch (node_ops[53][1]) {
+    case 0:
+        mask += dot(acc, node_params[53]);
+        break;
+    case 1:
+        if (acc.x > node_params[53].w) {
+            acc = mix(acc, tmp, node_params[31].x);
+        } else {
+            mask += dot(acc, node_params[9]);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[51] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 54
+    switch (node_ops[54][2]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[54];
+        break;
+    case 1:
+        if (acc.x > node_params[54].w) {
+            mask += dot(acc, node_params[34]);
+        } else {
+            acc = acc * node_params[14] + tmp;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[58] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 55
+    switch (node_ops[55][3]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[55].x);
+        break;
+    case 1:
+        if (acc.x > node_params[55].w) {
+            mask += dot(acc, node_params[37]);
+        } else {
+            acc = max(acc, node_params[19]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[1].x);
+        break;
+    default:
+        break;
+    }
+    // node 56
+    switch (node_ops[56][0]) {
+    case 0:
+        acc = clamp(acc + node_params[56], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[56].w) {
+            tmp = tmp.yzwx * node_params[40];
+        } else {
+            tmp = tmp.yzwx * node_params[24];
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[8]);
+        break;
+    default:
+        break;
+    }
+    // node 57
+    switch (node_ops[57][1]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[57];
+        break;
+    case 1:
+        if (acc.x > node_params[57].w) {
+            acc = max(acc, node_params[43]) - tmp * 0.5;
+        } else {
+            acc = acc * node_params[29] + tmp;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[15] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 58
+    switch (node_ops[58][2]) {
+    case 0:
+        acc = max(acc, node_params[58]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[58].w) {
+            acc = max(acc, node_params[46]) - tmp * 0.5;
+        } else {
+            acc = max(acc, node_params[34]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[22]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 59
+    switch (node_ops[59][3]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[59];
+        break;
+    case 1:
+        if (acc.x > node_params[59].w) {
+            acc = acc * node_params[49] + tmp;
+        } else {
+            acc = mix(acc, tmp, node_params[39].x);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[29] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 60
+    switch (node_ops[60][0]) {
+    case 0:
+        acc = clamp(acc + node_params[60], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[60].w) {
+            tmp = tmp.yzwx * node_params[52];
+        } else {
+            acc = clamp(acc + node_params[44], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[36];
+        break;
+    default:
+        break;
+    }
+    // node 61
+    switch (node_ops[61][1]) {
+    case 0:
+        acc = max(acc, node_params[61]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[61].w) {
+            acc = clamp(acc + node_params[55], 0.0, 1.0);
+        } else {
+            acc = mix(acc, tmp, node_params[49].x);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[43]);
+        break;
+    default:
+        break;
+    }
+    // node 62
+    switch (node_ops[62][2]) {
+    case 0:
+        acc = acc * node_params[62] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[62].w) {
+            acc = mix(acc, tmp, node_params[58].x);
+        } else {
+            mask += dot(acc, node_params[54]);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[50];
+        break;
+    default:
+        break;
+    }
+    // node 63
+    switch (node_ops[63][3]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[63].x);
+        break;
+    case 1:
+        if (acc.x > node_params[63].w) {
+            acc = clamp(acc + node_params[61], 0.0, 1.0);
+        } else {
+            mask += dot(acc, node_params[59]);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[57] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 64
+    switch (node_ops[0][0]) {
+    case 0:
+        mask += dot(acc, node_params[0]);
+        break;
+    case 1:
+        if (acc.x > node_params[0].w) {
+            tmp = tmp.yzwx * node_params[0];
+        } else {
+            acc = clamp(acc + node_params[0], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[0] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 65
+    switch (node_ops[1][1]) {
+    case 0:
+        acc = clamp(acc + node_params[1], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[1].w) {
+            tmp = tmp.yzwx * node_params[3];
+        } else {
+            mask += dot(acc, node_params[5]);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[7];
+        break;
+    default:
+        break;
+    }
+    // node 66
+    switch (node_ops[2][2]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[2].x);
+        break;
+    case 1:
+        if (acc.x > node_params[2].w) {
+            tmp = tmp.yzwx * node_params[6];
+        } else {
+            acc = mix(acc, tmp, node_params[10].x);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[14]);
+        break;
+    default:
+        break;
+    }
+    // node 67
+    switch (node_ops[3][3]) {
+    case 0:
+        mask += dot(acc, node_params[3]);
+        break;
+    case 1:
+        if (acc.x > node_params[3].w) {
+            mask += dot(acc, node_params[9]);
+        } else {
+            tmp = tmp.yzwx * node_params[15];
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[21], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 68
+    switch (node_ops[4][0]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[4].x);
+        break;
+    case 1:
+        if (acc.x > node_params[4].w) {
+            mask += dot(acc, node_params[12]);
+        } else {
+            acc = mix(acc, tmp, node_params[20].x);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[28].x);
+        break;
+    default:
+        break;
+    }
+    // node 69
+    switch (node_ops[5][1]) {
+    case 0:
+        acc = max(acc, node_params[5]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[5].w) {
+            acc = clamp(acc + node_params[15], 0.0, 1.0);
+        } else {
+            acc = mix(acc, tmp, node_params[25].x);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[35].x);
+        break;
+    default:
+        break;
+    }
+    // node 70
+    switch (node_ops[6][2]) {
+    case 0:
+        mask += dot(acc, node_params[6]);
+        break;
+    case 1:
+        if (acc.x > node_params[6].w) {
+            acc = max(acc, node_params[18]) - tmp * 0.5;
+        } else {
+            tmp = tmp.yzwx * node_params[30];
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[42], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 71
+    switch (node_ops[7][3]) {
+    case 0:
+        acc = acc * node_params[7] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[7].w) {
+            acc = acc * node_params[21] + tmp;
+        } else {
+            tmp = tmp.yzwx * node_params[35];
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[49]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 72
+    switch (node_ops[8][0]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[8];
+        break;
+    case 1:
+        if (acc.x > node_params[8].w) {
+            acc = mix(acc, tmp, node_params[24].x);
+        } else {
+            acc = clamp(acc + node_params[40], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[56]);
+        break;
+    default:
+        break;
+    }
+    // node 73
+    switch (node_ops[9][1]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[9];
+        break;
+    case 1:
+        if (acc.x > node_params[9].w) {
+            acc = max(acc, node_params[27]) - tmp * 0.5;
+        } else {
+            acc = clamp(acc + node_params[45], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[63];
+        break;
+    default:
+        break;
+    }
+    // node 74
+    switch (node_ops[10][2]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[10];
+        break;
+    case 1:
+        if (acc.x > node_params[10].w) {
+            acc = acc * node_params[30] + tmp;
+        } else {
+            acc = mix(acc, tmp, node_params[50].x);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[6] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 75
+    switch (node_ops[11][3]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[11].x);
+        break;
+    case 1:
+        if (acc.x > node_params[11].w) {
+            acc = max(acc, node_params[33]) - tmp * 0.5;
+        } else {
+            acc = mix(acc, tmp, node_params[55].x);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[13];
+        break;
+    default:
+        break;
+    }
+    // node 76
+    switch (node_ops[12][0]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[12].x);
+        break;
+    case 1:
+        if (acc.x > node_params[12].w) {
+            acc = max(acc, node_params[36]) - tmp * 0.5;
+        } else {
+            mask += dot(acc, node_params[60]);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[20]);
+        break;
+    default:
+        break;
+    }
+    // node 77
+    switch (node_ops[13][1]) {
+    case 0:
+        acc = acc * node_params[13] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[13].w) {
+            acc = max(acc, node_params[39]) - tmp * 0.5;
+        } else {
+            acc = clamp(acc + node_params[1], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[27];
+        break;
+    default:
+        break;
+    }
+    // node 78
+    switch (node_ops[14][2]) {
+    case 0:
+        acc = clamp(acc + node_params[14], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[14].w) {
+            acc = acc * node_params[42] + tmp;
+        } else {
+            acc = clamp(acc + node_params[6], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[34] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 79
+    switch (node_ops[15][3]) {
+    case 0:
+        acc = max(acc, node_params[15]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[15].w) {
+            acc = clamp(acc + node_params[45], 0.0, 1.0);
+        } else {
+            acc = mix(acc, tmp, node_params[11].x);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[41]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 80
+    switch (node_ops[16][0]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[16].x);
+        break;
+    case 1:
+        if (acc.x > node_params[16].w) {
+            acc = max(acc, node_params[48]) - tmp * 0.5;
+        } else {
+            acc = clamp(acc + node_params[16], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[48];
+        break;
+    default:
+        break;
+    }
+    // node 81
+    switch (node_ops[17][1]) {
+    case 0:
+        acc = acc * node_params[17] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[17].w) {
+            acc = clamp(acc + node_params[51], 0.0, 1.0);
+        } else {
+            acc = max(acc, node_params[21]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[55]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 82
+    switch (node_ops[18][2]) {
+    case 0:
+        acc = max(acc, node_params[18]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[18].w) {
+            acc = clamp(acc + node_params[54], 0.0, 1.0);
+        } else {
+            acc = acc * node_params[26] + tmp;
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[62], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 83
+    switch (node_ops[19][3]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[19].x);
+        break;
+    case 1:
+        if (acc.x > node_params[19].w) {
+            acc = mix(acc, tmp, node_params[57].x);
+        } else {
+            acc = mix(acc, tmp, node_params[31].x);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[5] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 84
+    switch (node_ops[20][0]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[20].x);
+        break;
+    case 1:
+        if (acc.x > node_params[20].w) {
+            mask += dot(acc, node_params[60]);
+        } else {
+            acc = max(acc, node_params[36]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[12], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 85
+    switch (node_ops[21][1]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[21].x);
+        break;
+    case 1:
+        if (acc.x > node_params[21].w) {
+            mask += dot(acc, node_params[63]);
+        } else {
+            mask += dot(acc, node_params[41]);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[19]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 86
+    switch (node_ops[22][2]) {
+    case 0:
+        acc = clamp(acc + node_params[22], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[22].w) {
+            tmp = tmp.yzwx * node_params[2];
+        } else {
+            acc = mix(acc, tmp, node_params[46].x);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[26]);
+        break;
+    default:
+        break;
+    }
+    // node 87
+    switch (node_ops[23][3]) {
+    case 0:
+        mask += dot(acc, node_params[23]);
+        break;
+    case 1:
+        if (acc.x > node_params[23].w) {
+            acc = mix(acc, tmp, node_params[5].x);
+        } else {
+            acc = acc * node_params[51] + tmp;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[33] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 88
+    switch (node_ops[24][0]) {
+    case 0:
+        acc = clamp(acc + node_params[24], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[24].w) {
+            acc = clamp(acc + node_params[8], 0.0, 1.0);
+        } else {
+            acc = acc * node_params[56] + tmp;
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[40]);
+        break;
+    default:
+        break;
+    }
+    // node 89
+    switch (node_ops[25][1]) {
+    case 0:
+        acc = clamp(acc + node_params[25], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[25].w) {
+            acc = mix(acc, tmp, node_params[11].x);
+        } else {
+            acc = max(acc, node_params[61]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[47].x);
+        break;
+    default:
+        break;
+    }
+    // node 90
+    switch (node_ops[26][2]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[26].x);
+        break;
+    case 1:
+        if (acc.x > node_params[26].w) {
+            acc = acc * node_params[14] + tmp;
+        } else {
+            tmp = tmp.yzwx * node_params[2];
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[54].x);
+        break;
+    default:
+        break;
+    }
+    // node 91
+    switch (node_ops[27][3]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[27];
+        break;
+    case 1:
+        if (acc.x > node_params[27].w) {
+            mask += dot(acc, node_params[17]);
+        } else {
+            acc = mix(acc, tmp, node_params[7].x);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[61]);
+        break;
+    default:
+        break;
+    }
+    // node 92
+    switch (node_ops[28][0]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[28];
+        break;
+    case 1:
+        if (acc.x > node_params[28].w) {
+            tmp = tmp.yzwx * node_params[20];
+        } else {
+            mask += dot(acc, node_params[12]);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[4]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 93
+    switch (node_ops[29][1]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[29].x);
+        break;
+    case 1:
+        if (acc.x > node_params[29].w) {
+            acc = acc * node_params[23] + tmp;
+        } else {
+            acc = clamp(acc + node_params[17], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[11];
+        break;
+    default:
+        break;
+    }
+    // node 94
+    switch (node_ops[30][2]) {
+    case 0:
+        acc = max(acc, node_params[30]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[30].w) {
+            acc = clamp(acc + node_params[26], 0.0, 1.0);
+        } else {
+            mask += dot(acc, node_params[22]);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[18]);
+        break;
+    default:
+        break;
+    }
+    // node 95
+    switch (node_ops[31][3]) {
+    case 0:
+        acc = max(acc, node_params[31]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[31].w) {
+            mask += dot(acc, node_params[29]);
+        } else {
+            acc = mix(acc, tmp, node_params[27].x);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[25]);
+        break;
+    default:
+        break;
+    }
+    // node 96
+    switch (node_ops[32][0]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[32].x);
+        break;
+    case 1:
+        if (acc.x > node_params[32].w) {
+            mask += dot(acc, node_params[32]);
+        } else {
+            mask += dot(acc, node_params[32]);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[32] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 97
+    switch (node_ops[33][1]) {
+    case 0:
+        acc = max(acc, node_params[33]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[33].w) {
+            acc = mix(acc, tmp, node_params[35].x);
+        } else {
+            mask += dot(acc, node_params[37]);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[39] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 98
+    switch (node_ops[34][2]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[34].x);
+        break;
+    case 1:
+        if (acc.x > node_params[34].w) {
+            acc = mix(acc, tmp, node_params[38].x);
+        } else {
+            acc = mix(acc, tmp, node_params[42].x);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[46]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 99
+    switch (node_ops[35][3]) {
+    case 0:
+        mask += dot(acc, node_params[35]);
+        break;
+    case 1:
+        if (acc.x > node_params[35].w) {
+            acc = clamp(acc + node_params[41], 0.0, 1.0);
+        } else {
+            acc = acc * node_params[47] + tmp;
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[53]);
+        break;
+    default:
+        break;
+    }
+    // node 100
+    switch (node_ops[36][0]) {
+    case 0:
+        acc = acc * node_params[36] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[36].w) {
+            tmp = tmp.yzwx * node_params[44];
+        } else {
+            acc = clamp(acc + node_params[52], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[60]);
+        break;
+    default:
+        break;
+    }
+    // node 101
+    switch (node_ops[37][1]) {
+    case 0:
+        mask += dot(acc, node_params[37]);
+        break;
+    case 1:
+        if (acc.x > node_params[37].w) {
+            mask += dot(acc, node_params[47]);
+        } else {
+            acc = max(acc, node_params[57]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[3] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 102
+    switch (node_ops[38][2]) {
+    case 0:
+        mask += dot(acc, node_params[38]);
+        break;
+    case 1:
+        if (acc.x > node_params[38].w) {
+            acc = acc * node_params[50] + tmp;
+        } else {
+            acc = mix(acc, tmp, node_params[62].x);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[10].x);
+        break;
+    default:
+        break;
+    }
+    // node 103
+    switch (node_ops[39][3]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[39];
+        break;
+    case 1:
+        if (acc.x > node_params[39].w) {
+            acc = acc * node_params[53] + tmp;
+        } else {
+            acc = acc * node_params[3] + tmp;
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[17]);
+        break;
+    default:
+        break;
+    }
+    // node 104
+    switch (node_ops[40][0]) {
+    case 0:
+        acc = max(acc, node_params[40]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[40].w) {
+            mask += dot(acc, node_params[56]);
+        } else {
+            acc = acc * node_params[8] + tmp;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[24] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 105
+    switch (node_ops[41][1]) {
+    case 0:
+        acc = max(acc, node_params[41]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[41].w) {
+            tmp = tmp.yzwx * node_params[59];
+        } else {
+            mask += dot(acc, node_params[13]);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[31]);
+        break;
+    default:
+        break;
+    }
+    // node 106
+    switch (node_ops[42][2]) {
+    case 0:
+        mask += dot(acc, node_params[42]);
+        break;
+    case 1:
+        if (acc.x > node_params[42].w) {
+            mask += dot(acc, node_params[62]);
+        } else {
+            acc = mix(acc, tmp, node_params[18].x);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[38], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 107
+    switch (node_ops[43][3]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[43];
+        break;
+    case 1:
+        if (acc.x > node_params[43].w) {
+            acc = max(acc, node_params[1]) - tmp * 0.5;
+        } else {
+            mask += dot(acc, node_params[23]);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[45]);
+        break;
+    default:
+        break;
+    }
+    // node 108
+    switch (node_ops[44][0]) {
+    case 0:
+        acc = max(acc, node_params[44]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[44].w) {
+            mask += dot(acc, node_params[4]);
+        } else {
+            acc = mix(acc, tmp, node_params[28].x);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[52], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 109
+    switch (node_ops[45][1]) {
+    case 0:
+        mask += dot(acc, node_params[45]);
+        break;
+    case 1:
+        if (acc.x > node_params[45].w) {
+            tmp = tmp.yzwx * node_params[7];
+        } else {
+            mask += dot(acc, node_params[33]);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[59].x);
+        break;
+    default:
+        break;
+    }
+    // node 110
+    switch (node_ops[46][2]) {
+    case 0:
+        acc = max(acc, node_params[46]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[46].w) {
+            acc = mix(acc, tmp, node_params[10].x);
+        } else {
+            acc = max(acc, node_params[38]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[2] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 111
+    switch (node_ops[47][3]) {
+    case 0:
+        acc = max(acc, node_params[47]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[47].w) {
+            acc = max(acc, node_params[13]) - tmp * 0.5;
+        } else {
+            tmp = tmp.yzwx * node_params[43];
+        }
+        break;
+    case 2:
+        acc = acc * node_params[9] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 112
+    switch (node_ops[48][0]) {
+    case 0:
+        acc = clamp(acc + node_params[48], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[48].w) {
+            acc = mix(acc, tmp, node_params[16].x);
+        } else {
+            acc = max(acc, node_params[48]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[16] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 113
+    switch (node_ops[49][1]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[49].x);
+        break;
+    case 1:
+        if (acc.x > node_params[49].w) {
+            acc = clamp(acc + node_params[19], 0.0, 1.0);
+        } else {
+            tmp = tmp.yzwx * node_params[53];
+        }
+        break;
+    case 2:
+        acc = acc * node_params[23] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 114
+    switch (node_ops[50][2]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[50].x);
+        break;
+    case 1:
+        if (acc.x > node_params[50].w) {
+            acc = clamp(acc + node_params[22], 0.0, 1.0);
+        } else {
+            acc = clamp(acc + node_params[58], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[30], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 115
+    switch (node_ops[51][3]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[51];
+        break;
+    case 1:
+        if (acc.x > node_params[51].w) {
+            acc = mix(acc, tmp, node_params[25].x);
+        } else {
+            tmp = tmp.yzwx * node_params[63];
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[37].x);
+        break;
+    default:
+        break;
+    }
+    // node 116
+    switch (node_ops[52][0]) {
+    case 0:
+        acc = max(acc, node_params[52]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[52].w) {
+            acc = mix(acc, tmp, node_params[28].x);
+        } else {
+            acc = clamp(acc + node_params[4], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[44] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 117
+    switch (node_ops[53][1]) {
+    case 0:
+        acc = max(acc, node_params[53]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[53].w) {
+            acc = max(acc, node_params[31]) - tmp * 0.5;
+        } else {
+            acc = mix(acc, tmp, node_params[9].x);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[51], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 118
+    switch (node_ops[54][2]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[54].x);
+        break;
+    case 1:
+        if (acc.x > node_params[54].w) {
+            acc = mix(acc, tmp, node_params[34].x);
+        } else {
+            acc = clamp(acc + node_params[14], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[58]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 119
+    switch (node_ops[55][3]) {
+    case 0:
+        mask += dot(acc, node_params[55]);
+        break;
+    case 1:
+        if (acc.x > node_params[55].w) {
+            acc = max(acc, node_params[37]) - tmp * 0.5;
+        } else {
+            tmp = tmp.yzwx * node_params[19];
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[1]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 120
+    switch (node_ops[56][0]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[56].x);
+        break;
+    case 1:
+        if (acc.x > node_params[56].w) {
+            tmp = tmp.yzwx * node_params[40];
+        } else {
+            tmp = tmp.yzwx * node_params[24];
+        }
+        break;
+    case 2:
+        acc = acc * node_params[8] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 121
+    switch (node_ops[57][1]) {
+    case 0:
+        acc = clamp(acc + node_params[57], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[57].w) {
+            tmp = tmp.yzwx * node_params[43];
+        } else {
+            acc = acc * node_params[29] + tmp;
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[15];
+        break;
+    default:
+        break;
+    }
+    // node 122
+    switch (node_ops[58][2]) {
+    case 0:
+        mask += dot(acc, node_params[58]);
+        break;
+    case 1:
+        if (acc.x > node_params[58].w) {
+            acc = max(acc, node_params[46]) - tmp * 0.5;
+        } else {
+            acc = max(acc, node_params[34]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[22], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 123
+    switch (node_ops[59][3]) {
+    case 0:
+        acc = acc * node_params[59] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[59].w) {
+            acc = max(acc, node_params[49]) - tmp * 0.5;
+        } else {
+            tmp = tmp.yzwx * node_params[39];
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[29]);
+        break;
+    default:
+        break;
+    }
+    // node 124
+    switch (node_ops[60][0]) {
+    case 0:
+        mask += dot(acc, node_params[60]);
+        break;
+    case 1:
+        if (acc.x > node_params[60].w) {
+            tmp = tmp.yzwx * node_params[52];
+        } else {
+            mask += dot(acc, node_params[44]);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[36] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 125
+    switch (node_ops[61][1]) {
+    case 0:
+        acc = acc * node_params[61] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[61].w) {
+            acc = mix(acc, tmp, node_params[55].x);
+        } else {
+            acc = acc * node_params[49] + tmp;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[43] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 126
+    switch (node_ops[62][2]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[62];
+        break;
+    case 1:
+        if (acc.x > node_params[62].w) {
+            tmp = tmp.yzwx * node_params[58];
+        } else {
+            acc = acc * node_params[54] + tmp;
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[50].x);
+        break;
+    default:
+        break;
+    }
+    // node 127
+    switch (node_ops[63][3]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[63];
+        break;
+    case 1:
+        if (acc.x > node_params[63].w) {
+            acc = mix(acc, tmp, node_params[61].x);
+        } else {
+            acc = max(acc, node_params[59]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[57], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 128
+    switch (node_ops[0][0]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[0];
+        break;
+    case 1:
+        if (acc.x > node_params[0].w) {
+            acc = max(acc, node_params[0]) - tmp * 0.5;
+        } else {
+            acc = mix(acc, tmp, node_params[0].x);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[0]);
+        break;
+    default:
+        break;
+    }
+    // node 129
+    switch (node_ops[1][1]) {
+    case 0:
+        mask += dot(acc, node_params[1]);
+        break;
+    case 1:
+        if (acc.x > node_params[1].w) {
+            mask += dot(acc, node_params[3]);
+        } else {
+            acc = max(acc, node_params[5]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[7], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 130
+    switch (node_ops[2][2]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[2];
+        break;
+    case 1:
+        if (acc.x > node_params[2].w) {
+            acc = acc * node_params[6] + tmp;
+        } else {
+            tmp = tmp.yzwx * node_params[10];
+        }
+        break;
+    case 2:
+        acc = acc * node_params[14] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 131
+    switch (node_ops[3][3]) {
+    case 0:
+        acc = clamp(acc + node_params[3], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[3].w) {
+            acc = mix(acc, tmp, node_params[9].x);
+        } else {
+            acc = max(acc, node_params[15]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[21] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 132
+    switch (node_ops[4][0]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[4];
+        break;
+    case 1:
+        if (acc.x > node_params[4].w) {
+            acc = acc * node_params[12] + tmp;
+        } else {
+            acc = clamp(acc + node_params[20], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[28] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 133
+    switch (node_ops[5][1]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[5];
+        break;
+    case 1:
+        if (acc.x > node_params[5].w) {
+            acc = acc * node_params[15] + tmp;
+        } else {
+            mask += dot(acc, node_params[25]);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[35].x);
+        break;
+    default:
+        break;
+    }
+    // node 134
+    switch (node_ops[6][2]) {
+    case 0:
+        acc = acc * node_params[6] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[6].w) {
+            tmp = tmp.yzwx * node_params[18];
+        } else {
+            acc = acc * node_params[30] + tmp;
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[42]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 135
+    switch (node_ops[7][3]) {
+    case 0:
+        acc = acc * node_params[7] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[7].w) {
+            tmp = tmp.yzwx * node_params[21];
+        } else {
+            mask += dot(acc, node_params[35]);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[49]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 136
+    switch (node_ops[8][0]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[8];
+        break;
+    case 1:
+        if (acc.x > node_params[8].w) {
+            mask += dot(acc, node_params[24]);
+        } else {
+            acc = mix(acc, tmp, node_params[40].x);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[56] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 137
+    switch (node_ops[9][1]) {
+    case 0:
+        mask += dot(acc, node_params[9]);
+        break;
+    case 1:
+        if (acc.x > node_params[9].w) {
+            acc = clamp(acc + node_params[27], 0.0, 1.0);
+        } else {
+            acc = mix(acc, tmp, node_params[45].x);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[63] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 138
+    switch (node_ops[10][2]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[10].x);
+        break;
+    case 1:
+        if (acc.x > node_params[10].w) {
+            tmp = tmp.yzwx * node_params[30];
+        } else {
+            acc = acc * node_params[50] + tmp;
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[6].x);
+        break;
+    default:
+        break;
+    }
+    // node 139
+    switch (node_ops[11][3]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[11].x);
+        break;
+    case 1:
+        if (acc.x > node_params[11].w) {
+            tmp = tmp.yzwx * node_params[33];
+        } else {
+            acc = clamp(acc + node_params[55], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[13];
+        break;
+    default:
+        break;
+    }
+    // node 140
+    switch (node_ops[12][0]) {
+    case 0:
+        mask += dot(acc, node_params[12]);
+        break;
+    case 1:
+        if (acc.x > node_params[12].w) {
+            acc = mix(acc, tmp, node_params[36].x);
+        } else {
+            tmp = tmp.yzwx * node_params[60];
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[20]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 141
+    switch (node_ops[13][1]) {
+    case 0:
+        mask += dot(acc, node_params[13]);
+        break;
+    case 1:
+        if (acc.x > node_params[13].w) {
+            acc = clamp(acc + node_params[39], 0.0, 1.0);
+        } else {
+            acc = mix(acc, tmp, node_params[1].x);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[27];
+        break;
+    default:
+        break;
+    }
+    // node 142
+    switch (node_ops[14][2]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[14];
+        break;
+    case 1:
+        if (acc.x > node_params[14].w) {
+            acc = acc * node_params[42] + tmp;
+        } else {
+            tmp = tmp.yzwx * node_params[6];
+        }
+        break;
+    case 2:
+        acc = acc * node_params[34] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 143
+    switch (node_ops[15][3]) {
+    case 0:
+        acc = acc * node_params[15] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[15].w) {
+            acc = acc * node_params[45] + tmp;
+        } else {
+            acc = clamp(acc + node_params[11], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[41]);
+        break;
+    default:
+        break;
+    }
+    // node 144
+    switch (node_ops[16][0]) {
+    case 0:
+        mask += dot(acc, node_params[16]);
+        break;
+    case 1:
+        if (acc.x > node_params[16].w) {
+            acc = mix(acc, tmp, node_params[48].x);
+        } else {
+            mask += dot(acc, node_params[16]);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[48]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 145
+    switch (node_ops[17][1]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[17].x);
+        break;
+    case 1:
+        if (acc.x > node_params[17].w) {
+            acc = max(acc, node_params[51]) - tmp * 0.5;
+        } else {
+            acc = acc * node_params[21] + tmp;
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[55], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 146
+    switch (node_ops[18][2]) {
+    case 0:
+        acc = clamp(acc + node_params[18], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[18].w) {
+            acc = max(acc, node_params[54]) - tmp * 0.5;
+        } else {
+            acc = clamp(acc + node_params[26], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[62]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 147
+    switch (node_ops[19][3]) {
+    case 0:
+        mask += dot(acc, node_params[19]);
+        break;
+    case 1:
+        if (acc.x > node_params[19].w) {
+            acc = max(acc, node_params[57]) - tmp * 0.5;
+        } else {
+            mask += dot(acc, node_params[31]);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[5];
+        break;
+    default:
+        break;
+    }
+    // node 148
+    switch (node_ops[20][0]) {
+    case 0:
+        acc = clamp(acc + node_params[20], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[20].w) {
+            acc = mix(acc, tmp, node_params[60].x);
+        } else {
+            acc = mix(acc, tmp, node_params[36].x);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[12];
+        break;
+    default:
+        break;
+    }
+    // node 149
+    switch (node_ops[21][1]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[21].x);
+        break;
+    case 1:
+        if (acc.x > node_params[21].w) {
+            acc = clamp(acc + node_params[63], 0.0, 1.0);
+        } else {
+            acc = clamp(acc + node_params[41], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[19], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 150
+    switch (node_ops[22][2]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[22].x);
+        break;
+    case 1:
+        if (acc.x > node_params[22].w) {
+            acc = max(acc, node_params[2]) - tmp * 0.5;
+        } else {
+            tmp = tmp.yzwx * node_params[46];
+        }
+        break;
+    case 2:
+        acc = acc * node_params[26] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 151
+    switch (node_ops[23][3]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[23].x);
+        break;
+    case 1:
+        if (acc.x > node_params[23].w) {
+            acc = acc * node_params[5] + tmp;
+        } else {
+            acc = acc * node_params[51] + tmp;
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[33], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 152
+    switch (node_ops[24][0]) {
+    case 0:
+        acc = clamp(acc + node_params[24], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[24].w) {
+            tmp = tmp.yzwx * node_params[8];
+        } else {
+            acc = max(acc, node_params[56]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[40].x);
+        break;
+    default:
+        break;
+    }
+    // node 153
+    switch (node_ops[25][1]) {
+    case 0:
+        acc = acc * node_params[25] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[25].w) {
+            acc = acc * node_params[11] + tmp;
+        } else {
+            acc = clamp(acc + node_params[61], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[47]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 154
+    switch (node_ops[26][2]) {
+    case 0:
+        mask += dot(acc, node_params[26]);
+        break;
+    case 1:
+        if (acc.x > node_params[26].w) {
+            acc = clamp(acc + node_params[14], 0.0, 1.0);
+        } else {
+            tmp = tmp.yzwx * node_params[2];
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[54]);
+        break;
+    default:
+        break;
+    }
+    // node 155
+    switch (node_ops[27][3]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[27].x);
+        break;
+    case 1:
+        if (acc.x > node_params[27].w) {
+            acc = clamp(acc + node_params[17], 0.0, 1.0);
+        } else {
+            tmp = tmp.yzwx * node_params[7];
+        }
+        break;
+    case 2:
+        acc = acc * node_params[61] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 156
+    switch (node_ops[28][0]) {
+    case 0:
+        acc = max(acc, node_params[28]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[28].w) {
+            acc = mix(acc, tmp, node_params[20].x);
+        } else {
+            acc = mix(acc, tmp, node_params[12].x);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[4];
+        break;
+    default:
+        break;
+    }
+    // node 157
+    switch (node_ops[29][1]) {
+    case 0:
+        acc = max(acc, node_params[29]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[29].w) {
+            acc = acc * node_params[23] + tmp;
+        } else {
+            tmp = tmp.yzwx * node_params[17];
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[11];
+        break;
+    default:
+        break;
+    }
+    // node 158
+    switch (node_ops[30][2]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[30];
+        break;
+    case 1:
+        if (acc.x > node_params[30].w) {
+            mask += dot(acc, node_params[26]);
+        } else {
+            tmp = tmp.yzwx * node_params[22];
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[18].x);
+        break;
+    default:
+        break;
+    }
+    // node 159
+    switch (node_ops[31][3]) {
+    case 0:
+        acc = acc * node_params[31] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[31].w) {
+            tmp = tmp.yzwx * node_params[29];
+        } else {
+            acc = mix(acc, tmp, node_params[27].x);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[25];
+        break;
+    default:
+        break;
+    }
+    // node 160
+    switch (node_ops[32][0]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[32].x);
+        break;
+    case 1:
+        if (acc.x > node_params[32].w) {
+            acc = acc * node_params[32] + tmp;
+        } else {
+            tmp = tmp.yzwx * node_params[32];
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[32]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 161
+    switch (node_ops[33][1]) {
+    case 0:
+        acc = acc * node_params[33] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[33].w) {
+            acc = max(acc, node_params[35]) - tmp * 0.5;
+        } else {
+            tmp = tmp.yzwx * node_params[37];
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[39]);
+        break;
+    default:
+        break;
+    }
+    // node 162
+    switch (node_ops[34][2]) {
+    case 0:
+        acc = clamp(acc + node_params[34], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[34].w) {
+            acc = mix(acc, tmp, node_params[38].x);
+        } else {
+            acc = mix(acc, tmp, node_params[42].x);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[46]);
+        break;
+    default:
+        break;
+    }
+    // node 163
+    switch (node_ops[35][3]) {
+    case 0:
+        acc = acc * node_params[35] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[35].w) {
+            acc = acc * node_params[41] + tmp;
+        } else {
+            tmp = tmp.yzwx * node_params[47];
+        }
+        break;
+    case 2:
+        acc = acc * node_params[53] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 164
+    switch (node_ops[36][0]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[36].x);
+        break;
+    case 1:
+        if (acc.x > node_params[36].w) {
+            acc = max(acc, node_params[44]) - tmp * 0.5;
+        } else {
+            mask += dot(acc, node_params[52]);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[60] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 165
+    switch (node_ops[37][1]) {
+    case 0:
+        acc = max(acc, node_params[37]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[37].w) {
+            acc = acc * node_params[47] + tmp;
+        } else {
+            tmp = tmp.yzwx * node_params[57];
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[3];
+        break;
+    default:
+        break;
+    }
+    // node 166
+    switch (node_ops[38][2]) {
+    case 0:
+        acc = clamp(acc + node_params[38], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[38].w) {
+            acc = mix(acc, tmp, node_params[50].x);
+        } else {
+            acc = acc * node_params[62] + tmp;
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[10]);
+        break;
+    default:
+        break;
+    }
+    // node 167
+    switch (node_ops[39][3]) {
+    case 0:
+        mask += dot(acc, node_params[39]);
+        break;
+    case 1:
+        if (acc.x > node_params[39].w) {
+            acc = mix(acc, tmp, node_params[53].x);
+        } else {
+            acc = clamp(acc + node_params[3], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[17], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 168
+    switch (node_ops[40][0]) {
+    case 0:
+        mask += dot(acc, node_params[40]);
+        break;
+    case 1:
+        if (acc.x > node_params[40].w) {
+            acc = max(acc, node_params[56]) - tmp * 0.5;
+        } else {
+            tmp = tmp.yzwx * node_params[8];
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[24], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 169
+    switch (node_ops[41][1]) {
+    case 0:
+        acc = max(acc, node_params[41]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[41].w) {
+            acc = mix(acc, tmp, node_params[59].x);
+        } else {
+            tmp = tmp.yzwx * node_params[13];
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[31], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 170
+    switch (node_ops[42][2]) {
+    case 0:
+        mask += dot(acc, node_params[42]);
+        break;
+    case 1:
+        if (acc.x > node_params[42].w) {
+            acc = clamp(acc + node_params[62], 0.0, 1.0);
+        } else {
+            acc = mix(acc, tmp, node_params[18].x);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[38] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 171
+    switch (node_ops[43][3]) {
+    case 0:
+        acc = clamp(acc + node_params[43], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[43].w) {
+            mask += dot(acc, node_params[1]);
+        } else {
+            acc = clamp(acc + node_params[23], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[45]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 172
+    switch (node_ops[44][0]) {
+    case 0:
+        acc = clamp(acc + node_params[44], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[44].w) {
+            acc = clamp(acc + node_params[4], 0.0, 1.0);
+        } else {
+            mask += dot(acc, node_params[28]);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[52].x);
+        break;
+    default:
+        break;
+    }
+    // node 173
+    switch (node_ops[45][1]) {
+    case 0:
+        mask += dot(acc, node_params[45]);
+        break;
+    case 1:
+        if (acc.x > node_params[45].w) {
+            mask += dot(acc, node_params[7]);
+        } else {
+            mask += dot(acc, node_params[33]);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[59] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 174
+    switch (node_ops[46][2]) {
+    case 0:
+        acc = clamp(acc + node_params[46], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[46].w) {
+            mask += dot(acc, node_params[10]);
+        } else {
+            acc = clamp(acc + node_params[38], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[2], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 175
+    switch (node_ops[47][3]) {
+    case 0:
+        acc = clamp(acc + node_params[47], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[47].w) {
+            acc = clamp(acc + node_params[13], 0.0, 1.0);
+        } else {
+            acc = mix(acc, tmp, node_params[43].x);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[9] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 176
+    switch (node_ops[48][0]) {
+    case 0:
+        acc = acc * node_params[48] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[48].w) {
+            acc = acc * node_params[16] + tmp;
+        } else {
+            acc = mix(acc, tmp, node_params[48].x);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[16], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 177
+    switch (node_ops[49][1]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[49];
+        break;
+    case 1:
+        if (acc.x > node_params[49].w) {
+            acc = acc * node_params[19] + tmp;
+        } else {
+            acc = max(acc, node_params[53]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[23]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 178
+    switch (node_ops[50][2]) {
+    case 0:
+        mask += dot(acc, node_params[50]);
+        break;
+    case 1:
+        if (acc.x > node_params[50].w) {
+            acc = acc * node_params[22] + tmp;
+        } else {
+            acc = clamp(acc + node_params[58], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[30] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 179
+    switch (node_ops[51][3]) {
+    case 0:
+        acc = clamp(acc + node_params[51], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[51].w) {
+            mask += dot(acc, node_params[25]);
+        } else {
+            acc = clamp(acc + node_params[63], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[37].x);
+        break;
+    default:
+        break;
+    }
+    // node 180
+    switch (node_ops[52][0]) {
+    case 0:
+        acc = max(acc, node_params[52]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[52].w) {
+            tmp = tmp.yzwx * node_params[28];
+        } else {
+            acc = acc * node_params[4] + tmp;
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[44]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 181
+    switch (node_ops[53][1]) {
+    case 0:
+        acc = acc * node_params[53] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[53].w) {
+            acc = clamp(acc + node_params[31], 0.0, 1.0);
+        } else {
+            mask += dot(acc, node_params[9]);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[51]);
+        break;
+    default:
+        break;
+    }
+    // node 182
+    switch (node_ops[54][2]) {
+    case 0:
+        acc = acc * node_params[54] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[54].w) {
+            acc = clamp(acc + node_params[34], 0.0, 1.0);
+        } else {
+            mask += dot(acc, node_params[14]);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[58] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 183
+    switch (node_ops[55][3]) {
+    case 0:
+        acc = clamp(acc + node_params[55], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[55].w) {
+            acc = clamp(acc + node_params[37], 0.0, 1.0);
+        } else {
+            acc = max(acc, node_params[19]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[1];
+        break;
+    default:
+        break;
+    }
+    // node 184
+    switch (node_ops[56][0]) {
+    case 0:
+        acc = acc * node_params[56] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[56].w) {
+            tmp = tmp.yzwx * node_params[40];
+        } else {
+            acc = mix(acc, tmp, node_params[24].x);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[8], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 185
+    switch (node_ops[57][1]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[57].x);
+        break;
+    case 1:
+        if (acc.x > node_params[57].w) {
+            acc = mix(acc, tmp, node_params[43].x);
+        } else {
+            acc = clamp(acc + node_params[29], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[15], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 186
+    switch (node_ops[58][2]) {
+    case 0:
+        acc = max(acc, node_params[58]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[58].w) {
+            acc = max(acc, node_params[46]) - tmp * 0.5;
+        } else {
+            acc = max(acc, node_params[34]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[22] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 187
+    switch (node_ops[59][3]) {
+    case 0:
+        acc = max(acc, node_params[59]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[59].w) {
+            acc = clamp(acc + node_params[49], 0.0, 1.0);
+        } else {
+            tmp = tmp.yzwx * node_params[39];
+        }
+        break;
+    case 2:
+        acc = acc * node_params[29] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 188
+    switch (node_ops[60][0]) {
+    case 0:
+        mask += dot(acc, node_params[60]);
+        break;
+    case 1:
+        if (acc.x > node_params[60].w) {
+            acc = clamp(acc + node_params[52], 0.0, 1.0);
+        } else {
+            acc = clamp(acc + node_params[44], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[36].x);
+        break;
+    default:
+        break;
+    }
+    // node 189
+    switch (node_ops[61][1]) {
+    case 0:
+        acc = acc * node_params[61] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[61].w) {
+            mask += dot(acc, node_params[55]);
+        } else {
+            acc = mix(acc, tmp, node_params[49].x);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[43];
+        break;
+    default:
+        break;
+    }
+    // node 190
+    switch (node_ops[62][2]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[62];
+        break;
+    case 1:
+        if (acc.x > node_params[62].w) {
+            acc = clamp(acc + node_params[58], 0.0, 1.0);
+        } else {
+            acc = clamp(acc + node_params[54], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[50], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 191
+    switch (node_ops[63][3]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[63];
+        break;
+    case 1:
+        if (acc.x > node_params[63].w) {
+            mask += dot(acc, node_params[61]);
+        } else {
+            mask += dot(acc, node_params[59]);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[57].x);
+        break;
+    default:
+        break;
+    }
+    // node 192
+    switch (node_ops[0][0]) {
+    case 0:
+        acc = acc * node_params[0] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[0].w) {
+            acc = max(acc, node_params[0]) - tmp * 0.5;
+        } else {
+            acc = acc * node_params[0] + tmp;
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[0]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 193
+    switch (node_ops[1][1]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[1];
+        break;
+    case 1:
+        if (acc.x > node_params[1].w) {
+            acc = clamp(acc + node_params[3], 0.0, 1.0);
+        } else {
+            acc = acc * node_params[5] + tmp;
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[7], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 194
+    switch (node_ops[2][2]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[2].x);
+        break;
+    case 1:
+        if (acc.x > node_params[2].w) {
+            acc = clamp(acc + node_params[6], 0.0, 1.0);
+        } else {
+            acc = max(acc, node_params[10]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[14];
+        break;
+    default:
+        break;
+    }
+    // node 195
+    switch (node_ops[3][3]) {
+    case 0:
+        acc = clamp(acc + node_params[3], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[3].w) {
+            mask += dot(acc, node_params[9]);
+        } else {
+            tmp = tmp.yzwx * node_params[15];
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[21]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 196
+    switch (node_ops[4][0]) {
+    case 0:
+        acc = max(acc, node_params[4]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[4].w) {
+            acc = max(acc, node_params[12]) - tmp * 0.5;
+        } else {
+            acc = acc * node_params[20] + tmp;
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[28]);
+        break;
+    default:
+        break;
+    }
+    // node 197
+    switch (node_ops[5][1]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[5].x);
+        break;
+    case 1:
+        if (acc.x > node_params[5].w) {
+            tmp = tmp.yzwx * node_params[15];
+        } else {
+            acc = acc * node_params[25] + tmp;
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[35]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 198
+    switch (node_ops[6][2]) {
+    case 0:
+        acc = acc * node_params[6] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[6].w) {
+            tmp = tmp.yzwx * node_params[18];
+        } else {
+            acc = max(acc, node_params[30]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[42] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 199
+    switch (node_ops[7][3]) {
+    case 0:
+        mask += dot(acc, node_params[7]);
+        break;
+    case 1:
+        if (acc.x > node_params[7].w) {
+            acc = max(acc, node_params[21]) - tmp * 0.5;
+        } else {
+            tmp = tmp.yzwx * node_params[35];
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[49]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 200
+    switch (node_ops[8][0]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[8].x);
+        break;
+    case 1:
+        if (acc.x > node_params[8].w) {
+            acc = mix(acc, tmp, node_params[24].x);
+        } else {
+            acc = acc * node_params[40] + tmp;
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[56]);
+        break;
+    default:
+        break;
+    }
+    // node 201
+    switch (node_ops[9][1]) {
+    case 0:
+        acc = acc * node_params[9] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[9].w) {
+            acc = mix(acc, tmp, node_params[27].x);
+        } else {
+            acc = clamp(acc + node_params[45], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[63]);
+        break;
+    default:
+        break;
+    }
+    // node 202
+    switch (node_ops[10][2]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[10];
+        break;
+    case 1:
+        if (acc.x > node_params[10].w) {
+            tmp = tmp.yzwx * node_params[30];
+        } else {
+            acc = mix(acc, tmp, node_params[50].x);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[6]);
+        break;
+    default:
+        break;
+    }
+    // node 203
+    switch (node_ops[11][3]) {
+    case 0:
+        acc = clamp(acc + node_params[11], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[11].w) {
+            mask += dot(acc, node_params[33]);
+        } else {
+            tmp = tmp.yzwx * node_params[55];
+        }
+        break;
+    case 2:
+        acc = acc * node_params[13] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 204
+    switch (node_ops[12][0]) {
+    case 0:
+        acc = clamp(acc + node_params[12], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[12].w) {
+            tmp = tmp.yzwx * node_params[36];
+        } else {
+            acc = mix(acc, tmp, node_params[60].x);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[20]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 205
+    switch (node_ops[13][1]) {
+    case 0:
+        acc = max(acc, node_params[13]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[13].w) {
+            acc = max(acc, node_params[39]) - tmp * 0.5;
+        } else {
+            acc = acc * node_params[1] + tmp;
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[27].x);
+        break;
+    default:
+        break;
+    }
+    // node 206
+    switch (node_ops[14][2]) {
+    case 0:
+        acc = acc * node_params[14] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[14].w) {
+            acc = max(acc, node_params[42]) - tmp * 0.5;
+        } else {
+            acc = clamp(acc + node_params[6], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[34]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 207
+    switch (node_ops[15][3]) {
+    case 0:
+        acc = max(acc, node_params[15]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[15].w) {
+            tmp = tmp.yzwx * node_params[45];
+        } else {
+            acc = clamp(acc + node_params[11], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[41].x);
+        break;
+    default:
+        break;
+    }
+    // node 208
+    switch (node_ops[16][0]) {
+    case 0:
+        acc = max(acc, node_params[16]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[16].w) {
+            tmp = tmp.yzwx * node_params[48];
+        } else {
+            acc = max(acc, node_params[16]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[48];
+        break;
+    default:
+        break;
+    }
+    // node 209
+    switch (node_ops[17][1]) {
+    case 0:
+        acc = acc * node_params[17] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[17].w) {
+            tmp = tmp.yzwx * node_params[51];
+        } else {
+            acc = acc * node_params[21] + tmp;
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[55];
+        break;
+    default:
+        break;
+    }
+    // node 210
+    switch (node_ops[18][2]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[18];
+        break;
+    case 1:
+        if (acc.x > node_params[18].w) {
+            acc = max(acc, node_params[54]) - tmp * 0.5;
+        } else {
+            acc = acc * node_params[26] + tmp;
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[62].x);
+        break;
+    default:
+        break;
+    }
+    // node 211
+    switch (node_ops[19][3]) {
+    case 0:
+        acc = clamp(acc + node_params[19], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[19].w) {
+            acc = acc * node_params[57] + tmp;
+        } else {
+            acc = clamp(acc + node_params[31], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[5];
+        break;
+    default:
+        break;
+    }
+    // node 212
+    switch (node_ops[20][0]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[20];
+        break;
+    case 1:
+        if (acc.x > node_params[20].w) {
+            tmp = tmp.yzwx * node_params[60];
+        } else {
+            acc = acc * node_params[36] + tmp;
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[12]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 213
+    switch (node_ops[21][1]) {
+    case 0:
+        acc = max(acc, node_params[21]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[21].w) {
+            mask += dot(acc, node_params[63]);
+        } else {
+            acc = acc * node_params[41] + tmp;
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[19];
+        break;
+    default:
+        break;
+    }
+    // node 214
+    switch (node_ops[22][2]) {
+    case 0:
+        acc = max(acc, node_params[22]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[22].w) {
+            tmp = tmp.yzwx * node_params[2];
+        } else {
+            acc = acc * node_params[46] + tmp;
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[26];
+        break;
+    default:
+        break;
+    }
+    // node 215
+    switch (node_ops[23][3]) {
+    case 0:
+        acc = acc * node_params[23] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[23].w) {
+            acc = acc * node_params[5] + tmp;
+        } else {
+            acc = clamp(acc + node_params[51], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[33];
+        break;
+    default:
+        break;
+    }
+    // node 216
+    switch (node_ops[24][0]) {
+    case 0:
+        acc = clamp(acc + node_params[24], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[24].w) {
+            acc = mix(acc, tmp, node_params[8].x);
+        } else {
+            acc = mix(acc, tmp, node_params[56].x);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[40];
+        break;
+    default:
+        break;
+    }
+    // node 217
+    switch (node_ops[25][1]) {
+    case 0:
+        acc = max(acc, node_params[25]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[25].w) {
+            mask += dot(acc, node_params[11]);
+        } else {
+            tmp = tmp.yzwx * node_params[61];
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[47].x);
+        break;
+    default:
+        break;
+    }
+    // node 218
+    switch (node_ops[26][2]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[26];
+        break;
+    case 1:
+        if (acc.x > node_params[26].w) {
+            acc = max(acc, node_params[14]) - tmp * 0.5;
+        } else {
+            acc = acc * node_params[2] + tmp;
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[54], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 219
+    switch (node_ops[27][3]) {
+    case 0:
+        acc = max(acc, node_params[27]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[27].w) {
+            mask += dot(acc, node_params[17]);
+        } else {
+            mask += dot(acc, node_params[7]);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[61].x);
+        break;
+    default:
+        break;
+    }
+    // node 220
+    switch (node_ops[28][0]) {
+    case 0:
+        acc = clamp(acc + node_params[28], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[28].w) {
+            acc = acc * node_params[20] + tmp;
+        } else {
+            acc = acc * node_params[12] + tmp;
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[4], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 221
+    switch (node_ops[29][1]) {
+    case 0:
+        acc = max(acc, node_params[29]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[29].w) {
+            acc = max(acc, node_params[23]) - tmp * 0.5;
+        } else {
+            mask += dot(acc, node_params[17]);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[11].x);
+        break;
+    default:
+        break;
+    }
+    // node 222
+    switch (node_ops[30][2]) {
+    case 0:
+        acc = clamp(acc + node_params[30], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[30].w) {
+            tmp = tmp.yzwx * node_params[26];
+        } else {
+            acc = max(acc, node_params[22]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[18] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 223
+    switch (node_ops[31][3]) {
+    case 0:
+        mask += dot(acc, node_params[31]);
+        break;
+    case 1:
+        if (acc.x > node_params[31].w) {
+            acc = mix(acc, tmp, node_params[29].x);
+        } else {
+            acc = mix(acc, tmp, node_params[27].x);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[25]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 224
+    switch (node_ops[32][0]) {
+    case 0:
+        acc = max(acc, node_params[32]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[32].w) {
+            tmp = tmp.yzwx * node_params[32];
+        } else {
+            tmp = tmp.yzwx * node_params[32];
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[32];
+        break;
+    default:
+        break;
+    }
+    // node 225
+    switch (node_ops[33][1]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[33];
+        break;
+    case 1:
+        if (acc.x > node_params[33].w) {
+            acc = clamp(acc + node_params[35], 0.0, 1.0);
+        } else {
+            acc = clamp(acc + node_params[37], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[39], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 226
+    switch (node_ops[34][2]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[34];
+        break;
+    case 1:
+        if (acc.x > node_params[34].w) {
+            acc = max(acc, node_params[38]) - tmp * 0.5;
+        } else {
+            acc = clamp(acc + node_params[42], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[46].x);
+        break;
+    default:
+        break;
+    }
+    // node 227
+    switch (node_ops[35][3]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[35];
+        break;
+    case 1:
+        if (acc.x > node_params[35].w) {
+            acc = max(acc, node_params[41]) - tmp * 0.5;
+        } else {
+            mask += dot(acc, node_params[47]);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[53], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 228
+    switch (node_ops[36][0]) {
+    case 0:
+        acc = max(acc, node_params[36]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[36].w) {
+            acc = acc * node_params[44] + tmp;
+        } else {
+            acc = mix(acc, tmp, node_params[52].x);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[60], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 229
+    switch (node_ops[37][1]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[37].x);
+        break;
+    case 1:
+        if (acc.x > node_params[37].w) {
+            acc = acc * node_params[47] + tmp;
+        } else {
+            acc = mix(acc, tmp, node_params[57].x);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[3]);
+        break;
+    default:
+        break;
+    }
+    // node 230
+    switch (node_ops[38][2]) {
+    case 0:
+        acc = max(acc, node_params[38]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[38].w) {
+            mask += dot(acc, node_params[50]);
+        } else {
+            acc = mix(acc, tmp, node_params[62].x);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[10]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 231
+    switch (node_ops[39][3]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[39];
+        break;
+    case 1:
+        if (acc.x > node_params[39].w) {
+            acc = max(acc, node_params[53]) - tmp * 0.5;
+        } else {
+            acc = max(acc, node_params[3]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[17].x);
+        break;
+    default:
+        break;
+    }
+    // node 232
+    switch (node_ops[40][0]) {
+    case 0:
+        mask += dot(acc, node_params[40]);
+        break;
+    case 1:
+        if (acc.x > node_params[40].w) {
+            acc = mix(acc, tmp, node_params[56].x);
+        } else {
+            acc = mix(acc, tmp, node_params[8].x);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[24] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 233
+    switch (node_ops[41][1]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[41].x);
+        break;
+    case 1:
+        if (acc.x > node_params[41].w) {
+            tmp = tmp.yzwx * node_params[59];
+        } else {
+            mask += dot(acc, node_params[13]);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[31] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 234
+    switch (node_ops[42][2]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[42];
+        break;
+    case 1:
+        if (acc.x > node_params[42].w) {
+            acc = mix(acc, tmp, node_params[62].x);
+        } else {
+            tmp = tmp.yzwx * node_params[18];
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[38];
+        break;
+    default:
+        break;
+    }
+    // node 235
+    switch (node_ops[43][3]) {
+    case 0:
+        mask += dot(acc, node_params[43]);
+        break;
+    case 1:
+        if (acc.x > node_params[43].w) {
+            acc = mix(acc, tmp, node_params[1].x);
+        } else {
+            acc = acc * node_params[23] + tmp;
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[45], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 236
+    switch (node_ops[44][0]) {
+    case 0:
+        acc = max(acc, node_params[44]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[44].w) {
+            acc = max(acc, node_params[4]) - tmp * 0.5;
+        } else {
+            acc = max(acc, node_params[28]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[52], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 237
+    switch (node_ops[45][1]) {
+    case 0:
+        mask += dot(acc, node_params[45]);
+        break;
+    case 1:
+        if (acc.x > node_params[45].w) {
+            acc = mix(acc, tmp, node_params[7].x);
+        } else {
+            acc = max(acc, node_params[33]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[59];
+        break;
+    default:
+        break;
+    }
+    // node 238
+    switch (node_ops[46][2]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[46];
+        break;
+    case 1:
+        if (acc.x > node_params[46].w) {
+            acc = acc * node_params[10] + tmp;
+        } else {
+            acc = max(acc, node_params[38]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[2];
+        break;
+    default:
+        break;
+    }
+    // node 239
+    switch (node_ops[47][3]) {
+    case 0:
+        mask += dot(acc, node_params[47]);
+        break;
+    case 1:
+        if (acc.x > node_params[47].w) {
+            tmp = tmp.yzwx * node_params[13];
+        } else {
+            acc = mix(acc, tmp, node_params[43].x);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[9], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 240
+    switch (node_ops[48][0]) {
+    case 0:
+        mask += dot(acc, node_params[48]);
+        break;
+    case 1:
+        if (acc.x > node_params[48].w) {
+            mask += dot(acc, node_params[16]);
+        } else {
+            acc = clamp(acc + node_params[48], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[16].x);
+        break;
+    default:
+        break;
+    }
+    // node 241
+    switch (node_ops[49][1]) {
+    case 0:
+        acc = acc * node_params[49] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[49].w) {
+            tmp = tmp.yzwx * node_params[19];
+        } else {
+            acc = mix(acc, tmp, node_params[53].x);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[23]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 242
+    switch (node_ops[50][2]) {
+    case 0:
+        acc = max(acc, node_params[50]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[50].w) {
+            acc = clamp(acc + node_params[22], 0.0, 1.0);
+        } else {
+            acc = max(acc, node_params[58]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[30]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 243
+    switch (node_ops[51][3]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[51];
+        break;
+    case 1:
+        if (acc.x > node_params[51].w) {
+            acc = acc * node_params[25] + tmp;
+        } else {
+            acc = mix(acc, tmp, node_params[63].x);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[37] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 244
+    switch (node_ops[52][0]) {
+    case 0:
+        acc = max(acc, node_params[52]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[52].w) {
+            acc = clamp(acc + node_params[28], 0.0, 1.0);
+        } else {
+            acc = max(acc, node_params[4]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[44]);
+        break;
+    default:
+        break;
+    }
+    // node 245
+    switch (node_ops[53][1]) {
+    case 0:
+        acc = max(acc, node_params[53]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[53].w) {
+            acc = acc * node_params[31] + tmp;
+        } else {
+            acc = acc * node_params[9] + tmp;
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[51]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 246
+    switch (node_ops[54][2]) {
+    case 0:
+        mask += dot(acc, node_params[54]);
+        break;
+    case 1:
+        if (acc.x > node_params[54].w) {
+            acc = max(acc, node_params[34]) - tmp * 0.5;
+        } else {
+            acc = max(acc, node_params[14]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[58].x);
+        break;
+    default:
+        break;
+    }
+    // node 247
+    switch (node_ops[55][3]) {
+    case 0:
+        acc = acc * node_params[55] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[55].w) {
+            acc = mix(acc, tmp, node_params[37].x);
+        } else {
+            acc = mix(acc, tmp, node_params[19].x);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[1].x);
+        break;
+    default:
+        break;
+    }
+    // node 248
+    switch (node_ops[56][0]) {
+    case 0:
+        mask += dot(acc, node_params[56]);
+        break;
+    case 1:
+        if (acc.x > node_params[56].w) {
+            acc = clamp(acc + node_params[40], 0.0, 1.0);
+        } else {
+            acc = acc * node_params[24] + tmp;
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[8], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 249
+    switch (node_ops[57][1]) {
+    case 0:
+        acc = clamp(acc + node_params[57], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[57].w) {
+            acc = clamp(acc + node_params[43], 0.0, 1.0);
+        } else {
+            acc = max(acc, node_params[29]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[15] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 250
+    switch (node_ops[58][2]) {
+    case 0:
+        mask += dot(acc, node_params[58]);
+        break;
+    case 1:
+        if (acc.x > node_params[58].w) {
+            acc = acc * node_params[46] + tmp;
+        } else {
+            acc = acc * node_params[34] + tmp;
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[22].x);
+        break;
+    default:
+        break;
+    }
+    // node 251
+    switch (node_ops[59][3]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[59].x);
+        break;
+    case 1:
+        if (acc.x > node_params[59].w) {
+            mask += dot(acc, node_params[49]);
+        } else {
+            acc = acc * node_params[39] + tmp;
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[29], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 252
+    switch (node_ops[60][0]) {
+    case 0:
+        acc = clamp(acc + node_params[60], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[60].w) {
+            tmp = tmp.yzwx * node_params[52];
+        } else {
+            acc = mix(acc, tmp, node_params[44].x);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[36], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 253
+    switch (node_ops[61][1]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[61];
+        break;
+    case 1:
+        if (acc.x > node_params[61].w) {
+            mask += dot(acc, node_params[55]);
+        } else {
+            acc = clamp(acc + node_params[49], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[43]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 254
+    switch (node_ops[62][2]) {
+    case 0:
+        acc = clamp(acc + node_params[62], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[62].w) {
+            acc = acc * node_params[58] + tmp;
+        } else {
+            acc = acc * node_params[54] + tmp;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[50] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 255
+    switch (node_ops[63][3]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[63];
+        break;
+    case 1:
+        if (acc.x > node_params[63].w) {
+            mask += dot(acc, node_params[61]);
+        } else {
+            mask += dot(acc, node_params[59]);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[57].x);
+        break;
+    default:
+        break;
+    }
+    // node 256
+    switch (node_ops[0][0]) {
+    case 0:
+        acc = max(acc, node_params[0]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[0].w) {
+            tmp = tmp.yzwx * node_params[0];
+        } else {
+            acc = mix(acc, tmp, node_params[0].x);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[0]);
+        break;
+    default:
+        break;
+    }
+    // node 257
+    switch (node_ops[1][1]) {
+    case 0:
+        acc = acc * node_params[1] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[1].w) {
+            acc = acc * node_params[3] + tmp;
+        } else {
+            mask += dot(acc, node_params[5]);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[7];
+        break;
+    default:
+        break;
+    }
+    // node 258
+    switch (node_ops[2][2]) {
+    case 0:
+        acc = max(acc, node_params[2]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[2].w) {
+            tmp = tmp.yzwx * node_params[6];
+        } else {
+            tmp = tmp.yzwx * node_params[10];
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[14], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 259
+    switch (node_ops[3][3]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[3].x);
+        break;
+    case 1:
+        if (acc.x > node_params[3].w) {
+            acc = max(acc, node_params[9]) - tmp * 0.5;
+        } else {
+            mask += dot(acc, node_params[15]);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[21].x);
+        break;
+    default:
+        break;
+    }
+    // node 260
+    switch (node_ops[4][0]) {
+    case 0:
+        mask += dot(acc, node_params[4]);
+        break;
+    case 1:
+        if (acc.x > node_params[4].w) {
+            acc = mix(acc, tmp, node_params[12].x);
+        } else {
+            acc = acc * node_params[20] + tmp;
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[28]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 261
+    switch (node_ops[5][1]) {
+    case 0:
+        acc = clamp(acc + node_params[5], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[5].w) {
+            acc = clamp(acc + node_params[15], 0.0, 1.0);
+        } else {
+            tmp = tmp.yzwx * node_params[25];
+        }
+        break;
+    case 2:
+        acc = acc * node_params[35] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 262
+    switch (node_ops[6][2]) {
+    case 0:
+        acc = acc * node_params[6] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[6].w) {
+            acc = mix(acc, tmp, node_params[18].x);
+        } else {
+            acc = max(acc, node_params[30]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[42], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 263
+    switch (node_ops[7][3]) {
+    case 0:
+        acc = clamp(acc + node_params[7], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[7].w) {
+            acc = max(acc, node_params[21]) - tmp * 0.5;
+        } else {
+            acc = acc * node_params[35] + tmp;
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[49];
+        break;
+    default:
+        break;
+    }
+    // node 264
+    switch (node_ops[8][0]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[8].x);
+        break;
+    case 1:
+        if (acc.x > node_params[8].w) {
+            acc = clamp(acc + node_params[24], 0.0, 1.0);
+        } else {
+            acc = max(acc, node_params[40]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[56];
+        break;
+    default:
+        break;
+    }
+    // node 265
+    switch (node_ops[9][1]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[9].x);
+        break;
+    case 1:
+        if (acc.x > node_params[9].w) {
+            acc = max(acc, node_params[27]) - tmp * 0.5;
+        } else {
+            acc = acc * node_params[45] + tmp;
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[63], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 266
+    switch (node_ops[10][2]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[10];
+        break;
+    case 1:
+        if (acc.x > node_params[10].w) {
+            acc = clamp(acc + node_params[30], 0.0, 1.0);
+        } else {
+            acc = max(acc, node_params[50]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[6];
+        break;
+    default:
+        break;
+    }
+    // node 267
+    switch (node_ops[11][3]) {
+    case 0:
+        acc = clamp(acc + node_params[11], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[11].w) {
+            acc = max(acc, node_params[33]) - tmp * 0.5;
+        } else {
+            acc = mix(acc, tmp, node_params[55].x);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[13] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 268
+    switch (node_ops[12][0]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[12];
+        break;
+    case 1:
+        if (acc.x > node_params[12].w) {
+            acc = clamp(acc + node_params[36], 0.0, 1.0);
+        } else {
+            mask += dot(acc, node_params[60]);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[20] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 269
+    switch (node_ops[13][1]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[13].x);
+        break;
+    case 1:
+        if (acc.x > node_params[13].w) {
+            acc = max(acc, node_params[39]) - tmp * 0.5;
+        } else {
+            acc = mix(acc, tmp, node_params[1].x);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[27];
+        break;
+    default:
+        break;
+    }
+    // node 270
+    switch (node_ops[14][2]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[14].x);
+        break;
+    case 1:
+        if (acc.x > node_params[14].w) {
+            acc = mix(acc, tmp, node_params[42].x);
+        } else {
+            acc = max(acc, node_params[6]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[34].x);
+        break;
+    default:
+        break;
+    }
+    // node 271
+    switch (node_ops[15][3]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[15];
+        break;
+    case 1:
+        if (acc.x > node_params[15].w) {
+            tmp = tmp.yzwx * node_params[45];
+        } else {
+            acc = acc * node_params[11] + tmp;
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[41]);
+        break;
+    default:
+        break;
+    }
+    // node 272
+    switch (node_ops[16][0]) {
+    case 0:
+        acc = max(acc, node_params[16]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[16].w) {
+            mask += dot(acc, node_params[48]);
+        } else {
+            acc = mix(acc, tmp, node_params[16].x);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[48].x);
+        break;
+    default:
+        break;
+    }
+    // node 273
+    switch (node_ops[17][1]) {
+    case 0:
+        acc = max(acc, node_params[17]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[17].w) {
+            acc = max(acc, node_params[51]) - tmp * 0.5;
+        } else {
+            acc = clamp(acc + node_params[21], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[55] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 274
+    switch (node_ops[18][2]) {
+    case 0:
+        mask += dot(acc, node_params[18]);
+        break;
+    case 1:
+        if (acc.x > node_params[18].w) {
+            acc = mix(acc, tmp, node_params[54].x);
+        } else {
+            acc = max(acc, node_params[26]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[62] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 275
+    switch (node_ops[19][3]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[19].x);
+        break;
+    case 1:
+        if (acc.x > node_params[19].w) {
+            acc = acc * node_params[57] + tmp;
+        } else {
+            mask += dot(acc, node_params[31]);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[5].x);
+        break;
+    default:
+        break;
+    }
+    // node 276
+    switch (node_ops[20][0]) {
+    case 0:
+        acc = max(acc, node_params[20]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[20].w) {
+            acc = acc * node_params[60] + tmp;
+        } else {
+            acc = clamp(acc + node_params[36], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[12] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 277
+    switch (node_ops[21][1]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[21].x);
+        break;
+    case 1:
+        if (acc.x > node_params[21].w) {
+            acc = max(acc, node_params[63]) - tmp * 0.5;
+        } else {
+            acc = max(acc, node_params[41]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[19], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 278
+    switch (node_ops[22][2]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[22];
+        break;
+    case 1:
+        if (acc.x > node_params[22].w) {
+            acc = clamp(acc + node_params[2], 0.0, 1.0);
+        } else {
+            acc = acc * node_params[46] + tmp;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[26] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 279
+    switch (node_ops[23][3]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[23].x);
+        break;
+    case 1:
+        if (acc.x > node_params[23].w) {
+            tmp = tmp.yzwx * node_params[5];
+        } else {
+            acc = mix(acc, tmp, node_params[51].x);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[33].x);
+        break;
+    default:
+        break;
+    }
+    // node 280
+    switch (node_ops[24][0]) {
+    case 0:
+        acc = clamp(acc + node_params[24], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[24].w) {
+            mask += dot(acc, node_params[8]);
+        } else {
+            acc = clamp(acc + node_params[56], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[40]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 281
+    switch (node_ops[25][1]) {
+    case 0:
+        acc = acc * node_params[25] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[25].w) {
+            tmp = tmp.yzwx * node_params[11];
+        } else {
+            acc = clamp(acc + node_params[61], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[47], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 282
+    switch (node_ops[26][2]) {
+    case 0:
+        acc = max(acc, node_params[26]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[26].w) {
+            tmp = tmp.yzwx * node_params[14];
+        } else {
+            tmp = tmp.yzwx * node_params[2];
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[54]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 283
+    switch (node_ops[27][3]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[27].x);
+        break;
+    case 1:
+        if (acc.x > node_params[27].w) {
+            acc = acc * node_params[17] + tmp;
+        } else {
+            acc = acc * node_params[7] + tmp;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[61] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 284
+    switch (node_ops[28][0]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[28];
+        break;
+    case 1:
+        if (acc.x > node_params[28].w) {
+            acc = acc * node_params[20] + tmp;
+        } else {
+            tmp = tmp.yzwx * node_params[12];
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[4]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 285
+    switch (node_ops[29][1]) {
+    case 0:
+        acc = acc * node_params[29] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[29].w) {
+            mask += dot(acc, node_params[23]);
+        } else {
+            acc = mix(acc, tmp, node_params[17].x);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[11]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 286
+    switch (node_ops[30][2]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[30];
+        break;
+    case 1:
+        if (acc.x > node_params[30].w) {
+            tmp = tmp.yzwx * node_params[26];
+        } else {
+            acc = max(acc, node_params[22]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[18] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 287
+    switch (node_ops[31][3]) {
+    case 0:
+        acc = acc * node_params[31] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[31].w) {
+            acc = clamp(acc + node_params[29], 0.0, 1.0);
+        } else {
+            acc = max(acc, node_params[27]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[25].x);
+        break;
+    default:
+        break;
+    }
+    // node 288
+    switch (node_ops[32][0]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[32];
+        break;
+    case 1:
+        if (acc.x > node_params[32].w) {
+            mask += dot(acc, node_params[32]);
+        } else {
+            acc = max(acc, node_params[32]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[32].x);
+        break;
+    default:
+        break;
+    }
+    // node 289
+    switch (node_ops[33][1]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[33];
+        break;
+    case 1:
+        if (acc.x > node_params[33].w) {
+            tmp = tmp.yzwx * node_params[35];
+        } else {
+            acc = clamp(acc + node_params[37], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[39]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 290
+    switch (node_ops[34][2]) {
+    case 0:
+        acc = acc * node_params[34] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[34].w) {
+            acc = clamp(acc + node_params[38], 0.0, 1.0);
+        } else {
+            acc = max(acc, node_params[42]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[46].x);
+        break;
+    default:
+        break;
+    }
+    // node 291
+    switch (node_ops[35][3]) {
+    case 0:
+        acc = clamp(acc + node_params[35], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[35].w) {
+            acc = max(acc, node_params[41]) - tmp * 0.5;
+        } else {
+            acc = acc * node_params[47] + tmp;
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[53]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 292
+    switch (node_ops[36][0]) {
+    case 0:
+        acc = acc * node_params[36] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[36].w) {
+            acc = max(acc, node_params[44]) - tmp * 0.5;
+        } else {
+            acc = acc * node_params[52] + tmp;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[60] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 293
+    switch (node_ops[37][1]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[37];
+        break;
+    case 1:
+        if (acc.x > node_params[37].w) {
+            acc = mix(acc, tmp, node_params[47].x);
+        } else {
+            acc = clamp(acc + node_params[57], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[3] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 294
+    switch (node_ops[38][2]) {
+    case 0:
+        mask += dot(acc, node_params[38]);
+        break;
+    case 1:
+        if (acc.x > node_params[38].w) {
+            tmp = tmp.yzwx * node_params[50];
+        } else {
+            tmp = tmp.yzwx * node_params[62];
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[10];
+        break;
+    default:
+        break;
+    }
+    // node 295
+    switch (node_ops[39][3]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[39];
+        break;
+    case 1:
+        if (acc.x > node_params[39].w) {
+            mask += dot(acc, node_params[53]);
+        } else {
+            acc = acc * node_params[3] + tmp;
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[17];
+        break;
+    default:
+        break;
+    }
+    // node 296
+    switch (node_ops[40][0]) {
+    case 0:
+        acc = clamp(acc + node_params[40], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[40].w) {
+            acc = clamp(acc + node_params[56], 0.0, 1.0);
+        } else {
+            acc = clamp(acc + node_params[8], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[24];
+        break;
+    default:
+        break;
+    }
+    // node 297
+    switch (node_ops[41][1]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[41];
+        break;
+    case 1:
+        if (acc.x > node_params[41].w) {
+            tmp = tmp.yzwx * node_params[59];
+        } else {
+            acc = acc * node_params[13] + tmp;
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[31], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 298
+    switch (node_ops[42][2]) {
+    case 0:
+        mask += dot(acc, node_params[42]);
+        break;
+    case 1:
+        if (acc.x > node_params[42].w) {
+            acc = clamp(acc + node_params[62], 0.0, 1.0);
+        } else {
+            acc = acc * node_params[18] + tmp;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[38] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 299
+    switch (node_ops[43][3]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[43].x);
+        break;
+    case 1:
+        if (acc.x > node_params[43].w) {
+            acc = acc * node_params[1] + tmp;
+        } else {
+            acc = max(acc, node_params[23]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[45], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 300
+    switch (node_ops[44][0]) {
+    case 0:
+        acc = max(acc, node_params[44]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[44].w) {
+            acc = max(acc, node_params[4]) - tmp * 0.5;
+        } else {
+            tmp = tmp.yzwx * node_params[28];
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[52]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 301
+    switch (node_ops[45][1]) {
+    case 0:
+        acc = max(acc, node_params[45]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[45].w) {
+            acc = mix(acc, tmp, node_params[7].x);
+        } else {
+            acc = max(acc, node_params[33]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[59].x);
+        break;
+    default:
+        break;
+    }
+    // node 302
+    switch (node_ops[46][2]) {
+    case 0:
+        acc = acc * node_params[46] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[46].w) {
+            acc = clamp(acc + node_params[10], 0.0, 1.0);
+        } else {
+            tmp = tmp.yzwx * node_params[38];
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[2], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 303
+    switch (node_ops[47][3]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[47].x);
+        break;
+    case 1:
+        if (acc.x > node_params[47].w) {
+            mask += dot(acc, node_params[13]);
+        } else {
+            acc = mix(acc, tmp, node_params[43].x);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[9];
+        break;
+    default:
+        break;
+    }
+    // node 304
+    switch (node_ops[48][0]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[48];
+        break;
+    case 1:
+        if (acc.x > node_params[48].w) {
+            acc = max(acc, node_params[16]) - tmp * 0.5;
+        } else {
+            tmp = tmp.yzwx * node_params[48];
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[16]);
+        break;
+    default:
+        break;
+    }
+    // node 305
+    switch (node_ops[49][1]) {
+    case 0:
+        acc = acc * node_params[49] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[49].w) {
+            mask += dot(acc, node_params[19]);
+        } else {
+            acc = mix(acc, tmp, node_params[53].x);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[23]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 306
+    switch (node_ops[50][2]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[50].x);
+        break;
+    case 1:
+        if (acc.x > node_params[50].w) {
+            acc = mix(acc, tmp, node_params[22].x);
+        } else {
+            acc = max(acc, node_params[58]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[30] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 307
+    switch (node_ops[51][3]) {
+    case 0:
+        acc = clamp(acc + node_params[51], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[51].w) {
+            acc = acc * node_params[25] + tmp;
+        } else {
+            acc = max(acc, node_params[63]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[37]);
+        break;
+    default:
+        break;
+    }
+    // node 308
+    switch (node_ops[52][0]) {
+    case 0:
+        mask += dot(acc, node_params[52]);
+        break;
+    case 1:
+        if (acc.x > node_params[52].w) {
+            tmp = tmp.yzwx * node_params[28];
+        } else {
+            acc = mix(acc, tmp, node_params[4].x);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[44]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 309
+    switch (node_ops[53][1]) {
+    case 0:
+        acc = acc * node_params[53] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[53].w) {
+            acc = acc * node_params[31] + tmp;
+        } else {
+            tmp = tmp.yzwx * node_params[9];
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[51]);
+        break;
+    default:
+        break;
+    }
+    // node 310
+    switch (node_ops[54][2]) {
+    case 0:
+        acc = acc * node_params[54] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[54].w) {
+            acc = mix(acc, tmp, node_params[34].x);
+        } else {
+            acc = acc * node_params[14] + tmp;
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[58]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 311
+    switch (node_ops[55][3]) {
+    case 0:
+        acc = max(acc, node_params[55]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[55].w) {
+            acc = clamp(acc + node_params[37], 0.0, 1.0);
+        } else {
+            acc = max(acc, node_params[19]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[1].x);
+        break;
+    default:
+        break;
+    }
+    // node 312
+    switch (node_ops[56][0]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[56].x);
+        break;
+    case 1:
+        if (acc.x > node_params[56].w) {
+            acc = mix(acc, tmp, node_params[40].x);
+        } else {
+            acc = max(acc, node_params[24]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[8]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 313
+    switch (node_ops[57][1]) {
+    case 0:
+        mask += dot(acc, node_params[57]);
+        break;
+    case 1:
+        if (acc.x > node_params[57].w) {
+            acc = clamp(acc + node_params[43], 0.0, 1.0);
+        } else {
+            acc = mix(acc, tmp, node_params[29].x);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[15], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 314
+    switch (node_ops[58][2]) {
+    case 0:
+        mask += dot(acc, node_params[58]);
+        break;
+    case 1:
+        if (acc.x > node_params[58].w) {
+            acc = clamp(acc + node_params[46], 0.0, 1.0);
+        } else {
+            acc = acc * node_params[34] + tmp;
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[22];
+        break;
+    default:
+        break;
+    }
+    // node 315
+    switch (node_ops[59][3]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[59];
+        break;
+    case 1:
+        if (acc.x > node_params[59].w) {
+            tmp = tmp.yzwx * node_params[49];
+        } else {
+            mask += dot(acc, node_params[39]);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[29];
+        break;
+    default:
+        break;
+    }
+    // node 316
+    switch (node_ops[60][0]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[60];
+        break;
+    case 1:
+        if (acc.x > node_params[60].w) {
+            tmp = tmp.yzwx * node_params[52];
+        } else {
+            acc = clamp(acc + node_params[44], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[36];
+        break;
+    default:
+        break;
+    }
+    // node 317
+    switch (node_ops[61][1]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[61].x);
+        break;
+    case 1:
+        if (acc.x > node_params[61].w) {
+            acc = max(acc, node_params[55]) - tmp * 0.5;
+        } else {
+            acc = mix(acc, tmp, node_params[49].x);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[43].x);
+        break;
+    default:
+        break;
+    }
+    // node 318
+    switch (node_ops[62][2]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[62].x);
+        break;
+    case 1:
+        if (acc.x > node_params[62].w) {
+            acc = mix(acc, tmp, node_params[58].x);
+        } else {
+            acc = mix(acc, tmp, node_params[54].x);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[50];
+        break;
+    default:
+        break;
+    }
+    // node 319
+    switch (node_ops[63][3]) {
+    case 0:
+        mask += dot(acc, node_params[63]);
+        break;
+    case 1:
+        if (acc.x > node_params[63].w) {
+            acc = mix(acc, tmp, node_params[61].x);
+        } else {
+            tmp = tmp.yzwx * node_params[59];
+        }
+        break;
+    case 2:
+        acc = acc * node_params[57] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 320
+    switch (node_ops[0][0]) {
+    case 0:
+        acc = max(acc, node_params[0]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[0].w) {
+            tmp = tmp.yzwx * node_params[0];
+        } else {
+            acc = mix(acc, tmp, node_params[0].x);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[0]);
+        break;
+    default:
+        break;
+    }
+    // node 321
+    switch (node_ops[1][1]) {
+    case 0:
+        mask += dot(acc, node_params[1]);
+        break;
+    case 1:
+        if (acc.x > node_params[1].w) {
+            acc = mix(acc, tmp, node_params[3].x);
+        } else {
+            acc = clamp(acc + node_params[5], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[7] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 322
+    switch (node_ops[2][2]) {
+    case 0:
+        acc = clamp(acc + node_params[2], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[2].w) {
+            acc = max(acc, node_params[6]) - tmp * 0.5;
+        } else {
+            acc = acc * node_params[10] + tmp;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[14] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 323
+    switch (node_ops[3][3]) {
+    case 0:
+        acc = acc * node_params[3] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[3].w) {
+            acc = max(acc, node_params[9]) - tmp * 0.5;
+        } else {
+            acc = mix(acc, tmp, node_params[15].x);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[21]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 324
+    switch (node_ops[4][0]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[4];
+        break;
+    case 1:
+        if (acc.x > node_params[4].w) {
+            acc = acc * node_params[12] + tmp;
+        } else {
+            tmp = tmp.yzwx * node_params[20];
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[28].x);
+        break;
+    default:
+        break;
+    }
+    // node 325
+    switch (node_ops[5][1]) {
+    case 0:
+        acc = acc * node_params[5] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[5].w) {
+            acc = acc * node_params[15] + tmp;
+        } else {
+            acc = mix(acc, tmp, node_params[25].x);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[35]);
+        break;
+    default:
+        break;
+    }
+    // node 326
+    switch (node_ops[6][2]) {
+    case 0:
+        mask += dot(acc, node_params[6]);
+        break;
+    case 1:
+        if (acc.x > node_params[6].w) {
+            acc = mix(acc, tmp, node_params[18].x);
+        } else {
+            acc = acc * node_params[30] + tmp;
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[42];
+        break;
+    default:
+        break;
+    }
+    // node 327
+    switch (node_ops[7][3]) {
+    case 0:
+        mask += dot(acc, node_params[7]);
+        break;
+    case 1:
+        if (acc.x > node_params[7].w) {
+            acc = mix(acc, tmp, node_params[21].x);
+        } else {
+            acc = max(acc, node_params[35]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[49]);
+        break;
+    default:
+        break;
+    }
+    // node 328
+    switch (node_ops[8][0]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[8];
+        break;
+    case 1:
+        if (acc.x > node_params[8].w) {
+            acc = clamp(acc + node_params[24], 0.0, 1.0);
+        } else {
+            acc = acc * node_params[40] + tmp;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[56] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 329
+    switch (node_ops[9][1]) {
+    case 0:
+        acc = clamp(acc + node_params[9], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[9].w) {
+            mask += dot(acc, node_params[27]);
+        } else {
+            acc = clamp(acc + node_params[45], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[63]);
+        break;
+    default:
+        break;
+    }
+    // node 330
+    switch (node_ops[10][2]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[10];
+        break;
+    case 1:
+        if (acc.x > node_params[10].w) {
+            acc = mix(acc, tmp, node_params[30].x);
+        } else {
+            acc = acc * node_params[50] + tmp;
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[6];
+        break;
+    default:
+        break;
+    }
+    // node 331
+    switch (node_ops[11][3]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[11];
+        break;
+    case 1:
+        if (acc.x > node_params[11].w) {
+            acc = mix(acc, tmp, node_params[33].x);
+        } else {
+            acc = acc * node_params[55] + tmp;
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[13].x);
+        break;
+    default:
+        break;
+    }
+    // node 332
+    switch (node_ops[12][0]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[12];
+        break;
+    case 1:
+        if (acc.x > node_params[12].w) {
+            acc = acc * node_params[36] + tmp;
+        } else {
+            mask += dot(acc, node_params[60]);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[20], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 333
+    switch (node_ops[13][1]) {
+    case 0:
+        acc = clamp(acc + node_params[13], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[13].w) {
+            acc = mix(acc, tmp, node_params[39].x);
+        } else {
+            acc = acc * node_params[1] + tmp;
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[27];
+        break;
+    default:
+        break;
+    }
+    // node 334
+    switch (node_ops[14][2]) {
+    case 0:
+        acc = max(acc, node_params[14]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[14].w) {
+            acc = clamp(acc + node_params[42], 0.0, 1.0);
+        } else {
+            tmp = tmp.yzwx * node_params[6];
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[34].x);
+        break;
+    default:
+        break;
+    }
+    // node 335
+    switch (node_ops[15][3]) {
+    case 0:
+        mask += dot(acc, node_params[15]);
+        break;
+    case 1:
+        if (acc.x > node_params[15].w) {
+            tmp = tmp.yzwx * node_params[45];
+        } else {
+            acc = acc * node_params[11] + tmp;
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[41].x);
+        break;
+    default:
+        break;
+    }
+    // node 336
+    switch (node_ops[16][0]) {
+    case 0:
+        acc = acc * node_params[16] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[16].w) {
+            acc = max(acc, node_params[48]) - tmp * 0.5;
+        } else {
+            mask += dot(acc, node_params[16]);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[48]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 337
+    switch (node_ops[17][1]) {
+    case 0:
+        acc = acc * node_params[17] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[17].w) {
+            acc = max(acc, node_params[51]) - tmp * 0.5;
+        } else {
+            acc = acc * node_params[21] + tmp;
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[55]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 338
+    switch (node_ops[18][2]) {
+    case 0:
+        acc = clamp(acc + node_params[18], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[18].w) {
+            mask += dot(acc, node_params[54]);
+        } else {
+            acc = mix(acc, tmp, node_params[26].x);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[62], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 339
+    switch (node_ops[19][3]) {
+    case 0:
+        mask += dot(acc, node_params[19]);
+        break;
+    case 1:
+        if (acc.x > node_params[19].w) {
+            acc = acc * node_params[57] + tmp;
+        } else {
+            acc = clamp(acc + node_params[31], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[5].x);
+        break;
+    default:
+        break;
+    }
+    // node 340
+    switch (node_ops[20][0]) {
+    case 0:
+        acc = max(acc, node_params[20]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[20].w) {
+            acc = clamp(acc + node_params[60], 0.0, 1.0);
+        } else {
+            tmp = tmp.yzwx * node_params[36];
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[12]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 341
+    switch (node_ops[21][1]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[21];
+        break;
+    case 1:
+        if (acc.x > node_params[21].w) {
+            acc = clamp(acc + node_params[63], 0.0, 1.0);
+        } else {
+            tmp = tmp.yzwx * node_params[41];
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[19]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 342
+    switch (node_ops[22][2]) {
+    case 0:
+        acc = acc * node_params[22] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[22].w) {
+            tmp = tmp.yzwx * node_params[2];
+        } else {
+            acc = clamp(acc + node_params[46], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[26]);
+        break;
+    default:
+        break;
+    }
+    // node 343
+    switch (node_ops[23][3]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[23];
+        break;
+    case 1:
+        if (acc.x > node_params[23].w) {
+            acc = max(acc, node_params[5]) - tmp * 0.5;
+        } else {
+            acc = max(acc, node_params[51]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[33] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 344
+    switch (node_ops[24][0]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[24];
+        break;
+    case 1:
+        if (acc.x > node_params[24].w) {
+            acc = clamp(acc + node_params[8], 0.0, 1.0);
+        } else {
+            acc = mix(acc, tmp, node_params[56].x);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[40]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 345
+    switch (node_ops[25][1]) {
+    case 0:
+        acc = clamp(acc + node_params[25], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[25].w) {
+            acc = max(acc, node_params[11]) - tmp * 0.5;
+        } else {
+            acc = mix(acc, tmp, node_params[61].x);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[47] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 346
+    switch (node_ops[26][2]) {
+    case 0:
+        acc = max(acc, node_params[26]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[26].w) {
+            acc = mix(acc, tmp, node_params[14].x);
+        } else {
+            acc = max(acc, node_params[2]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[54] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 347
+    switch (node_ops[27][3]) {
+    case 0:
+        acc = acc * node_params[27] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[27].w) {
+            acc = max(acc, node_params[17]) - tmp * 0.5;
+        } else {
+            mask += dot(acc, node_params[7]);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[61];
+        break;
+    default:
+        break;
+    }
+    // node 348
+    switch (node_ops[28][0]) {
+    case 0:
+        acc = max(acc, node_params[28]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[28].w) {
+            acc = mix(acc, tmp, node_params[20].x);
+        } else {
+            acc = mix(acc, tmp, node_params[12].x);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[4] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 349
+    switch (node_ops[29][1]) {
+    case 0:
+        acc = acc * node_params[29] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[29].w) {
+            mask += dot(acc, node_params[23]);
+        } else {
+            acc = mix(acc, tmp, node_params[17].x);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[11], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 350
+    switch (node_ops[30][2]) {
+    case 0:
+        acc = max(acc, node_params[30]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[30].w) {
+            acc = acc * node_params[26] + tmp;
+        } else {
+            mask += dot(acc, node_params[22]);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[18]);
+        break;
+    default:
+        break;
+    }
+    // node 351
+    switch (node_ops[31][3]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[31];
+        break;
+    case 1:
+        if (acc.x > node_params[31].w) {
+            acc = clamp(acc + node_params[29], 0.0, 1.0);
+        } else {
+            mask += dot(acc, node_params[27]);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[25].x);
+        break;
+    default:
+        break;
+    }
+    // node 352
+    switch (node_ops[32][0]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[32].x);
+        break;
+    case 1:
+        if (acc.x > node_params[32].w) {
+            tmp = tmp.yzwx * node_params[32];
+        } else {
+            tmp = tmp.yzwx * node_params[32];
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[32].x);
+        break;
+    default:
+        break;
+    }
+    // node 353
+    switch (node_ops[33][1]) {
+    case 0:
+        mask += dot(acc, node_params[33]);
+        break;
+    case 1:
+        if (acc.x > node_params[33].w) {
+            acc = mix(acc, tmp, node_params[35].x);
+        } else {
+            acc = acc * node_params[37] + tmp;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[39] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 354
+    switch (node_ops[34][2]) {
+    case 0:
+        acc = max(acc, node_params[34]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[34].w) {
+            acc = max(acc, node_params[38]) - tmp * 0.5;
+        } else {
+            acc = mix(acc, tmp, node_params[42].x);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[46];
+        break;
+    default:
+        break;
+    }
+    // node 355
+    switch (node_ops[35][3]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[35].x);
+        break;
+    case 1:
+        if (acc.x > node_params[35].w) {
+            acc = acc * node_params[41] + tmp;
+        } else {
+            acc = max(acc, node_params[47]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[53];
+        break;
+    default:
+        break;
+    }
+    // node 356
+    switch (node_ops[36][0]) {
+    case 0:
+        acc = acc * node_params[36] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[36].w) {
+            mask += dot(acc, node_params[44]);
+        } else {
+            acc = clamp(acc + node_params[52], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[60]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 357
+    switch (node_ops[37][1]) {
+    case 0:
+        acc = acc * node_params[37] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[37].w) {
+            acc = clamp(acc + node_params[47], 0.0, 1.0);
+        } else {
+            mask += dot(acc, node_params[57]);
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[3], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 358
+    switch (node_ops[38][2]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[38].x);
+        break;
+    case 1:
+        if (acc.x > node_params[38].w) {
+            acc = clamp(acc + node_params[50], 0.0, 1.0);
+        } else {
+            acc = mix(acc, tmp, node_params[62].x);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[10]);
+        break;
+    default:
+        break;
+    }
+    // node 359
+    switch (node_ops[39][3]) {
+    case 0:
+        acc = max(acc, node_params[39]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[39].w) {
+            mask += dot(acc, node_params[53]);
+        } else {
+            acc = mix(acc, tmp, node_params[3].x);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[17]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 360
+    switch (node_ops[40][0]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[40].x);
+        break;
+    case 1:
+        if (acc.x > node_params[40].w) {
+            mask += dot(acc, node_params[56]);
+        } else {
+            acc = mix(acc, tmp, node_params[8].x);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[24] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 361
+    switch (node_ops[41][1]) {
+    case 0:
+        acc = max(acc, node_params[41]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[41].w) {
+            mask += dot(acc, node_params[59]);
+        } else {
+            acc = mix(acc, tmp, node_params[13].x);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[31]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 362
+    switch (node_ops[42][2]) {
+    case 0:
+        tmp = tmp.yzwx * node_params[42];
+        break;
+    case 1:
+        if (acc.x > node_params[42].w) {
+            acc = acc * node_params[62] + tmp;
+        } else {
+            acc = mix(acc, tmp, node_params[18].x);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[38].x);
+        break;
+    default:
+        break;
+    }
+    // node 363
+    switch (node_ops[43][3]) {
+    case 0:
+        acc = clamp(acc + node_params[43], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[43].w) {
+            acc = mix(acc, tmp, node_params[1].x);
+        } else {
+            acc = acc * node_params[23] + tmp;
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[45]);
+        break;
+    default:
+        break;
+    }
+    // node 364
+    switch (node_ops[44][0]) {
+    case 0:
+        acc = clamp(acc + node_params[44], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[44].w) {
+            acc = acc * node_params[4] + tmp;
+        } else {
+            acc = clamp(acc + node_params[28], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[52];
+        break;
+    default:
+        break;
+    }
+    // node 365
+    switch (node_ops[45][1]) {
+    case 0:
+        acc = acc * node_params[45] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[45].w) {
+            acc = max(acc, node_params[7]) - tmp * 0.5;
+        } else {
+            mask += dot(acc, node_params[33]);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[59]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 366
+    switch (node_ops[46][2]) {
+    case 0:
+        mask += dot(acc, node_params[46]);
+        break;
+    case 1:
+        if (acc.x > node_params[46].w) {
+            acc = clamp(acc + node_params[10], 0.0, 1.0);
+        } else {
+            tmp = tmp.yzwx * node_params[38];
+        }
+        break;
+    case 2:
+        acc = clamp(acc + node_params[2], 0.0, 1.0);
+        break;
+    default:
+        break;
+    }
+    // node 367
+    switch (node_ops[47][3]) {
+    case 0:
+        acc = max(acc, node_params[47]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[47].w) {
+            tmp = tmp.yzwx * node_params[13];
+        } else {
+            mask += dot(acc, node_params[43]);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[9].x);
+        break;
+    default:
+        break;
+    }
+    // node 368
+    switch (node_ops[48][0]) {
+    case 0:
+        acc = max(acc, node_params[48]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[48].w) {
+            acc = max(acc, node_params[16]) - tmp * 0.5;
+        } else {
+            acc = clamp(acc + node_params[48], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[16];
+        break;
+    default:
+        break;
+    }
+    // node 369
+    switch (node_ops[49][1]) {
+    case 0:
+        acc = max(acc, node_params[49]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[49].w) {
+            mask += dot(acc, node_params[19]);
+        } else {
+            acc = max(acc, node_params[53]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[23].x);
+        break;
+    default:
+        break;
+    }
+    // node 370
+    switch (node_ops[50][2]) {
+    case 0:
+        acc = acc * node_params[50] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[50].w) {
+            acc = acc * node_params[22] + tmp;
+        } else {
+            mask += dot(acc, node_params[58]);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[30]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 371
+    switch (node_ops[51][3]) {
+    case 0:
+        acc = max(acc, node_params[51]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[51].w) {
+            acc = mix(acc, tmp, node_params[25].x);
+        } else {
+            acc = max(acc, node_params[63]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[37]);
+        break;
+    default:
+        break;
+    }
+    // node 372
+    switch (node_ops[52][0]) {
+    case 0:
+        acc = max(acc, node_params[52]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[52].w) {
+            acc = mix(acc, tmp, node_params[28].x);
+        } else {
+            acc = max(acc, node_params[4]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[44]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 373
+    switch (node_ops[53][1]) {
+    case 0:
+        acc = acc * node_params[53] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[53].w) {
+            acc = acc * node_params[31] + tmp;
+        } else {
+            acc = mix(acc, tmp, node_params[9].x);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[51];
+        break;
+    default:
+        break;
+    }
+    // node 374
+    switch (node_ops[54][2]) {
+    case 0:
+        acc = max(acc, node_params[54]) - tmp * 0.5;
+        break;
+    case 1:
+        if (acc.x > node_params[54].w) {
+            tmp = tmp.yzwx * node_params[34];
+        } else {
+            acc = acc * node_params[14] + tmp;
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[58]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 375
+    switch (node_ops[55][3]) {
+    case 0:
+        mask += dot(acc, node_params[55]);
+        break;
+    case 1:
+        if (acc.x > node_params[55].w) {
+            mask += dot(acc, node_params[37]);
+        } else {
+            acc = clamp(acc + node_params[19], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[1] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 376
+    switch (node_ops[56][0]) {
+    case 0:
+        acc = acc * node_params[56] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[56].w) {
+            acc = clamp(acc + node_params[40], 0.0, 1.0);
+        } else {
+            acc = mix(acc, tmp, node_params[24].x);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[8] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 377
+    switch (node_ops[57][1]) {
+    case 0:
+        acc = clamp(acc + node_params[57], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[57].w) {
+            tmp = tmp.yzwx * node_params[43];
+        } else {
+            acc = clamp(acc + node_params[29], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        mask += dot(acc, node_params[15]);
+        break;
+    default:
+        break;
+    }
+    // node 378
+    switch (node_ops[58][2]) {
+    case 0:
+        acc = acc * node_params[58] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[58].w) {
+            acc = acc * node_params[46] + tmp;
+        } else {
+            mask += dot(acc, node_params[34]);
+        }
+        break;
+    case 2:
+        acc = max(acc, node_params[22]) - tmp * 0.5;
+        break;
+    default:
+        break;
+    }
+    // node 379
+    switch (node_ops[59][3]) {
+    case 0:
+        acc = clamp(acc + node_params[59], 0.0, 1.0);
+        break;
+    case 1:
+        if (acc.x > node_params[59].w) {
+            acc = mix(acc, tmp, node_params[49].x);
+        } else {
+            acc = acc * node_params[39] + tmp;
+        }
+        break;
+    case 2:
+        acc = acc * node_params[29] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 380
+    switch (node_ops[60][0]) {
+    case 0:
+        mask += dot(acc, node_params[60]);
+        break;
+    case 1:
+        if (acc.x > node_params[60].w) {
+            acc = clamp(acc + node_params[52], 0.0, 1.0);
+        } else {
+            acc = clamp(acc + node_params[44], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = acc * node_params[36] + tmp;
+        break;
+    default:
+        break;
+    }
+    // node 381
+    switch (node_ops[61][1]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[61].x);
+        break;
+    case 1:
+        if (acc.x > node_params[61].w) {
+            acc = mix(acc, tmp, node_params[55].x);
+        } else {
+            acc = max(acc, node_params[49]) - tmp * 0.5;
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[43];
+        break;
+    default:
+        break;
+    }
+    // node 382
+    switch (node_ops[62][2]) {
+    case 0:
+        acc = mix(acc, tmp, node_params[62].x);
+        break;
+    case 1:
+        if (acc.x > node_params[62].w) {
+            acc = clamp(acc + node_params[58], 0.0, 1.0);
+        } else {
+            acc = clamp(acc + node_params[54], 0.0, 1.0);
+        }
+        break;
+    case 2:
+        acc = mix(acc, tmp, node_params[50].x);
+        break;
+    default:
+        break;
+    }
+    // node 383
+    switch (node_ops[63][3]) {
+    case 0:
+        acc = acc * node_params[63] + tmp;
+        break;
+    case 1:
+        if (acc.x > node_params[63].w) {
+            tmp = tmp.yzwx * node_params[61];
+        } else {
+            mask += dot(acc, node_params[59]);
+        }
+        break;
+    case 2:
+        tmp = tmp.yzwx * node_params[57];
+        break;
+    default:
+        break;
+    }
+    frag_color = acc + vec4(mask * 0.001);
+}
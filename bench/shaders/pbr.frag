@@ -0,0 +1,168 @@
+#version 450
+
+precision highp float;
+
+#ifndef NUM_LIGHTS
+#define NUM_LIGHTS 4
+#endif
+
+#define PI 3.14159265359
+
+layout (location = TEXCOORD0) in vec2 f_uv;
+layout (location = TEXCOORD1) in vec3 f_world_pos;
+layout (location = NORMAL)    in vec3 f_normal;
+#ifdef HAS_NORMAL_MAP
+layout (location = TANGENT)   in vec3 f_tangent;
+layout (location = BINORMAL)  in vec3 f_bitangent;
+#endif
+#ifdef HAS_SHADOWS
+layout (location = TEXCOORD2) in vec4 f_shadow_pos;
+#endif
+
+layout (location = SV_Target0) out vec4 frag_color;
+
+struct light_t {
+    vec4 pos_radius;
+    vec4 color_intensity;
+    vec4 dir_spot;
+};
+
+layout (binding = 2, std140) uniform per_material {
+    vec4 albedo_factor;
+    vec4 emissive_factor;
+    vec4 metal_rough_ao;
+};
+
+layout (binding = 3, std140) uniform lights {
+    light_t light[NUM_LIGHTS];
+    vec4 ambient;
+    vec4 camera;
+};
+
+layout (binding = 0) uniform sampler2D tex_albedo;
+layout (binding = 1) uniform sampler2D tex_metal_rough;
+#ifdef HAS_NORMAL_MAP
+layout (binding = 2) uniform sampler2D tex_normal;
+#endif
+#ifdef HAS_EMISSIVE
+layout (binding = 3) uniform sampler2D tex_emissive;
+#endif
+#ifdef HAS_SHADOWS
+layout (binding = 4) uniform sampler2DShadow tex_shadow;
+#endif
+#ifdef HAS_IBL
+layout (binding = 5) uniform samplerCube tex_irradiance;
+layout (binding = 6) uniform samplerCube tex_prefiltered;
+layout (binding = 7) uniform sampler2D tex_brdf_lut;
+#endif
+
+float distribution_ggx(vec3 n, vec3 h, float roughness)
+{
+    float a = roughness * roughness;
+    float a2 = a * a;
+    float ndoth = max(dot(n, h), 0.0);
+    float denom = ndoth * ndoth * (a2 - 1.0) + 1.0;
+    return a2 / (PI * denom * denom);
+}
+
+float geometry_schlick_ggx(float ndotv, float roughness)
+{
+    float r = roughness + 1.0;
+    float k = (r * r) / 8.0;
+    return ndotv / (ndotv * (1.0 - k) + k);
+}
+
+float geometry_smith(vec3 n, vec3 v, vec3 l, float roughness)
+{
+    return geometry_schlick_ggx(max(dot(n, v), 0.0), roughness) *
+           geometry_schlick_ggx(max(dot(n, l), 0.0), roughness);
+}
+
+vec3 fresnel_schlick(float cos_theta, vec3 f0)
+{
+    return f0 + (1.0 - f0) * pow(clamp(1.0 - cos_theta, 0.0, 1.0), 5.0);
+}
+
+vec3 fresnel_schlick_roughness(float cos_theta, vec3 f0, float roughness)
+{
+    return f0 + (max(vec3(1.0 - roughness), f0) - f0) * pow(clamp(1.0 - cos_theta, 0.0, 1.0), 5.0);
+}
+
+#ifdef HAS_SHADOWS
+float calc_shadow(vec4 shadow_pos)
+{
+    vec3 p = shadow_pos.xyz / shadow_pos.w;
+    p = p * 0.5 + 0.5;
+    float s = 0.0;
+    for (int y = -1; y <= 1; y++) {
+        for (int x = -1; x <= 1; x++) {
+            s += texture(tex_shadow, vec3(p.xy + vec2(x, y) * (1.0 / 2048.0), p.z - 0.001));
+        }
+    }
+    return s / 9.0;
+}
+#endif
+
+void main()
+{
+    vec4 albedo = texture(tex_albedo, f_uv) * albedo_factor;
+    vec3 mr = texture(tex_metal_rough, f_uv).rgb;
+    float metallic = mr.b * metal_rough_ao.x;
+    float roughness = mr.g * metal_rough_ao.y;
+    float ao = metal_rough_ao.z;
+
+#ifdef HAS_NORMAL_MAP
+    vec3 tn = texture(tex_normal, f_uv).xyz * 2.0 - 1.0;
+    vec3 n = normalize(mat3(f_tangent, f_bitangent, f_normal) * tn);
+#else
+    vec3 n = normalize(f_normal);
+#endif
+    vec3 v = normalize(camera.xyz - f_world_pos);
+    vec3 f0 = mix(vec3(0.04), albedo.rgb, metallic);
+
+    vec3 lo = vec3(0.0);
+    for (int i = 0; i < NUM_LIGHTS; i++) {
+        vec3 ldir = light[i].pos_radius.xyz - f_world_pos;
+        float dist = length(ldir);
+        vec3 l = ldir / dist;
+        vec3 h = normalize(v + l);
+        float atten = clamp(1.0 - dist / light[i].pos_radius.w, 0.0, 1.0);
+        atten *= atten;
+        float spot = dot(-l, light[i].dir_spot.xyz);
+        atten *= smoothstep(light[i].dir_spot.w, light[i].dir_spot.w + 0.05, spot);
+        vec3 radiance = light[i].color_intensity.rgb * light[i].color_intensity.w * atten;
+
+        float ndf = distribution_ggx(n, h, roughness);
+        float g = geometry_smith(n, v, l, roughness);
+        vec3 f = fresnel_schlick(max(dot(h, v), 0.0), f0);
+
+        vec3 spec = (ndf * g * f) / (4.0 * max(dot(n, v), 0.0) * max(dot(n, l), 0.0) + 0.0001);
+        vec3 kd = (vec3(1.0) - f) * (1.0 - metallic);
+        lo += (kd * albedo.rgb / PI + spec) * radiance * max(dot(n, l), 0.0);
+    }
+
+#ifdef HAS_SHADOWS
+    lo *= calc_shadow(f_shadow_pos);
+#endif
+
+#ifdef HAS_IBL
+    vec3 fa = fresnel_schlick_roughness(max(dot(n, v), 0.0), f0, roughness);
+    vec3 kd = (1.0 - fa) * (1.0 - metallic);
+    vec3 diffuse = texture(tex_irradiance, n).rgb * albedo.rgb;
+    vec3 r = reflect(-v, n);
+    vec3 prefiltered = textureLod(tex_prefiltered, r, roughness * 4.0).rgb;
+    vec2 brdf = texture(tex_brdf_lut, vec2(max(dot(n, v), 0.0), roughness)).rg;
+    vec3 ambient_color = (kd * diffuse + prefiltered * (fa * brdf.x + brdf.y)) * ao;
+#else
+    vec3 ambient_color = ambient.rgb * albedo.rgb * ao;
+#endif
+
+    vec3 color = ambient_color + lo;
+#ifdef HAS_EMISSIVE
+    color += texture(tex_emissive, f_uv).rgb * emissive_factor.rgb;
+#endif
+
+    color = color / (color + vec3(1.0));
+    color = pow(color, vec3(1.0 / 2.2));
+    frag_color = vec4(color, albedo.a);
+}
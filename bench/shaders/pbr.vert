@@ -0,0 +1,72 @@
+#version 450
+
+layout (location = POSITION)  in vec3 a_pos;
+layout (location = NORMAL)    in vec3 a_normal;
+layout (location = TEXCOORD0) in vec2 a_uv;
+#ifdef HAS_NORMAL_MAP
+layout (location = TANGENT)   in vec4 a_tangent;
+#endif
+#ifdef HAS_SKINNING
+layout (location = BLENDINDICES) in vec4 a_indices;
+layout (location = BLENDWEIGHT)  in vec4 a_weights;
+#endif
+
+layout (location = TEXCOORD0) out vec2 f_uv;
+layout (location = TEXCOORD1) out vec3 f_world_pos;
+layout (location = NORMAL)    out vec3 f_normal;
+#ifdef HAS_NORMAL_MAP
+layout (location = TANGENT)   out vec3 f_tangent;
+layout (location = BINORMAL)  out vec3 f_bitangent;
+#endif
+#ifdef HAS_SHADOWS
+layout (location = TEXCOORD2) out vec4 f_shadow_pos;
+#endif
+
+layout (binding = 0, std140) uniform per_frame {
+    mat4 view_proj;
+    mat4 shadow_view_proj;
+    vec4 camera_pos;
+    vec4 time;
+};
+
+layout (binding = 1, std140) uniform per_object {
+    mat4 world;
+    mat4 world_normal;
+#ifdef HAS_SKINNING
+    mat4 bones[64];
+#endif
+};
+
+void main()
+{
+    vec4 pos = vec4(a_pos, 1.0);
+    vec3 normal = a_normal;
+#ifdef HAS_NORMAL_MAP
+    vec3 tangent = a_tangent.xyz;
+#endif
+
+#ifdef HAS_SKINNING
+    mat4 skin = bones[int(a_indices.x)] * a_weights.x +
+                bones[int(a_indices.y)] * a_weights.y +
+                bones[int(a_indices.z)] * a_weights.z +
+                bones[int(a_indices.w)] * a_weights.w;
+    pos = skin * pos;
+    normal = mat3(skin) * normal;
+#   ifdef HAS_NORMAL_MAP
+    tangent = mat3(skin) * tangent;
+#   endif
+#endif
+
+    vec4 world_pos = world * pos;
+    f_world_pos = world_pos.xyz;
+    f_normal = normalize(mat3(world_normal) * normal);
+#ifdef HAS_NORMAL_MAP
+    f_tangent = normalize(mat3(world_normal) * tangent);
+    f_bitangent = cross(f_normal, f_tangent) * a_tangent.w;
+#endif
+#ifdef HAS_SHADOWS
+    f_shadow_pos = shadow_view_proj * world_pos;
+#endif
+    f_uv = a_uv;
+    gl_Position = view_proj * world_pos;
+}
@@ -0,0 +1,15 @@
+#version 450
+
+precision mediump float;
+
+layout (location = TEXCOORD0) in vec2 f_uv;
+layout (location = COLOR0)    in vec4 f_color;
+
+layout (location = SV_Target0) out vec4 frag_color;
+
+layout (binding = 0) uniform sampler2D tex_font;
+
+void main()
+{
+    frag_color = f_color * texture(tex_font, f_uv);
+}
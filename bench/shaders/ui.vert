@@ -0,0 +1,19 @@
+#version 450
+
+layout (location = POSITION)  in vec2 a_pos;
+layout (location = TEXCOORD0) in vec2 a_uv;
+layout (location = COLOR0)    in vec4 a_color;
+
+layout (location = TEXCOORD0) out vec2 f_uv;
+layout (location = COLOR0)    out vec4 f_color;
+
+layout (binding = 0, std140) uniform ui_params {
+    mat4 proj;
+};
+
+void main()
+{
+    gl_Position = proj * vec4(a_pos, 0.0, 1.0);
+    f_uv = a_uv;
+    f_color = a_color;
+}
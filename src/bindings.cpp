@@ -0,0 +1,202 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+#include "bindings.h"
+#include "spirv-module.h"
+
+#include <string.h>
+#include <algorithm>
+#include <map>
+#include <tuple>
+
+static const char* k_binding_class_names[BINDING_CLASS_COUNT] = {
+    "ubo", "ssbo", "texture", "image", "sampler"
+};
+
+struct binding_entry {
+    size_t        module;
+    size_t        deco;     // index of the OpDecorate Binding instruction
+    binding_class cls;      // class of the register space
+    binding_class src_cls;  // class of the GLSL binding namespace
+    uint32_t      set;
+    uint32_t      binding;
+    uint32_t      count;
+};
+
+// (class, set, source class, binding)
+typedef std::tuple<int, uint32_t, int, uint32_t> binding_slot;
+
+const char* binding_class_str(binding_class cls)
+{
+    return k_binding_class_names[cls];
+}
+
+bool binding_class_from_str(const char* name, binding_class* cls)
+{
+    for (int i = 0; i < BINDING_CLASS_COUNT; i++) {
+        if (strcmp(k_binding_class_names[i], name) == 0) {
+            *cls = binding_class(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool is_readonly_buffer(const spv_module& m, uint32_t var_id, uint32_t struct_id)
+{
+    if (spv_decoration(m, var_id, spv::DecorationNonWritable))
+        return true;
+
+    const spv_inst& def = m.insts[spv_find_def(m, struct_id)];
+    for (uint32_t i = 0; i < def.w.size() - 2; i++) {
+        bool readonly = false;
+        for (const spv_inst& inst : m.insts) {
+            readonly |= inst.op() == spv::OpMemberDecorate && inst.w[1] == struct_id && inst.w[2] == i &&
+                        inst.w[3] == spv::DecorationNonWritable;
+        }
+        if (!readonly)
+            return false;
+    }
+    return true;
+}
+
+// resource class and number of array elements of a variable, false if it's not a resource
+// cls is the class of the register space, src_cls is the GLSL class
+static bool get_resource_class(const spv_module& m, const spv_inst& var, bool hlsl_registers,
+                               binding_class* cls, binding_class* src_cls, uint32_t* count)
+{
+    uint32_t storage = var.w[3];
+    if (storage != spv::StorageClassUniform && storage != spv::StorageClassUniformConstant &&
+        storage != spv::StorageClassStorageBuffer) {
+        return false;
+    }
+
+    int ptr = spv_find_def(m, var.w[1]);
+    uint32_t type_id = m.insts[ptr].w[3];
+    *count = 1;
+    for (;;) {
+        const spv_inst& def = m.insts[spv_find_def(m, type_id)];
+        if (def.op() != spv::OpTypeArray)
+            break;
+        const spv_inst& length = m.insts[spv_find_def(m, def.w[3])];
+        if (length.op() != spv::OpConstant)
+            return false;
+        *count *= length.w[3];
+        type_id = def.w[2];
+    }
+
+    const spv_inst& def = m.insts[spv_find_def(m, type_id)];
+    switch (def.op()) {
+    case spv::OpTypeStruct:
+        if (storage == spv::StorageClassStorageBuffer || spv_decoration(m, type_id, spv::DecorationBufferBlock)) {
+            *cls = *src_cls = BINDING_CLASS_STORAGE_BUFFER;
+            if (hlsl_registers)
+                *cls = is_readonly_buffer(m, var.w[2], type_id) ? BINDING_CLASS_TEXTURE : BINDING_CLASS_STORAGE_IMAGE;
+            return true;
+        }
+        *cls = *src_cls = BINDING_CLASS_UNIFORM_BUFFER;
+        return storage == spv::StorageClassUniform;
+    case spv::OpTypeSampledImage:
+        *cls = *src_cls = BINDING_CLASS_TEXTURE;
+        return true;
+    case spv::OpTypeImage:
+        if (def.w[3] == spv::DimSubpassData)
+            return false;
+        *cls = *src_cls = def.w[7] == 2 ? BINDING_CLASS_STORAGE_IMAGE : BINDING_CLASS_TEXTURE;
+        return true;
+    case spv::OpTypeSampler:
+        *cls = *src_cls = BINDING_CLASS_SAMPLER;
+        return true;
+    default:
+        return false;
+    }
+}
+
+// resources of the modules that have a binding
+static void get_binding_entries(const std::vector<std::vector<uint32_t>*>& spirvs, bool hlsl_registers,
+                                std::vector<spv_module>* modules, std::vector<binding_entry>* entries)
+{
+    modules->resize(spirvs.size());
+    for (size_t i = 0; i < spirvs.size(); i++) {
+        spv_module& m = (*modules)[i];
+        if (!spv_parse(&m, *spirvs[i]))
+            continue;
+
+        for (const spv_inst& var : m.insts) {
+            binding_entry e = { i, 0, BINDING_CLASS_COUNT, BINDING_CLASS_COUNT, 0, 0, 1 };
+            if (var.op() != spv::OpVariable || !get_resource_class(m, var, hlsl_registers, &e.cls, &e.src_cls, &e.count))
+                continue;
+
+            int deco = -1;
+            for (size_t k = 0; k < m.insts.size(); k++) {
+                const spv_inst& inst = m.insts[k];
+                if (inst.op() == spv::OpDecorate && inst.w[1] == var.w[2]) {
+                    if (inst.w[2] == spv::DecorationBinding) {
+                        deco = int(k);
+                        e.binding = inst.w[3];
+                    } else if (inst.w[2] == spv::DecorationDescriptorSet) {
+                        e.set = inst.w[3];
+                    }
+                }
+            }
+            if (deco != -1) {
+                e.deco = size_t(deco);
+                entries->push_back(e);
+            }
+        }
+    }
+}
+
+static void write_modules(const std::vector<spv_module>& modules, const std::vector<std::vector<uint32_t>*>& spirvs)
+{
+    for (size_t i = 0; i < spirvs.size(); i++) {
+        if (!modules[i].insts.empty())
+            spv_write(modules[i], spirvs[i]);
+    }
+}
+
+void bindings_shift(const std::vector<std::vector<uint32_t>*>& spirvs, const uint32_t bases[BINDING_CLASS_COUNT],
+                    bool hlsl_registers)
+{
+    std::vector<spv_module> modules;
+    std::vector<binding_entry> entries;
+    get_binding_entries(spirvs, hlsl_registers, &modules, &entries);
+
+    for (const binding_entry& e : entries)
+        modules[e.module].insts[e.deco].w[3] = bases[e.cls] + e.binding;
+    write_modules(modules, spirvs);
+}
+
+void bindings_compact(const std::vector<std::vector<uint32_t>*>& spirvs, const uint32_t bases[BINDING_CLASS_COUNT],
+                      bool hlsl_registers)
+{
+    std::vector<spv_module> modules;
+    std::vector<binding_entry> entries;
+    get_binding_entries(spirvs, hlsl_registers, &modules, &entries);
+
+    // slot -> number of bindings, ordered by the original binding in each GLSL namespace
+    // so resources of different classes that share a register space don't share a binding
+    std::map<binding_slot, uint32_t> slots;
+    for (const binding_entry& e : entries) {
+        uint32_t& count = slots[binding_slot(int(e.cls), e.set, int(e.src_cls), e.binding)];
+        count = std::max(count, e.count);
+    }
+
+    std::map<binding_slot, uint32_t> remap;
+    std::pair<int, uint32_t> range(-1, 0);
+    uint32_t next = 0;
+    for (auto& slot : slots) {
+        std::pair<int, uint32_t> slot_range(std::get<0>(slot.first), std::get<1>(slot.first));
+        if (slot_range != range) {
+            range = slot_range;
+            next = bases[range.first];
+        }
+        remap[slot.first] = next;
+        next += slot.second;
+    }
+
+    for (const binding_entry& e : entries)
+        modules[e.module].insts[e.deco].w[3] = remap[binding_slot(int(e.cls), e.set, int(e.src_cls), e.binding)];
+    write_modules(modules, spirvs);
+}
@@ -0,0 +1,36 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+// Dense binding assignment: renumbers the bindings of each resource class and descriptor set to base, base+1 ...
+// in the order they are declared by the author, so engines can use minimal descriptor layouts and contiguous
+// register ranges. Arrays of resources take a binding per element
+//
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+enum binding_class {
+    BINDING_CLASS_UNIFORM_BUFFER = 0,
+    BINDING_CLASS_STORAGE_BUFFER,
+    BINDING_CLASS_TEXTURE,
+    BINDING_CLASS_STORAGE_IMAGE,
+    BINDING_CLASS_SAMPLER,
+    BINDING_CLASS_COUNT
+};
+
+const char* binding_class_str(binding_class cls);
+bool        binding_class_from_str(const char* name, binding_class* cls);
+
+// HLSL register classes: read-only storage buffers are t registers like textures and writable ones are u
+// registers like storage images. The bases of these classes apply to the storage buffers too
+
+// Adds the base of its class to the binding of each resource
+void bindings_shift(const std::vector<std::vector<uint32_t>*>& spirvs, const uint32_t bases[BINDING_CLASS_COUNT],
+                    bool hlsl_registers);
+
+// Resources with the same set and binding in different modules keep sharing their binding, pass all stages of a
+// program to get a numbering that is valid for all of them, or each stage alone to make them as dense as possible
+void bindings_compact(const std::vector<std::vector<uint32_t>*>& spirvs, const uint32_t bases[BINDING_CLASS_COUNT],
+                      bool hlsl_registers);
@@ -4,6 +4,8 @@
 //
 
 #include "config.h"
+#include <stdio.h>
+#include <fstream>
 #include <sstream>
 
 const TBuiltInResource k_default_conf = {
@@ -114,114 +116,188 @@ const TBuiltInResource k_default_conf = {
     /* .generalConstantMatrixVectorIndexing = */ 1,
 }};
 
-std::string get_default_conf_str()
-{
-    std::ostringstream ostream;
-    const TBuiltInResource& conf = k_default_conf;
-    ostream << "MaxLights "                                 << conf.maxLights << "\n"
-            << "MaxClipPlanes "                             << conf.maxClipPlanes << "\n"
-            << "MaxTextureUnits "                           << conf.maxTextureUnits << "\n"
-            << "MaxTextureCoords "                          << conf.maxTextureCoords << "\n"
-            << "MaxVertexAttribs "                          << conf.maxVertexAttribs << "\n"
-            << "MaxVertexUniformComponents "                << conf.maxVertexUniformComponents << "\n"
-            << "MaxVaryingFloats "                          << conf.maxVaryingFloats << "\n"
-            << "MaxVertexTextureImageUnits "                << conf.maxVertexTextureImageUnits << "\n"
-            << "MaxCombinedTextureImageUnits "              << conf.maxCombinedTextureImageUnits << "\n"
-            << "MaxTextureImageUnits "                      << conf.maxTextureImageUnits << "\n"
-            << "MaxFragmentUniformComponents "              << conf.maxFragmentUniformComponents << "\n"
-            << "MaxDrawBuffers "                            << conf.maxDrawBuffers << "\n"
-            << "MaxVertexUniformVectors "                   << conf.maxVertexUniformVectors << "\n"
-            << "MaxVaryingVectors "                         << conf.maxVaryingVectors << "\n"
-            << "MaxFragmentUniformVectors "                 << conf.maxFragmentUniformVectors << "\n"
-            << "MaxVertexOutputVectors "                    << conf.maxVertexOutputVectors << "\n"
-            << "MaxFragmentInputVectors "                   << conf.maxFragmentInputVectors << "\n"
-            << "MinProgramTexelOffset "                     << conf.minProgramTexelOffset << "\n"
-            << "MaxProgramTexelOffset "                     << conf.maxProgramTexelOffset << "\n"
-            << "MaxClipDistances "                          << conf.maxClipDistances << "\n"
-            << "MaxComputeWorkGroupCountX "                 << conf.maxComputeWorkGroupCountX << "\n"
-            << "MaxComputeWorkGroupCountY "                 << conf.maxComputeWorkGroupCountY << "\n"
-            << "MaxComputeWorkGroupCountZ "                 << conf.maxComputeWorkGroupCountZ << "\n"
-            << "MaxComputeWorkGroupSizeX "                  << conf.maxComputeWorkGroupSizeX << "\n"
-            << "MaxComputeWorkGroupSizeY "                  << conf.maxComputeWorkGroupSizeY << "\n"
-            << "MaxComputeWorkGroupSizeZ "                  << conf.maxComputeWorkGroupSizeZ << "\n"
-            << "MaxComputeUniformComponents "               << conf.maxComputeUniformComponents << "\n"
-            << "MaxComputeTextureImageUnits "               << conf.maxComputeTextureImageUnits << "\n"
-            << "MaxComputeImageUniforms "                   << conf.maxComputeImageUniforms << "\n"
-            << "MaxComputeAtomicCounters "                  << conf.maxComputeAtomicCounters << "\n"
-            << "MaxComputeAtomicCounterBuffers "            << conf.maxComputeAtomicCounterBuffers << "\n"
-            << "MaxVaryingComponents "                      << conf.maxVaryingComponents << "\n"
-            << "MaxVertexOutputComponents "                 << conf.maxVertexOutputComponents << "\n"
-            << "MaxGeometryInputComponents "                << conf.maxGeometryInputComponents << "\n"
-            << "MaxGeometryOutputComponents "               << conf.maxGeometryOutputComponents << "\n"
-            << "MaxFragmentInputComponents "                << conf.maxFragmentInputComponents << "\n"
-            << "MaxImageUnits "                             << conf.maxImageUnits << "\n"
-            << "MaxCombinedImageUnitsAndFragmentOutputs "   << conf.maxCombinedImageUnitsAndFragmentOutputs << "\n"
-            << "MaxCombinedShaderOutputResources "          << conf.maxCombinedShaderOutputResources << "\n"
-            << "MaxImageSamples "                           << conf.maxImageSamples << "\n"
-            << "MaxVertexImageUniforms "                    << conf.maxVertexImageUniforms << "\n"
-            << "MaxTessControlImageUniforms "               << conf.maxTessControlImageUniforms << "\n"
-            << "MaxTessEvaluationImageUniforms "            << conf.maxTessEvaluationImageUniforms << "\n"
-            << "MaxGeometryImageUniforms "                  << conf.maxGeometryImageUniforms << "\n"
-            << "MaxFragmentImageUniforms "                  << conf.maxFragmentImageUniforms << "\n"
-            << "MaxCombinedImageUniforms "                  << conf.maxCombinedImageUniforms << "\n"
-            << "MaxGeometryTextureImageUnits "              << conf.maxGeometryTextureImageUnits << "\n"
-            << "MaxGeometryOutputVertices "                 << conf.maxGeometryOutputVertices << "\n"
-            << "MaxGeometryTotalOutputComponents "          << conf.maxGeometryTotalOutputComponents << "\n"
-            << "MaxGeometryUniformComponents "              << conf.maxGeometryUniformComponents << "\n"
-            << "MaxGeometryVaryingComponents "              << conf.maxGeometryVaryingComponents << "\n"
-            << "MaxTessControlInputComponents "             << conf.maxTessControlInputComponents << "\n"
-            << "MaxTessControlOutputComponents "            << conf.maxTessControlOutputComponents << "\n"
-            << "MaxTessControlTextureImageUnits "           << conf.maxTessControlTextureImageUnits << "\n"
-            << "MaxTessControlUniformComponents "           << conf.maxTessControlUniformComponents << "\n"
-            << "MaxTessControlTotalOutputComponents "       << conf.maxTessControlTotalOutputComponents << "\n"
-            << "MaxTessEvaluationInputComponents "          << conf.maxTessEvaluationInputComponents << "\n"
-            << "MaxTessEvaluationOutputComponents "         << conf.maxTessEvaluationOutputComponents << "\n"
-            << "MaxTessEvaluationTextureImageUnits "        << conf.maxTessEvaluationTextureImageUnits << "\n"
-            << "MaxTessEvaluationUniformComponents "        << conf.maxTessEvaluationUniformComponents << "\n"
-            << "MaxTessPatchComponents "                    << conf.maxTessPatchComponents << "\n"
-            << "MaxPatchVertices "                          << conf.maxPatchVertices << "\n"
-            << "MaxTessGenLevel "                           << conf.maxTessGenLevel << "\n"
-            << "MaxViewports "                              << conf.maxViewports << "\n"
-            << "MaxVertexAtomicCounters "                   << conf.maxVertexAtomicCounters << "\n"
-            << "MaxTessControlAtomicCounters "              << conf.maxTessControlAtomicCounters << "\n"
-            << "MaxTessEvaluationAtomicCounters "           << conf.maxTessEvaluationAtomicCounters << "\n"
-            << "MaxGeometryAtomicCounters "                 << conf.maxGeometryAtomicCounters << "\n"
-            << "MaxFragmentAtomicCounters "                 << conf.maxFragmentAtomicCounters << "\n"
-            << "MaxCombinedAtomicCounters "                 << conf.maxCombinedAtomicCounters << "\n"
-            << "MaxAtomicCounterBindings "                  << conf.maxAtomicCounterBindings << "\n"
-            << "MaxVertexAtomicCounterBuffers "             << conf.maxVertexAtomicCounterBuffers << "\n"
-            << "MaxTessControlAtomicCounterBuffers "        << conf.maxTessControlAtomicCounterBuffers << "\n"
-            << "MaxTessEvaluationAtomicCounterBuffers "     << conf.maxTessEvaluationAtomicCounterBuffers << "\n"
-            << "MaxGeometryAtomicCounterBuffers "           << conf.maxGeometryAtomicCounterBuffers << "\n"
-            << "MaxFragmentAtomicCounterBuffers "           << conf.maxFragmentAtomicCounterBuffers << "\n"
-            << "MaxCombinedAtomicCounterBuffers "           << conf.maxCombinedAtomicCounterBuffers << "\n"
-            << "MaxAtomicCounterBufferSize "                << conf.maxAtomicCounterBufferSize << "\n"
-            << "MaxTransformFeedbackBuffers "               << conf.maxTransformFeedbackBuffers << "\n"
-            << "MaxTransformFeedbackInterleavedComponents " << conf.maxTransformFeedbackInterleavedComponents << "\n"
-            << "MaxCullDistances "                          << conf.maxCullDistances << "\n"
-            << "MaxCombinedClipAndCullDistances "           << conf.maxCombinedClipAndCullDistances << "\n"
-            << "MaxSamples "                                << conf.maxSamples << "\n"
+const uint32_t k_max_compute_invocations = 1024;
+const uint32_t k_max_compute_shared_memory_size = 32768;
+
+struct conf_field {
+    const char* name;
+    int TBuiltInResource::*value;
+};
+
+struct conf_limit_field {
+    const char* name;
+    bool TLimits::*value;
+};
+
+// same names and order as glslang's default resource limits
+static const conf_field k_conf_fields[] = {
+    { "MaxLights", &TBuiltInResource::maxLights },
+    { "MaxClipPlanes", &TBuiltInResource::maxClipPlanes },
+    { "MaxTextureUnits", &TBuiltInResource::maxTextureUnits },
+    { "MaxTextureCoords", &TBuiltInResource::maxTextureCoords },
+    { "MaxVertexAttribs", &TBuiltInResource::maxVertexAttribs },
+    { "MaxVertexUniformComponents", &TBuiltInResource::maxVertexUniformComponents },
+    { "MaxVaryingFloats", &TBuiltInResource::maxVaryingFloats },
+    { "MaxVertexTextureImageUnits", &TBuiltInResource::maxVertexTextureImageUnits },
+    { "MaxCombinedTextureImageUnits", &TBuiltInResource::maxCombinedTextureImageUnits },
+    { "MaxTextureImageUnits", &TBuiltInResource::maxTextureImageUnits },
+    { "MaxFragmentUniformComponents", &TBuiltInResource::maxFragmentUniformComponents },
+    { "MaxDrawBuffers", &TBuiltInResource::maxDrawBuffers },
+    { "MaxVertexUniformVectors", &TBuiltInResource::maxVertexUniformVectors },
+    { "MaxVaryingVectors", &TBuiltInResource::maxVaryingVectors },
+    { "MaxFragmentUniformVectors", &TBuiltInResource::maxFragmentUniformVectors },
+    { "MaxVertexOutputVectors", &TBuiltInResource::maxVertexOutputVectors },
+    { "MaxFragmentInputVectors", &TBuiltInResource::maxFragmentInputVectors },
+    { "MinProgramTexelOffset", &TBuiltInResource::minProgramTexelOffset },
+    { "MaxProgramTexelOffset", &TBuiltInResource::maxProgramTexelOffset },
+    { "MaxClipDistances", &TBuiltInResource::maxClipDistances },
+    { "MaxComputeWorkGroupCountX", &TBuiltInResource::maxComputeWorkGroupCountX },
+    { "MaxComputeWorkGroupCountY", &TBuiltInResource::maxComputeWorkGroupCountY },
+    { "MaxComputeWorkGroupCountZ", &TBuiltInResource::maxComputeWorkGroupCountZ },
+    { "MaxComputeWorkGroupSizeX", &TBuiltInResource::maxComputeWorkGroupSizeX },
+    { "MaxComputeWorkGroupSizeY", &TBuiltInResource::maxComputeWorkGroupSizeY },
+    { "MaxComputeWorkGroupSizeZ", &TBuiltInResource::maxComputeWorkGroupSizeZ },
+    { "MaxComputeUniformComponents", &TBuiltInResource::maxComputeUniformComponents },
+    { "MaxComputeTextureImageUnits", &TBuiltInResource::maxComputeTextureImageUnits },
+    { "MaxComputeImageUniforms", &TBuiltInResource::maxComputeImageUniforms },
+    { "MaxComputeAtomicCounters", &TBuiltInResource::maxComputeAtomicCounters },
+    { "MaxComputeAtomicCounterBuffers", &TBuiltInResource::maxComputeAtomicCounterBuffers },
+    { "MaxVaryingComponents", &TBuiltInResource::maxVaryingComponents },
+    { "MaxVertexOutputComponents", &TBuiltInResource::maxVertexOutputComponents },
+    { "MaxGeometryInputComponents", &TBuiltInResource::maxGeometryInputComponents },
+    { "MaxGeometryOutputComponents", &TBuiltInResource::maxGeometryOutputComponents },
+    { "MaxFragmentInputComponents", &TBuiltInResource::maxFragmentInputComponents },
+    { "MaxImageUnits", &TBuiltInResource::maxImageUnits },
+    { "MaxCombinedImageUnitsAndFragmentOutputs", &TBuiltInResource::maxCombinedImageUnitsAndFragmentOutputs },
+    { "MaxCombinedShaderOutputResources", &TBuiltInResource::maxCombinedShaderOutputResources },
+    { "MaxImageSamples", &TBuiltInResource::maxImageSamples },
+    { "MaxVertexImageUniforms", &TBuiltInResource::maxVertexImageUniforms },
+    { "MaxTessControlImageUniforms", &TBuiltInResource::maxTessControlImageUniforms },
+    { "MaxTessEvaluationImageUniforms", &TBuiltInResource::maxTessEvaluationImageUniforms },
+    { "MaxGeometryImageUniforms", &TBuiltInResource::maxGeometryImageUniforms },
+    { "MaxFragmentImageUniforms", &TBuiltInResource::maxFragmentImageUniforms },
+    { "MaxCombinedImageUniforms", &TBuiltInResource::maxCombinedImageUniforms },
+    { "MaxGeometryTextureImageUnits", &TBuiltInResource::maxGeometryTextureImageUnits },
+    { "MaxGeometryOutputVertices", &TBuiltInResource::maxGeometryOutputVertices },
+    { "MaxGeometryTotalOutputComponents", &TBuiltInResource::maxGeometryTotalOutputComponents },
+    { "MaxGeometryUniformComponents", &TBuiltInResource::maxGeometryUniformComponents },
+    { "MaxGeometryVaryingComponents", &TBuiltInResource::maxGeometryVaryingComponents },
+    { "MaxTessControlInputComponents", &TBuiltInResource::maxTessControlInputComponents },
+    { "MaxTessControlOutputComponents", &TBuiltInResource::maxTessControlOutputComponents },
+    { "MaxTessControlTextureImageUnits", &TBuiltInResource::maxTessControlTextureImageUnits },
+    { "MaxTessControlUniformComponents", &TBuiltInResource::maxTessControlUniformComponents },
+    { "MaxTessControlTotalOutputComponents", &TBuiltInResource::maxTessControlTotalOutputComponents },
+    { "MaxTessEvaluationInputComponents", &TBuiltInResource::maxTessEvaluationInputComponents },
+    { "MaxTessEvaluationOutputComponents", &TBuiltInResource::maxTessEvaluationOutputComponents },
+    { "MaxTessEvaluationTextureImageUnits", &TBuiltInResource::maxTessEvaluationTextureImageUnits },
+    { "MaxTessEvaluationUniformComponents", &TBuiltInResource::maxTessEvaluationUniformComponents },
+    { "MaxTessPatchComponents", &TBuiltInResource::maxTessPatchComponents },
+    { "MaxPatchVertices", &TBuiltInResource::maxPatchVertices },
+    { "MaxTessGenLevel", &TBuiltInResource::maxTessGenLevel },
+    { "MaxViewports", &TBuiltInResource::maxViewports },
+    { "MaxVertexAtomicCounters", &TBuiltInResource::maxVertexAtomicCounters },
+    { "MaxTessControlAtomicCounters", &TBuiltInResource::maxTessControlAtomicCounters },
+    { "MaxTessEvaluationAtomicCounters", &TBuiltInResource::maxTessEvaluationAtomicCounters },
+    { "MaxGeometryAtomicCounters", &TBuiltInResource::maxGeometryAtomicCounters },
+    { "MaxFragmentAtomicCounters", &TBuiltInResource::maxFragmentAtomicCounters },
+    { "MaxCombinedAtomicCounters", &TBuiltInResource::maxCombinedAtomicCounters },
+    { "MaxAtomicCounterBindings", &TBuiltInResource::maxAtomicCounterBindings },
+    { "MaxVertexAtomicCounterBuffers", &TBuiltInResource::maxVertexAtomicCounterBuffers },
+    { "MaxTessControlAtomicCounterBuffers", &TBuiltInResource::maxTessControlAtomicCounterBuffers },
+    { "MaxTessEvaluationAtomicCounterBuffers", &TBuiltInResource::maxTessEvaluationAtomicCounterBuffers },
+    { "MaxGeometryAtomicCounterBuffers", &TBuiltInResource::maxGeometryAtomicCounterBuffers },
+    { "MaxFragmentAtomicCounterBuffers", &TBuiltInResource::maxFragmentAtomicCounterBuffers },
+    { "MaxCombinedAtomicCounterBuffers", &TBuiltInResource::maxCombinedAtomicCounterBuffers },
+    { "MaxAtomicCounterBufferSize", &TBuiltInResource::maxAtomicCounterBufferSize },
+    { "MaxTransformFeedbackBuffers", &TBuiltInResource::maxTransformFeedbackBuffers },
+    { "MaxTransformFeedbackInterleavedComponents", &TBuiltInResource::maxTransformFeedbackInterleavedComponents },
+    { "MaxCullDistances", &TBuiltInResource::maxCullDistances },
+    { "MaxCombinedClipAndCullDistances", &TBuiltInResource::maxCombinedClipAndCullDistances },
+    { "MaxSamples", &TBuiltInResource::maxSamples },
 #ifdef NV_EXTENSIONS
-            << "MaxMeshOutputVerticesNV "                   << conf.maxMeshOutputVerticesNV << "\n"
-            << "MaxMeshOutputPrimitivesNV "                 << conf.maxMeshOutputPrimitivesNV << "\n"
-            << "MaxMeshWorkGroupSizeX_NV "                  << conf.maxMeshWorkGroupSizeX_NV << "\n"
-            << "MaxMeshWorkGroupSizeY_NV "                  << conf.maxMeshWorkGroupSizeY_NV << "\n"
-            << "MaxMeshWorkGroupSizeZ_NV "                  << conf.maxMeshWorkGroupSizeZ_NV << "\n"
-            << "MaxTaskWorkGroupSizeX_NV "                  << conf.maxTaskWorkGroupSizeX_NV << "\n"
-            << "MaxTaskWorkGroupSizeY_NV "                  << conf.maxTaskWorkGroupSizeY_NV << "\n"
-            << "MaxTaskWorkGroupSizeZ_NV "                  << conf.maxTaskWorkGroupSizeZ_NV << "\n"
-            << "MaxMeshViewCountNV "                        << conf.maxMeshViewCountNV << "\n"
+    { "MaxMeshOutputVerticesNV", &TBuiltInResource::maxMeshOutputVerticesNV },
+    { "MaxMeshOutputPrimitivesNV", &TBuiltInResource::maxMeshOutputPrimitivesNV },
+    { "MaxMeshWorkGroupSizeX_NV", &TBuiltInResource::maxMeshWorkGroupSizeX_NV },
+    { "MaxMeshWorkGroupSizeY_NV", &TBuiltInResource::maxMeshWorkGroupSizeY_NV },
+    { "MaxMeshWorkGroupSizeZ_NV", &TBuiltInResource::maxMeshWorkGroupSizeZ_NV },
+    { "MaxTaskWorkGroupSizeX_NV", &TBuiltInResource::maxTaskWorkGroupSizeX_NV },
+    { "MaxTaskWorkGroupSizeY_NV", &TBuiltInResource::maxTaskWorkGroupSizeY_NV },
+    { "MaxTaskWorkGroupSizeZ_NV", &TBuiltInResource::maxTaskWorkGroupSizeZ_NV },
+    { "MaxMeshViewCountNV", &TBuiltInResource::maxMeshViewCountNV },
 #endif
-            << "nonInductiveForLoops "                      << conf.limits.nonInductiveForLoops << "\n"
-            << "whileLoops "                                << conf.limits.whileLoops << "\n"
-            << "doWhileLoops "                              << conf.limits.doWhileLoops << "\n"
-            << "generalUniformIndexing "                    << conf.limits.generalUniformIndexing << "\n"
-            << "generalAttributeMatrixVectorIndexing "      << conf.limits.generalAttributeMatrixVectorIndexing << "\n"
-            << "generalVaryingIndexing "                    << conf.limits.generalVaryingIndexing << "\n"
-            << "generalSamplerIndexing "                    << conf.limits.generalSamplerIndexing << "\n"
-            << "generalVariableIndexing "                   << conf.limits.generalVariableIndexing << "\n"
-            << "generalConstantMatrixVectorIndexing "       << conf.limits.generalConstantMatrixVectorIndexing << "\n"
-      ;
+};
+
+static const conf_limit_field k_conf_limit_fields[] = {
+    { "nonInductiveForLoops", &TLimits::nonInductiveForLoops },
+    { "whileLoops", &TLimits::whileLoops },
+    { "doWhileLoops", &TLimits::doWhileLoops },
+    { "generalUniformIndexing", &TLimits::generalUniformIndexing },
+    { "generalAttributeMatrixVectorIndexing", &TLimits::generalAttributeMatrixVectorIndexing },
+    { "generalVaryingIndexing", &TLimits::generalVaryingIndexing },
+    { "generalSamplerIndexing", &TLimits::generalSamplerIndexing },
+    { "generalVariableIndexing", &TLimits::generalVariableIndexing },
+    { "generalConstantMatrixVectorIndexing", &TLimits::generalConstantMatrixVectorIndexing },
+};
+
+std::string get_conf_str(const TBuiltInResource& conf)
+{
+    std::ostringstream ostream;
+    for (const conf_field& f : k_conf_fields)
+        ostream << f.name << " " << conf.*f.value << "\n";
+    for (const conf_limit_field& f : k_conf_limit_fields)
+        ostream << f.name << " " << conf.limits.*f.value << "\n";
 
     return ostream.str();
 }
+
+// missing limits keep the default values, so profiles only need to list what differs
+bool parse_conf(const char* text, TBuiltInResource* conf, std::string* err)
+{
+    std::istringstream stream(text);
+    *conf = k_default_conf;
+    std::string name;
+    int value;
+    while (stream >> name) {
+        if (!(stream >> value)) {
+            *err = "missing value for '" + name + "'";
+            return false;
+        }
+
+        bool found = false;
+        for (const conf_field& f : k_conf_fields) {
+            if (!found && name == f.name) {
+                conf->*f.value = value;
+                found = true;
+            }
+        }
+        for (const conf_limit_field& f : k_conf_limit_fields) {
+            if (!found && name == f.name) {
+                conf->limits.*f.value = value != 0;
+                found = true;
+            }
+        }
+        if (!found) {
+            *err = "unknown limit '" + name + "'";
+            return false;
+        }
+    }
+    return true;
+}
+
+bool load_conf(const char* filepath, TBuiltInResource* conf)
+{
+    std::ifstream file(filepath);
+    if (!file.is_open()) {
+        printf("Opening limits file '%s' failed\n", filepath);
+        return false;
+    }
+
+    std::ostringstream text;
+    text << file.rdbuf();
+    std::string err;
+    if (!parse_conf(text.str().c_str(), conf, &err)) {
+        printf("%s: %s\n", filepath, err.c_str());
+        return false;
+    }
+    return true;
+}
@@ -5,9 +5,20 @@
 #pragma once
 
 #include "glslang/Include/ResourceLimits.h"
+#include <stdint.h>
 #include <string>
 
 extern const TBuiltInResource k_default_conf;
 
-// Returns the DefaultTBuiltInResource as a human-readable string.
-std::string get_default_conf_str();
\ No newline at end of file
+// compute limits that are not in TBuiltInResource, minimums of GL 4.3, D3D11 and Metal
+extern const uint32_t k_max_compute_invocations;
+extern const uint32_t k_max_compute_shared_memory_size;
+
+// Returns the limits as a human-readable string, in the format that load_conf reads
+std::string get_conf_str(const TBuiltInResource& conf);
+
+// Reads "Name Value" pairs (--dumpc output) into conf, limits that are not in the text keep their default values
+bool parse_conf(const char* text, TBuiltInResource* conf, std::string* err);
+
+// parse_conf with the contents of a limits file, errors are printed
+bool load_conf(const char* filepath, TBuiltInResource* conf);
\ No newline at end of file
@@ -32,12 +32,32 @@
 //      1.7.4       Added //@begin_vert //@begin_frag //@end tags in .glsl files
 //      1.7.5       List include names in the shader with -L argument
 //      1.7.6       Fixed bugs in parse output
+//      1.8.0       Watch mode (--watch), recompiles changed shaders and only the changed stages
+//      1.8.1       REF2 reflection chunk for SGS files (--refl-v2)
+//      1.8.2       Strip resources unused by the entry point (--strip-unused)
+//      1.8.3       Remove dead vertex outputs and pack varyings of linked vs/fs stages (--link-varyings, --pack-varyings)
+//      1.8.4       mediump inference for GLES output (--infer-mediump)
+//      1.8.5       GLSL/GLES output minifier (--minify)
+//      1.8.6       Static shader cost report (--stats)
+//      1.8.7       Specialization constant reflection and per-backend mapping (--specialize)
+//      1.8.8       Permutation defines as specialization constants, MSL function constants (--spec-defines)
+//      1.8.9       Metal argument buffers with reflected layouts (--msl-argument-buffers)
+//      1.8.10      Uniform block layout optimizer (--pack-ubos)
+//      1.8.11      Flatten uniform blocks into an array per update frequency (--split-ubos)
+//      1.8.12      Dense automatic bindings and per-backend binding bases (--auto-bind, --bind-base)
+//      1.8.13      Combined samplers from separate images and samplers for GLSL/GLES (--combine-samplers)
+//      1.8.14      Precision and compact vertex format hints for vertex inputs in reflection
+//      1.8.15      Compute workgroup size and shared memory in reflection, with warnings for device limits
+//      1.8.16      Shader limits files (--limits) and limit usage report (--limits-report)
+//      1.8.17      Performance lint for tile-based GPUs (--perf-lint)
+//      1.9.0       libglslcc: compile pipeline as a static library with a C API (libglslcc.h)
 //
 #define _ALLOW_KEYWORD_MACROS
 
 #include "sx/allocator.h"
 #include "sx/array.h"
 #include "sx/cmdline.h"
+#include "sx/hash.h"
 #include "sx/io.h"
 #include "sx/os.h"
 #include "sx/string.h"
@@ -45,7 +65,10 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <algorithm>
+#include <map>
 #include <string>
+#include <unordered_map>
 
 #include "SPIRV/GlslangToSpv.h"
 #include "SPIRV/SpvTools.h"
@@ -57,34 +80,41 @@
 #include "spirv_hlsl.hpp"
 #include "spirv_msl.hpp"
 
+#include "bindings.h"
 #include "config.h"
+#include "json-writer.h"
+#include "perf-lint.h"
+#include "pipeline.h"
+#include "reflect.h"
 #include "sgs-file.h"
+#include "stats.h"
+#include "ubo-layout.h"
+
+#if SX_PLATFORM_LINUX
+#include <dirent.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
 
 #ifdef D3D11_COMPILER
 #include <d3dcompiler.h>
 #define BYTECODE_COMPILATION
 #endif
 
-// sjson
-#define sjson_malloc(user, size) sx_malloc((const sx_alloc*)user, size)
-#define sjson_free(user, ptr) sx_free((const sx_alloc*)user, ptr)
-#define sjson_realloc(user, ptr, size) sx_realloc((const sx_alloc*)user, ptr, size)
-#define sjson_assert(e) sx_assert(e);
-#define sjson_snprintf sx_snprintf
-#define sjson_strcpy(dst, n, src) sx_strcpy(dst, n, src)
-#define SJSON_IMPLEMENTATION
-#include "../3rdparty/sjson/sjson.h"
-
 #define VERSION_MAJOR 1
-#define VERSION_MINOR 7
-#define VERSION_SUB 6
+#define VERSION_MINOR 9
+#define VERSION_SUB 0
 
 static const sx_alloc* g_alloc = sx_alloc_malloc();
 static sgs_file* g_sgs = nullptr;
+static std::vector<ubo_split_part> g_ubo_splits;    // --split-ubos parts of the stage that is cross compiled
 
 struct p_define {
     char* def;
     char* val;
+    char* type;     // --spec-defines NAME:type, points into def
 };
 
 enum shader_lang {
@@ -115,91 +145,6 @@ static const uint32_t k_shader_langs_fourcc[SHADER_LANG_COUNT] = {
     SGS_LANG_GLSL
 };
 
-enum vertex_attribs {
-    VERTEX_POSITION = 0,
-    VERTEX_NORMAL,
-    VERTEX_TEXCOORD0,
-    VERTEX_TEXCOORD1,
-    VERTEX_TEXCOORD2,
-    VERTEX_TEXCOORD3,
-    VERTEX_TEXCOORD4,
-    VERTEX_TEXCOORD5,
-    VERTEX_TEXCOORD6,
-    VERTEX_TEXCOORD7,
-    VERTEX_COLOR0,
-    VERTEX_COLOR1,
-    VERTEX_COLOR2,
-    VERTEX_COLOR3,
-    VERTEX_TANGENT,
-    VERTEX_BITANGENT,
-    VERTEX_INDICES,
-    VERTEX_WEIGHTS,
-    VERTEX_ATTRIB_COUNT
-};
-
-static const char* k_attrib_names[VERTEX_ATTRIB_COUNT] = {
-    "POSITION",
-    "NORMAL",
-    "TEXCOORD0",
-    "TEXCOORD1",
-    "TEXCOORD2",
-    "TEXCOORD3",
-    "TEXCOORD4",
-    "TEXCOORD5",
-    "TEXCOORD6",
-    "TEXCOORD7",
-    "COLOR0",
-    "COLOR1",
-    "COLOR2",
-    "COLOR3",
-    "TANGENT",
-    "BINORMAL",
-    "BLENDINDICES",
-    "BLENDWEIGHT"
-};
-
-static const char* k_attrib_sem_names[VERTEX_ATTRIB_COUNT] = {
-    "POSITION",
-    "NORMAL",
-    "TEXCOORD",
-    "TEXCOORD",
-    "TEXCOORD",
-    "TEXCOORD",
-    "TEXCOORD",
-    "TEXCOORD",
-    "TEXCOORD",
-    "TEXCOORD",
-    "COLOR",
-    "COLOR",
-    "COLOR",
-    "COLOR",
-    "TANGENT",
-    "BINORMAL",
-    "BLENDINDICES",
-    "BLENDWEIGHT"
-};
-
-static int k_attrib_sem_indices[VERTEX_ATTRIB_COUNT] = {
-    0,
-    0,
-    0,
-    1,
-    2,
-    3,
-    4,
-    5,
-    6,
-    7,
-    0,
-    1,
-    2,
-    3,
-    0,
-    0,
-    0,
-    0
-};
-
 // Includer
 class Includer : public glslang::TShader::Includer {
 public:
@@ -231,6 +176,7 @@ public:
                     if (m_listIncludes) {
                         puts(header_path.c_str());
                     }
+                    m_includedFiles.push_back(header_path);
                     return new (sx_malloc(g_alloc, sizeof(IncludeResult)))
                         IncludeResult(header_path, (const char*)mem->data, (size_t)mem->size, mem);
                 }
@@ -256,6 +202,7 @@ public:
             if (m_listIncludes) {
                 puts(headerName);
             }
+            m_includedFiles.push_back(header_path);
             return new (sx_malloc(g_alloc, sizeof(IncludeResult)))
                 IncludeResult(header_path, (const char*)mem->data, (size_t)mem->size, mem);
         }
@@ -289,8 +236,15 @@ public:
         }
     }
 
+    // All files that are included by the shader, including nested includes
+    const std::vector<std::string>& includedFiles() const
+    {
+        return m_includedFiles;
+    }
+
 private:
     std::vector<std::string> m_systemDirs;
+    std::vector<std::string> m_includedFiles;
     bool m_listIncludes;
 };
 
@@ -301,6 +255,10 @@ struct cmd_args {
     const char* out_filepath;
     shader_lang lang;
     p_define* defines;
+    p_define* spec_values;      // --specialize name/constant_id=value pairs
+    p_define* spec_defines;     // --spec-defines, declared as specialization constants instead of macros
+    p_define* bind_bases;       // --bind-base [lang.]class=base pairs
+    std::vector<std::string> unorm_textures;   // --unorm-textures, samples are in [0, 1] for --infer-mediump
     Includer includer;
     int profile_ver;
     int invert_y;
@@ -314,9 +272,27 @@ struct cmd_args {
     int silent;
     int validate;
     int list_includes;
+    int refl_v2;
+    int strip_unused;
+    int link_varyings;
+    int pack_varyings;
+    int infer_mediump;
+    int minify;
+    int stats;
+    int msl_argument_buffers;
+    int pack_ubos;
+    int split_ubos;
+    int auto_bind;
+    int combine_samplers;
+    int limits_report;
+    int perf_lint;
+    int vertex_formats;
     output_error_format err_format;
     const char* cvar;
     const char* reflect_filepath;
+    const char* stats_filepath;
+    const char* limits_filepath;
+    const char* watch_dir;
 };
 
 static void print_version()
@@ -325,12 +301,31 @@ static void print_version()
     puts("http://www.github.com/septag/glslcc");
 }
 
-static void print_help(sx_cmdline_context* ctx)
+// prints the options one by one, same format as sx_cmdline_create_help_string, which cuts the text to the buffer
+static void print_help(const sx_cmdline_opt* opts)
 {
-    char buffer[4096];
     print_version();
     puts("");
-    puts(sx_cmdline_create_help_string(ctx, buffer, sizeof(buffer)));
+    for (const sx_cmdline_opt* opt = opts; opt->name || opt->name_short; opt++) {
+        char long_name[64];
+        switch (opt->type) {
+        case SX_CMDLINE_OPTYPE_REQUIRED:
+            sx_snprintf(long_name, sizeof(long_name), "--%s=<%s>", opt->name, opt->value_desc);
+            break;
+        case SX_CMDLINE_OPTYPE_OPTIONAL:
+            sx_snprintf(long_name, sizeof(long_name), "--%s(=%s)", opt->name, opt->value_desc);
+            break;
+        default:
+            sx_snprintf(long_name, sizeof(long_name), "--%s", opt->name);
+            break;
+        }
+
+        if (opt->name_short == 0)
+            printf("   %-32s - %s\n", long_name, opt->desc);
+        else
+            printf("-%c %-32s - %s\n", opt->name_short, long_name, opt->desc);
+    }
+    puts("");
     puts("Current supported shader stages are:\n"
          "\t- Vertex shader (--vert)\n"
          "\t- Fragment shader (--frag)\n"
@@ -364,7 +359,8 @@ static output_error_format parse_output_errorformat(const char* arg)
     return OUTPUT_ERRORFORMAT_GLSLANG;
 }
 
-static void parse_defines(cmd_args* args, const char* defines)
+// parses comma or ';' separated name[=value] pairs, used by --defines and --specialize
+static void parse_defines(p_define** pdefines, const char* defines)
 {
     sx_assert(defines);
     const char* def = defines;
@@ -390,7 +386,7 @@ static void parse_defines(cmd_args* args, const char* defines)
                     d.val = equal + 1;
                 }
 
-                sx_array_push(g_alloc, args->defines, d);
+                sx_array_push(g_alloc, *pdefines, d);
             }
 
             def = next_def;
@@ -465,6 +461,87 @@ static void cleanup_args(cmd_args* args)
             sx_free(g_alloc, args->defines[i].def);
     }
     sx_array_free(g_alloc, args->defines);
+
+    for (int i = 0; i < sx_array_count(args->spec_values); i++) {
+        if (args->spec_values[i].def)
+            sx_free(g_alloc, args->spec_values[i].def);
+    }
+    sx_array_free(g_alloc, args->spec_values);
+
+    for (int i = 0; i < sx_array_count(args->spec_defines); i++) {
+        if (args->spec_defines[i].def)
+            sx_free(g_alloc, args->spec_defines[i].def);
+    }
+    sx_array_free(g_alloc, args->spec_defines);
+
+    for (int i = 0; i < sx_array_count(args->bind_bases); i++) {
+        if (args->bind_bases[i].def)
+            sx_free(g_alloc, args->bind_bases[i].def);
+    }
+    sx_array_free(g_alloc, args->bind_bases);
+}
+
+// first binding of each resource class, entries with a language prefix only apply to that backend
+static bool get_binding_bases(const cmd_args& args, uint32_t bases[BINDING_CLASS_COUNT])
+{
+    sx_memset(bases, 0x0, sizeof(uint32_t) * BINDING_CLASS_COUNT);
+    for (int i = 0; i < sx_array_count(args.bind_bases); i++) {
+        const p_define& d = args.bind_bases[i];
+        const char* name = d.def;
+        const char* dot = sx_strchar(name, '.');
+        if (dot) {
+            if (args.lang == SHADER_LANG_COUNT)
+                continue;
+            char lang[32];
+            sx_strncpy(lang, sizeof(lang), name, (int)(uintptr_t)(dot - name));
+            if (sx_strequalnocase(lang, "metal"))
+                sx_strcpy(lang, sizeof(lang), "msl");
+            if (!sx_strequalnocase(lang, k_shader_types[args.lang]))
+                continue;
+            name = dot + 1;
+        }
+
+        binding_class cls;
+        if (!binding_class_from_str(name, &cls) || !d.val || !sx_isnum(d.val))
+            return false;
+        bases[cls] = (uint32_t)sx_toint(d.val);
+    }
+    return true;
+}
+
+static void get_pipeline_defines(std::vector<pipeline_define>* defines, const p_define* pdefines)
+{
+    for (int i = 0; i < sx_array_count(pdefines); i++)
+        defines->push_back({ pdefines[i].def, pdefines[i].val, pdefines[i].type });
+}
+
+// shader_lang has the same order as glslcc_lang
+static void get_pipeline_options(const cmd_args& args, const TBuiltInResource& limits_conf, pipeline_options* opts)
+{
+    opts->lang = (glslcc_lang)args.lang;
+    opts->profile_ver = args.profile_ver;
+    opts->limits = &limits_conf;
+    get_pipeline_defines(&opts->defines, args.defines);
+    get_pipeline_defines(&opts->spec_defines, args.spec_defines);
+    get_pipeline_defines(&opts->spec_values, args.spec_values);
+    opts->unorm_textures = args.unorm_textures;
+    get_binding_bases(args, opts->bind_bases);
+    opts->shift_bindings = args.bind_bases != nullptr;
+    opts->invert_y = args.invert_y != 0;
+    opts->flatten_ubos = args.flatten_ubos != 0;
+    opts->strip_unused = args.strip_unused != 0;
+    opts->link_varyings = args.link_varyings != 0;
+    opts->pack_varyings = args.pack_varyings != 0;
+    opts->infer_mediump = args.infer_mediump != 0;
+    opts->minify = args.minify != 0;
+    opts->pack_ubos = args.pack_ubos != 0;
+    opts->split_ubos = args.split_ubos != 0;
+    opts->auto_bind = args.auto_bind != 0;
+    opts->combine_samplers = args.combine_samplers != 0;
+    opts->msl_argument_buffers = args.msl_argument_buffers != 0;
+    opts->perf_lint = args.perf_lint != 0;
+    opts->stats = args.stats != 0;
+    opts->timings = nullptr;
 }
 
 static const char* get_stage_name(EShLanguage stage)
@@ -482,6 +559,34 @@ static const char* get_stage_name(EShLanguage stage)
     }
 }
 
+static uint32_t get_sgs_stage(EShLanguage stage)
+{
+    switch (stage) {
+    case EShLangVertex:
+        return SGS_STAGE_VERTEX;
+    case EShLangFragment:
+        return SGS_STAGE_FRAGMENT;
+    case EShLangCompute:
+        return SGS_STAGE_COMPUTE;
+    default:
+        return 0;
+    }
+}
+
+// names seperated by comma or ';'
+static void parse_names(std::vector<std::string>* names, const char* arg)
+{
+    for (const char* name = arg; name; ) {
+        name = sx_skip_whitespace(name);
+        const char* end = name;
+        while (*end && *end != ',' && *end != ';')
+            end++;
+        if (end > name)
+            names->push_back(std::string(name, end - name));
+        name = *end ? end + 1 : nullptr;
+    }
+}
+
 static void parse_includes(cmd_args* args, const char* includes)
 {
     sx_assert(includes);
@@ -509,27 +614,6 @@ static void parse_includes(cmd_args* args, const char* includes)
     } while (inc);
 }
 
-static void add_defines(glslang::TShader* shader, const cmd_args& args, std::string& def)
-{
-    std::vector<std::string> processes;
-
-    for (int i = 0; i < sx_array_count(args.defines); i++) {
-        const p_define& d = args.defines[i];
-        def += "#define " + std::string(d.def);
-        if (d.val) {
-            def += std::string(" ") + std::string(d.val);
-        }
-        def += std::string("\n");
-
-        char process[256];
-        sx_snprintf(process, sizeof(process), "D%s", d.def);
-        processes.push_back(process);
-    }
-
-    shader->setPreamble(def.c_str());
-    shader->addProcesses(processes);
-}
-
 enum resource_type {
     RES_TYPE_REGULAR = 0,
     RES_TYPE_SSBO,
@@ -538,33 +622,6 @@ enum resource_type {
     RES_TYPE_UNIFORM_BUFFER
 };
 
-struct uniform_type_mapping {
-    spirv_cross::SPIRType::BaseType base_type;
-    int vec_size;
-    int columns;
-    const char* type_str;
-    uint32_t fourcc;
-};
-
-static const uniform_type_mapping k_uniform_map[] = {
-    { spirv_cross::SPIRType::Float, 1, 1, "float", SGS_VERTEXFORMAT_FLOAT },
-    { spirv_cross::SPIRType::Float, 2, 1, "float2", SGS_VERTEXFORMAT_FLOAT2 },
-    { spirv_cross::SPIRType::Float, 3, 1, "float3", SGS_VERTEXFORMAT_FLOAT3 },
-    { spirv_cross::SPIRType::Float, 4, 1, "float4", SGS_VERTEXFORMAT_FLOAT4 },
-    { spirv_cross::SPIRType::Float, 3, 4, "mat3x4", 0 },
-    { spirv_cross::SPIRType::Float, 3, 4, "mat4x3", 0 },
-    { spirv_cross::SPIRType::Float, 3, 3, "mat3x3", 0 },
-    { spirv_cross::SPIRType::Float, 4, 4, "mat4", 0 },
-    { spirv_cross::SPIRType::Int, 1, 1, "int", SGS_VERTEXFORMAT_INT },
-    { spirv_cross::SPIRType::Int, 2, 1, "int2", SGS_VERTEXFORMAT_INT2 },
-    { spirv_cross::SPIRType::Int, 3, 1, "int3", SGS_VERTEXFORMAT_INT3 },
-    { spirv_cross::SPIRType::Int, 4, 1, "int4", SGS_VERTEXFORMAT_INT4 },
-    { spirv_cross::SPIRType::Half, 4, 1, "float", SGS_VERTEXFORMAT_FLOAT },
-    { spirv_cross::SPIRType::Half, 4, 2, "float2", SGS_VERTEXFORMAT_FLOAT2 },
-    { spirv_cross::SPIRType::Half, 4, 3, "float3", SGS_VERTEXFORMAT_FLOAT3 },
-    { spirv_cross::SPIRType::Half, 4, 4, "float4", SGS_VERTEXFORMAT_FLOAT4 }
-};
-
 enum ImageFormat {
     ImageFormatUnknown = 0,
     ImageFormatRgba32f = 1,
@@ -673,39 +730,96 @@ const char* k_texture_dim_str[spv::DimSubpassData + 1] = {
     "subpass_data"
 };
 
-const uint32_t k_texture_dim_fourcc[spv::DimSubpassData + 1] = {
-    SGS_IMAGEDIM_1D,
-    SGS_IMAGEDIM_2D,
-    SGS_IMAGEDIM_3D,
-    SGS_IMAGEDIM_CUBE,
-    SGS_IMAGEDIM_RECT,
-    SGS_IMAGEDIM_BUFFER,
-    SGS_IMAGEDIM_SUBPASS
-};
+static void output_message(const cmd_args& args, const char* filepath, int line, bool warning, const char* msg)
+{
+    if (args.err_format == OUTPUT_ERRORFORMAT_GLSLANG) {
+        fprintf(stdout, "%s: 0:%d:%s\n", warning ? "WARNING" : "ERROR", line, msg);
+    } else {
+        char fullpath[256];
+        sx_os_path_abspath(fullpath, sizeof(fullpath), filepath);
+        if (args.err_format == OUTPUT_ERRORFORMAT_MSVC)
+            fprintf(stderr, "%s(%d,0): %s:%s\n", fullpath, line, warning ? "warning" : "error", msg);
+        else if (args.err_format == OUTPUT_ERRORFORMAT_GCC)
+            fprintf(stderr, "%s:%d:0: %s:%s\n", fullpath, line, warning ? "warning" : "error", msg);
+    }
+}
+
+static void output_compute_info_json(json_writer* jw, const compute_info& info)
+{
+    json_begin_array(jw, "workgroup_size");
+    for (int i = 0; i < 3; i++)
+        json_put_int(jw, nullptr, info.workgroup_size[i]);
+    json_end_array(jw);
+    if (info.workgroup_size_spec_ids[0] != -1 || info.workgroup_size_spec_ids[1] != -1 ||
+        info.workgroup_size_spec_ids[2] != -1) {
+        json_begin_array(jw, "workgroup_size_spec_ids");
+        for (int i = 0; i < 3; i++)
+            json_put_int(jw, nullptr, info.workgroup_size_spec_ids[i]);
+        json_end_array(jw);
+    }
+    json_put_int(jw, "shared_memory_size", info.shared_memory_size);
+}
+
+// returns false if the stage exceeds a limit of the --limits file
+static bool check_limits(const cmd_args& args, const std::vector<limit_usage>& usage, const char* filename)
+{
+    bool r = true;
+    bool reported = false;
+    for (const limit_usage& u : usage) {
+        if (args.limits_report) {
+            printf("%s: %s %d/%d (%d%%)\n", filename, u.name, u.used, u.limit,
+                   u.limit > 0 ? (u.used * 100 / u.limit) : 0);
+        }
+        if (u.used > u.limit && (args.limits_filepath || u.warn)) {
+            char msg[256];
+            sx_snprintf(msg, sizeof(msg), " limits: %s is %d, the limit is %d", u.name, u.used, u.limit);
+            if (!reported && args.err_format == OUTPUT_ERRORFORMAT_GLSLANG)
+                fprintf(stdout, "%s\n", filename);
+            output_message(args, filename, 0, !args.limits_filepath, msg);
+            reported = true;
+            r = r && !args.limits_filepath;
+        }
+    }
+    return r;
+}
+
+// flattened blocks of --split-ubos are uploaded separately, the engine tracks dirty ranges by frequency
+static void write_ubo_frequency(json_writer* jw, const std::string& block_name)
+{
+    for (const ubo_split_part& part : g_ubo_splits) {
+        if (part.name == block_name) {
+            json_put_string(jw, "block", part.block.c_str());
+            if (part.freq != UBO_FREQUENCY_NONE)
+                json_put_string(jw, "frequency", ubo_frequency_str(part.freq));
+            return;
+        }
+    }
+    ubo_frequency freq = ubo_frequency_from_name(block_name.c_str());
+    if (freq != UBO_FREQUENCY_NONE)
+        json_put_string(jw, "frequency", ubo_frequency_str(freq));
+}
 
 // https://github.com/KhronosGroup/SPIRV-Cross/wiki/Reflection-API-user-guide
-static void output_resource_info_json(sjson_context* jctx, sjson_node* jparent,
+static void output_resource_info_json(json_writer* jw, const char* jkey,
     const spirv_cross::Compiler& compiler,
     const spirv_cross::SmallVector<spirv_cross::Resource>& ress,
     resource_type res_type = RES_TYPE_REGULAR,
-    bool flatten_ubos = false)
+    bool flatten_ubos = false,
+    bool split_ubos = false,
+    bool vertex_formats = false)
 {
 
     auto resolve_variable_type = [](const spirv_cross::SPIRType& type) -> const char* {
-        int count = sizeof(k_uniform_map) / sizeof(uniform_type_mapping);
-        for (int i = 0; i < count; i++) {
-            if (k_uniform_map[i].base_type == type.basetype && k_uniform_map[i].vec_size == type.vecsize && k_uniform_map[i].columns == type.columns) {
-                return k_uniform_map[i].type_str;
-            }
-        }
-        return "unknown";
+        const uniform_type_mapping* mapping = find_uniform_type(type);
+        return mapping ? mapping->type_str : "unknown";
     };
 
+    json_begin_array(jw, jkey);
     for (auto& res : ress) {
-        sjson_node* jres = sjson_mkobject(jctx);
         auto& type = compiler.get_type(res.type_id);
         if (res_type == RES_TYPE_SSBO && compiler.buffer_is_hlsl_counter_buffer(res.id))
             continue;
+        json_begin_object(jw);
 
         // If we don't have a name, use the fallback for the type instead of the variable
         // for SSBOs and UBOs since those are the only meaningful names to use externally.
@@ -729,152 +843,348 @@ static void output_resource_info_json(sjson_context* jctx, sjson_node* jparent,
         else
             mask = compiler.get_decoration_bitset(res.id);
 
-        sjson_put_int(jctx, jres, "id", res.id);
-        sjson_put_string(jctx, jres, "name",
+        json_put_int(jw, "id", res.id);
+        json_put_string(jw, "name",
             !res.name.empty() ? res.name.c_str() : compiler.get_fallback_name(fallback_id).c_str());
 
         if (!type.array.empty()) {
             int arr_sz = 0;
             for (auto arr : type.array)
                 arr_sz += arr;
-            sjson_put_int(jctx, jres, "array", arr_sz);
+            json_put_int(jw, "array", arr_sz);
         }
 
         int loc = -1;
         if (mask.get(spv::DecorationLocation)) {
             loc = compiler.get_decoration(res.id, spv::DecorationLocation);
-            sjson_put_int(jctx, jres, "location", loc);
+            json_put_int(jw, "location", loc);
         }
 
         if (mask.get(spv::DecorationDescriptorSet)) {
-            sjson_put_int(jctx, jres, "set",
+            json_put_int(jw, "set",
                 compiler.get_decoration(res.id, spv::DecorationDescriptorSet));
         }
         if (mask.get(spv::DecorationBinding)) {
-            sjson_put_int(jctx, jres, "binding",
+            json_put_int(jw, "binding",
                 compiler.get_decoration(res.id, spv::DecorationBinding));
         }
         if (mask.get(spv::DecorationInputAttachmentIndex)) {
-            sjson_put_int(jctx, jres, "attachment",
+            json_put_int(jw, "attachment",
                 compiler.get_decoration(res.id, spv::DecorationInputAttachmentIndex));
         }
         if (mask.get(spv::DecorationNonReadable))
-            sjson_put_bool(jctx, jres, "writeonly", true);
+            json_put_bool(jw, "writeonly", true);
         if (mask.get(spv::DecorationNonWritable))
-            sjson_put_bool(jctx, jres, "readonly", true);
+            json_put_bool(jw, "readonly", true);
         if (is_sized_block) {
-            sjson_put_int(jctx, jres, "block_size", block_size);
+            json_put_int(jw, "block_size", block_size);
             if (runtime_array_stride)
-                sjson_put_int(jctx, jres, "unsized_array_stride", runtime_array_stride);
+                json_put_int(jw, "unsized_array_stride", runtime_array_stride);
         }
 
-        if (res_type == RES_TYPE_VERTEX_INPUT && loc != -1) {
-            sjson_put_string(jctx, jres, "semantic", k_attrib_sem_names[loc]);
-            sjson_put_int(jctx, jres, "semantic_index", k_attrib_sem_indices[loc]);
+        if (res_type == RES_TYPE_VERTEX_INPUT && loc >= 0 && loc < VERTEX_ATTRIB_COUNT) {
+            json_put_string(jw, "semantic", k_attrib_sem_names[loc]);
+            json_put_int(jw, "semantic_index", k_attrib_sem_indices[loc]);
         }
 
         uint32_t counter_id = 0;
         if (res_type == RES_TYPE_SSBO && compiler.buffer_get_hlsl_counter_buffer(res.id, counter_id))
-            sjson_put_int(jctx, jres, "hlsl_counter_buffer_id", counter_id);
+            json_put_int(jw, "hlsl_counter_buffer_id", counter_id);
 
         // Some extra
         if (res_type == RES_TYPE_UNIFORM_BUFFER) {
             if (flatten_ubos) {
-                sjson_put_string(jctx, jres, "type", "float4");
-                sjson_put_int(jctx, jres, "array", sx_max((int)block_size, 16) / 16);
+                json_put_string(jw, "type", "float4");
+                json_put_int(jw, "array", (sx_max((int)block_size, 16) + 15) / 16);
+                if (split_ubos)
+                    write_ubo_frequency(jw, compiler.get_name(res.base_type_id));
             }
 
-            sjson_node* jmembers = sjson_put_array(jctx, jres, "members");
+            json_begin_array(jw, "members");
             // members
             int member_idx = 0;
             for (auto& member_id : type.member_types) {
-                sjson_node* jmember = sjson_mkobject(jctx);
+                json_begin_object(jw);
                 auto& member_type = compiler.get_type(member_id);
 
-                sjson_put_string(jctx, jmember, "name", compiler.get_member_name(type.self, member_idx).c_str());
-                sjson_put_string(jctx, jmember, "type", resolve_variable_type(member_type));
-                sjson_put_int(jctx, jmember, "offset", compiler.type_struct_member_offset(type, member_idx));
-                sjson_put_int(jctx, jmember, "size", (int)compiler.get_declared_struct_member_size(type, member_idx));
+                json_put_string(jw, "name", compiler.get_member_name(type.self, member_idx).c_str());
+                json_put_string(jw, "type", resolve_variable_type(member_type));
+                json_put_int(jw, "offset", compiler.type_struct_member_offset(type, member_idx));
+                json_put_int(jw, "size", (int)compiler.get_declared_struct_member_size(type, member_idx));
                 if (!member_type.array.empty()) {
                     int arr_sz = 0;
                     for (auto arr : member_type.array)
                         arr_sz += arr;
-                    sjson_put_int(jctx, jmember, "array", arr_sz);
+                    json_put_int(jw, "array", arr_sz);
                 }
 
-                sjson_append_element(jmembers, jmember);
+                json_end_object(jw);
                 member_idx++;
             }
+            json_end_array(jw);
         } else if (res_type == RES_TYPE_TEXTURE) {
-            sjson_put_string(jctx, jres, "dimension", k_texture_dim_str[type.image.dim]);
-            sjson_put_string(jctx, jres, "format", k_texture_format_str[type.image.format]);
+            json_put_string(jw, "dimension", k_texture_dim_str[type.image.dim]);
+            json_put_string(jw, "format", k_texture_format_str[type.image.format]);
             if (type.image.ms)
-                sjson_put_bool(jctx, jres, "multisample", true);
+                json_put_bool(jw, "multisample", true);
             if (type.image.arrayed)
-                sjson_put_bool(jctx, jres, "array", true);
+                json_put_bool(jw, "array", true);
         } else if (res_type == RES_TYPE_VERTEX_INPUT) {
-            sjson_put_string(jctx, jres, "type", resolve_variable_type(type));
+            json_put_string(jw, "type", resolve_variable_type(type));
+
+            if (vertex_formats) {
+                bool mediump;
+                const vertex_format_mapping* compact = get_compact_vertex_format(compiler, res, loc, &mediump);
+                json_put_string(jw, "precision", mediump ? "mediump" : "highp");
+                if (compact) {
+                    json_put_string(jw, "compact_format", compact->format_str);
+                    json_put_int(jw, "compact_size", compact->size);
+                }
+            }
+        }
+
+        json_end_object(jw);
+    }
+    json_end_array(jw);
+}
+
+// specialization constants are overridden with function constants in MSL and macros in the other languages
+static void output_spec_constants_json(json_writer* jw, const cmd_args& args,
+    const spirv_cross::Compiler& compiler,
+    const spirv_cross::SmallVector<spirv_cross::SpecializationConstant>& spec_consts)
+{
+    json_begin_array(jw, "spec_constants");
+    for (auto& sc : spec_consts) {
+        const spec_type_mapping* type = resolve_spec_type(compiler, sc);
+        if (!type)
+            continue;
+        const spirv_cross::SPIRConstant& c = compiler.get_constant(sc.id);
+
+        json_begin_object(jw);
+        json_put_int(jw, "id", sc.id);
+        json_put_string(jw, "name", compiler.get_name(sc.id).c_str());
+        json_put_int(jw, "constant_id", sc.constant_id);
+        json_put_string(jw, "type", type->type_str);
+        switch (type->base_type) {
+        case spirv_cross::SPIRType::Boolean:
+            json_put_bool(jw, "value", c.scalar() != 0);
+            break;
+        case spirv_cross::SPIRType::Int:
+            json_put_int(jw, "value", c.scalar_i32());
+            break;
+        case spirv_cross::SPIRType::UInt:
+            json_put_double(jw, "value", c.scalar());
+            break;
+        default:
+            json_put_double(jw, "value", c.scalar_f32());
+            break;
+        }
+
+        // MSL falls back to macros before 1.2 and for constants that size arrays
+        if (args.lang == SHADER_LANG_MSL && !c.is_used_as_array_length &&
+            static_cast<const spirv_cross::CompilerMSL&>(compiler).get_msl_options().supports_msl_version(1, 2)) {
+            json_put_int(jw, "function_constant", sc.constant_id);
+        } else {
+            char macro[64];
+            sx_snprintf(macro, sizeof(macro), "SPIRV_CROSS_CONSTANT_ID_%u", sc.constant_id);
+            json_put_string(jw, "macro", macro);
+        }
+        json_end_object(jw);
+    }
+    json_end_array(jw);
+}
+
+// contiguous binding range of each resource class and set, arrays take a binding per element
+// HLSL storage buffers are in the ranges of their registers: textures (read-only) or images (writable)
+static void output_binding_ranges_json(json_writer* jw, const spirv_cross::Compiler& compiler,
+                                       const spirv_cross::ShaderResources& ress, bool hlsl)
+{
+    const spirv_cross::SmallVector<spirv_cross::Resource>* k_class_ress[BINDING_CLASS_COUNT][3] = {
+        { &ress.uniform_buffers, nullptr, nullptr },
+        { &ress.storage_buffers, nullptr, nullptr },
+        { &ress.sampled_images, &ress.separate_images, &ress.storage_buffers },
+        { &ress.storage_images, &ress.storage_buffers, nullptr },
+        { &ress.separate_samplers, nullptr, nullptr }
+    };
+
+    json_begin_array(jw, "binding_ranges");
+    for (int c = 0; c < BINDING_CLASS_COUNT; c++) {
+        // set -> first, end
+        std::map<uint32_t, std::pair<uint32_t, uint32_t>> ranges;
+        for (int k = 0; k < 3; k++) {
+            if (!k_class_ress[c][k])
+                continue;
+            bool ssbos = k_class_ress[c][k] == &ress.storage_buffers;
+            if (ssbos && hlsl != (c != BINDING_CLASS_STORAGE_BUFFER))
+                continue;
+            for (auto& res : *k_class_ress[c][k]) {
+                if (!compiler.has_decoration(res.id, spv::DecorationBinding))
+                    continue;
+                if (ssbos && hlsl &&
+                    compiler.get_buffer_block_flags(res.id).get(spv::DecorationNonWritable) != (c == BINDING_CLASS_TEXTURE)) {
+                    continue;
+                }
+                const spirv_cross::SPIRType& type = compiler.get_type(res.type_id);
+                uint32_t count = 1;
+                for (auto arr : type.array)
+                    count *= arr;
+                uint32_t set = compiler.get_decoration(res.id, spv::DecorationDescriptorSet);
+                uint32_t binding = compiler.get_decoration(res.id, spv::DecorationBinding);
+                auto it = ranges.find(set);
+                if (it == ranges.end()) {
+                    ranges[set] = std::make_pair(binding, binding + count);
+                } else {
+                    it->second.first = std::min(it->second.first, binding);
+                    it->second.second = std::max(it->second.second, binding + count);
+                }
+            }
+        }
+
+        for (auto& r : ranges) {
+            json_begin_object(jw);
+            json_put_string(jw, "class", binding_class_str(binding_class(c)));
+            json_put_int(jw, "set", r.first);
+            json_put_int(jw, "first", r.second.first);
+            json_put_int(jw, "count", r.second.second - r.second.first);
+            json_end_object(jw);
+        }
+    }
+    json_end_array(jw);
+}
+
+
+// source image and sampler of each combined sampler
+static void output_combined_samplers_json(json_writer* jw, const spirv_cross::Compiler& compiler)
+{
+    json_begin_array(jw, "combined_samplers");
+    for (auto& c : compiler.get_combined_image_samplers()) {
+        json_begin_object(jw);
+        json_put_int(jw, "id", c.combined_id);
+        json_put_string(jw, "name", compiler.get_name(c.combined_id).c_str());
+        json_put_int(jw, "binding", get_binding(compiler, c.combined_id));
+        json_put_string(jw, "image", compiler.get_name(c.image_id).c_str());
+        json_put_int(jw, "image_binding", get_binding(compiler, c.image_id));
+        if (!is_dummy_sampler(compiler, c.sampler_id)) {
+            json_put_string(jw, "sampler", compiler.get_name(c.sampler_id).c_str());
+            json_put_int(jw, "sampler_binding", get_binding(compiler, c.sampler_id));
+        }
+        json_end_object(jw);
+    }
+    json_end_array(jw);
+}
+
+// argument buffers are bound to [[buffer(set)]]
+static void output_argument_buffers_json(json_writer* jw, const std::vector<msl_argument>& margs)
+{
+    json_begin_array(jw, "argument_buffers");
+    for (size_t i = 0; i < margs.size(); i++) {
+        const msl_argument& a = margs[i];
+        if (i == 0 || a.set != margs[i - 1].set) {
+            if (i > 0) {
+                json_end_array(jw);
+                json_end_object(jw);
+            }
+            json_begin_object(jw);
+            json_put_int(jw, "set", a.set);
+            json_put_int(jw, "buffer", a.set);
+            json_begin_array(jw, "members");
         }
 
-        sjson_append_element(jparent, jres);
+        json_begin_object(jw);
+        json_put_string(jw, "name", a.name.c_str());
+        json_put_int(jw, "id", a.id);
+        json_put_int(jw, "offset", a.offset);
+        json_put_string(jw, "kind", a.kind_str);
+        if (a.binding != -1)
+            json_put_int(jw, "binding", a.binding);
+        if (a.array_size > 1)
+            json_put_int(jw, "array", a.array_size);
+        json_end_object(jw);
     }
+    if (!margs.empty()) {
+        json_end_array(jw);
+        json_end_object(jw);
+    }
+    json_end_array(jw);
 }
 
 static void output_reflection_json(const cmd_args& args, const spirv_cross::Compiler& compiler,
     const spirv_cross::ShaderResources& ress,
     const char* filename,
-    EShLanguage stage, std::string* reflect_json, bool pretty = false)
+    EShLanguage stage, const compute_info* cs, std::string* reflect_json, bool pretty = false)
 {
-    sjson_context* jctx = sjson_create_context(0, 0, (void*)g_alloc);
-    sx_assert(jctx);
-
-    sjson_node* jroot = sjson_mkobject(jctx);
-    sjson_put_string(jctx, jroot, "language", k_shader_types[args.lang]);
-    sjson_put_int(jctx, jroot, "profile_version", args.profile_ver);
+    // estimate the document size, so it is written with a single allocation in most cases
+    size_t num_ress = ress.subpass_inputs.size() + ress.stage_inputs.size() + ress.stage_outputs.size() +
+                      ress.sampled_images.size() + ress.separate_images.size() + ress.separate_samplers.size() +
+                      ress.storage_images.size() + ress.storage_buffers.size() + ress.uniform_buffers.size() +
+                      ress.push_constant_buffers.size() + ress.atomic_counters.size();
+    for (auto& ubo : ress.uniform_buffers)
+        num_ress += compiler.get_type(ubo.base_type_id).member_types.size();
+
+    json_writer jw;
+    json_init_writer(&jw, reflect_json, pretty ? "  " : nullptr, 512 + num_ress * (pretty ? 256 : 160));
+
+    json_begin_object(&jw);
+    json_put_string(&jw, "language", k_shader_types[args.lang]);
+    json_put_int(&jw, "profile_version", args.profile_ver);
     if (args.compile_bin)
-        sjson_put_bool(jctx, jroot, "bytecode", true);
+        json_put_bool(&jw, "bytecode", true);
     if (args.debug_bin)
-        sjson_put_bool(jctx, jroot, "debug_info", true);
+        json_put_bool(&jw, "debug_info", true);
     if (args.flatten_ubos)
-        sjson_put_bool(jctx, jroot, "flatten_ubos", true);
+        json_put_bool(&jw, "flatten_ubos", true);
 
-    sjson_node* jshader = sjson_put_obj(jctx, jroot, get_stage_name(stage));
-    sjson_put_string(jctx, jshader, "file", filename);
+    json_begin_object(&jw, get_stage_name(stage));
+    json_put_string(&jw, "file", filename);
+    if (cs)
+        output_compute_info_json(&jw, *cs);
 
     if (!ress.subpass_inputs.empty())
-        output_resource_info_json(jctx, sjson_put_array(jctx, jshader, "subpass_inputs"), compiler, ress.subpass_inputs);
+        output_resource_info_json(&jw, "subpass_inputs", compiler, ress.subpass_inputs);
     if (!ress.stage_inputs.empty())
-        output_resource_info_json(jctx, sjson_put_array(jctx, jshader, "inputs"), compiler, ress.stage_inputs,
-            (stage == EShLangVertex) ? RES_TYPE_VERTEX_INPUT : RES_TYPE_REGULAR);
+        output_resource_info_json(&jw, "inputs", compiler, ress.stage_inputs,
+            (stage == EShLangVertex) ? RES_TYPE_VERTEX_INPUT : RES_TYPE_REGULAR, false, false,
+            args.vertex_formats != 0);
     if (!ress.stage_outputs.empty())
-        output_resource_info_json(jctx, sjson_put_array(jctx, jshader, "outputs"), compiler, ress.stage_outputs);
+        output_resource_info_json(&jw, "outputs", compiler, ress.stage_outputs);
     if (!ress.sampled_images.empty())
-        output_resource_info_json(jctx, sjson_put_array(jctx, jshader, "textures"), compiler, ress.sampled_images, RES_TYPE_TEXTURE);
+        output_resource_info_json(&jw, "textures", compiler, ress.sampled_images, RES_TYPE_TEXTURE);
     if (!ress.separate_images.empty())
-        output_resource_info_json(jctx, sjson_put_array(jctx, jshader, "sep_images"), compiler, ress.separate_images);
+        output_resource_info_json(&jw, "sep_images", compiler, ress.separate_images);
     if (!ress.separate_samplers.empty())
-        output_resource_info_json(jctx, sjson_put_array(jctx, jshader, "sep_samplers"), compiler, ress.separate_samplers);
+        output_resource_info_json(&jw, "sep_samplers", compiler, ress.separate_samplers);
     if (!ress.storage_images.empty())
-        output_resource_info_json(jctx, sjson_put_array(jctx, jshader, "storage_images"), compiler, ress.storage_images, RES_TYPE_TEXTURE);
+        output_resource_info_json(&jw, "storage_images", compiler, ress.storage_images, RES_TYPE_TEXTURE);
     if (!ress.storage_buffers.empty())
-        output_resource_info_json(jctx, sjson_put_array(jctx, jshader, "storage_buffers"), compiler, ress.storage_buffers, RES_TYPE_SSBO);
+        output_resource_info_json(&jw, "storage_buffers", compiler, ress.storage_buffers, RES_TYPE_SSBO);
     if (!ress.uniform_buffers.empty()) {
-        output_resource_info_json(jctx, sjson_put_array(jctx, jshader, "uniform_buffers"), compiler, ress.uniform_buffers,
-            RES_TYPE_UNIFORM_BUFFER, args.flatten_ubos ? true : false);
+        output_resource_info_json(&jw, "uniform_buffers", compiler, ress.uniform_buffers,
+            RES_TYPE_UNIFORM_BUFFER, args.flatten_ubos ? true : false, args.split_ubos ? true : false);
     }
     if (!ress.push_constant_buffers.empty())
-        output_resource_info_json(jctx, sjson_put_array(jctx, jshader, "push_cbs"), compiler, ress.push_constant_buffers);
+        output_resource_info_json(&jw, "push_cbs", compiler, ress.push_constant_buffers);
     if (!ress.atomic_counters.empty())
-        output_resource_info_json(jctx, sjson_put_array(jctx, jshader, "counters"), compiler, ress.atomic_counters);
+        output_resource_info_json(&jw, "counters", compiler, ress.atomic_counters);
 
-    char* json_str;
-    if (!pretty)
-        json_str = sjson_encode(jctx, jroot);
-    else
-        json_str = sjson_stringify(jctx, jroot, "  ");
-    *reflect_json = json_str;
-    sjson_free_string(jctx, json_str);
-    sjson_destroy_context(jctx);
+    spirv_cross::SmallVector<spirv_cross::SpecializationConstant> spec_consts = compiler.get_specialization_constants();
+    if (!spec_consts.empty())
+        output_spec_constants_json(&jw, args, compiler, spec_consts);
+
+    if (args.lang == SHADER_LANG_MSL && args.msl_argument_buffers) {
+        std::vector<msl_argument> margs;
+        get_msl_arguments(static_cast<const spirv_cross::CompilerMSL&>(compiler), ress, &margs);
+        if (!margs.empty())
+            output_argument_buffers_json(&jw, margs);
+    }
+
+    if (args.auto_bind)
+        output_binding_ranges_json(&jw, compiler, ress, args.lang == SHADER_LANG_HLSL);
+
+    if (!compiler.get_combined_image_samplers().empty())
+        output_combined_samplers_json(&jw, compiler);
+
+    json_end_object(&jw);
+    json_end_object(&jw);
 }
 
 static void output_resource_info_bin(sx_mem_writer* w, uint32_t* num_values,
@@ -884,13 +1194,8 @@ static void output_resource_info_bin(sx_mem_writer* w, uint32_t* num_values,
     bool flatten_ubos = false)
 {
     auto resolve_variable_type = [](const spirv_cross::SPIRType& type) -> uint32_t {
-        int count = sizeof(k_uniform_map) / sizeof(uniform_type_mapping);
-        for (int i = 0; i < count; i++) {
-            if (k_uniform_map[i].base_type == type.basetype && k_uniform_map[i].vec_size == type.vecsize && k_uniform_map[i].columns == type.columns) {
-                return k_uniform_map[i].fourcc;
-            }
-        }
-        return 0;
+        const uniform_type_mapping* mapping = find_uniform_type(type);
+        return mapping ? mapping->fourcc : 0;
     };
 
     for (auto& res : ress) {
@@ -948,7 +1253,7 @@ static void output_resource_info_bin(sx_mem_writer* w, uint32_t* num_values,
             u.binding = binding;
             u.size_bytes = block_size;
             if (flatten_ubos) {
-                u.array_size = (uint16_t)sx_max((int)block_size, 16) / 16;
+                u.array_size = (uint16_t)((sx_max((int)block_size, 16) + 15) / 16);
             } else {
                 u.array_size = array_size;
             }
@@ -967,8 +1272,11 @@ static void output_resource_info_bin(sx_mem_writer* w, uint32_t* num_values,
 
             sx_strcpy(i.name, sizeof(i.name), name);
             i.loc = loc;
-            sx_strcpy(i.semantic, sizeof(i.semantic), k_attrib_sem_names[loc]);
-            i.semantic_index = k_attrib_sem_indices[loc];
+            // inputs without a location or past the known semantics have no semantic
+            if (loc >= 0 && loc < VERTEX_ATTRIB_COUNT) {
+                sx_strcpy(i.semantic, sizeof(i.semantic), k_attrib_sem_names[loc]);
+                i.semantic_index = k_attrib_sem_indices[loc];
+            }
             i.format = resolve_variable_type(type);
             sx_mem_write_var(w, i);
         } else if (res_type == RES_TYPE_SSBO) {
@@ -1033,326 +1341,736 @@ static void output_reflection_bin(const cmd_args& args, const spirv_cross::Compi
     *refl_mem = w.mem;
 }
 
-// if binary_size > 0, then we assume the data is binary
-static bool write_file(const char* filepath, const char* data, const char* cvar,
-    bool append = false, int binary_size = -1)
-{
-    sx_file_writer writer;
-    if (!sx_file_open_writer(&writer, filepath, append ? SX_FILE_OPEN_APPEND : 0))
-        return false;
-
-    if (cvar && cvar[0]) {
-        const int items_per_line = 8;
-
-        // .C file
-        if (!append) {
-            // file header
-            char header[512];
-            sx_snprintf(header, sizeof(header),
-                "// This file is automatically created by glslcc v%d.%d.%d\n"
-                "// http://www.github.com/septag/glslcc\n"
-                "// \n"
-                "#pragma once\n\n",
-                VERSION_MAJOR, VERSION_MINOR, VERSION_SUB);
-            sx_file_write_text(&writer, header);
-        }
-
-        char var[128];
-        int len;
-        int char_offset = 0;
-        char hex[32];
-
-        if (binary_size > 0)
-            len = binary_size;
-        else
-            len = sx_strlen(data) + 1; // include the '\0' at the end to null-terminate the string
-
-        // align data to uint32_t (4)
-        const uint32_t* aligned_data = (const uint32_t*)data;
-        int aligned_len = sx_align_mask(len, 3);
-        if (aligned_len > len) {
-            uint32_t* tmp = (uint32_t*)sx_malloc(g_alloc, aligned_len);
-            if (!tmp) {
-                sx_out_of_memory();
-                return false;
-            }
-            sx_memcpy(tmp, data, len);
-            sx_memset((uint8_t*)tmp + len, 0x0, aligned_len - len);
-            aligned_data = tmp;
-        }
-        const char* aligned_ptr = (const char*)aligned_data;
+// string pool for REF2 reflection chunk, each unique string is stored once
+// SPC2 and the other chunks of --refl-v2 keep their names in the pool of the stage's REF2 chunk
+struct refl_string_pool {
+    std::string data;
+    std::unordered_map<std::string, uint32_t> offsets;
 
-        sx_snprintf(var, sizeof(var), "static const unsigned int %s_size = %d;\n", cvar, len);
-        sx_file_write_text(&writer, var);
-        sx_snprintf(var, sizeof(var), "static const unsigned int %s_data[%d/4] = {\n\t", cvar, aligned_len);
-        sx_file_write_text(&writer, var);
+    uint32_t add(const char* str)
+    {
+        auto it = offsets.find(str);
+        if (it != offsets.end())
+            return it->second;
+        uint32_t offset = (uint32_t)data.length();
+        data.append(str, sx_strlen(str) + 1);
+        offsets[str] = offset;
+        return offset;
+    }
+};
 
-        sx_assert(aligned_len % sizeof(uint32_t) == 0);
-        int uint_count = aligned_len / 4;
-        for (int i = 0; i < uint_count; i++) {
-            if (i != uint_count - 1) {
-                sx_snprintf(hex, sizeof(hex), "0x%08x, ", *aligned_data);
-            } else {
-                sx_snprintf(hex, sizeof(hex), "0x%08x };\n", *aligned_data);
-            }
-            sx_file_write_text(&writer, hex);
+// names of the chunks without a string pool are char[32], longer names are cut with a warning
+static void copy_chunk_name(const cmd_args& args, const char* filename, uint32_t chunk, char* dst, int dst_size,
+                            const std::string& name)
+{
+    if ((int)name.length() >= dst_size) {
+        char msg[512];
+        sx_snprintf(msg, sizeof(msg), " %.4s chunk: '%s' is cut to %d characters, use --refl-v2 for long names",
+                    (const char*)&chunk, name.c_str(), dst_size - 1);
+        if (args.err_format == OUTPUT_ERRORFORMAT_GLSLANG)
+            fprintf(stdout, "%s\n", filename);
+        output_message(args, filename, 0, true, msg);
+    }
+    sx_strcpy(dst, dst_size, name.c_str());
+}
 
-            ++char_offset;
-            if (char_offset == items_per_line) {
-                sx_file_write_text(&writer, "\n\t");
-                char_offset = 0;
-            }
+// SPEC chunk, or SPC2 if strs is set, returns false if there are no scalar specialization constants in the shader
+static bool output_spec_constants_bin(const cmd_args& args, const char* filename,
+                                      const spirv_cross::Compiler& compiler, refl_string_pool* strs,
+                                      sx_mem_block** spec_mem)
+{
+    sx_mem_writer w;
+    sx_mem_init_writer(&w, g_alloc, 256);
 
-            ++aligned_data;
-        }
+    sgs_chunk_spec spec;
+    sx_memset(&spec, 0x0, sizeof(spec));
+    sx_mem_write_var(&w, spec);
 
-        sx_file_write_text(&writer, "\n");
+    for (auto& sc : compiler.get_specialization_constants()) {
+        const spec_type_mapping* type = resolve_spec_type(compiler, sc);
+        if (!type)
+            continue;
 
-        if (aligned_ptr != data) {
-            sx_free(g_alloc, const_cast<char*>(aligned_ptr));
+        const std::string& name = compiler.get_name(sc.id);
+        if (strs) {
+            sgs_refl2_spec_constant s;
+            s.name = strs->add(name.c_str());
+            s.name_hash = sx_hash_fnv32_str(name.c_str());
+            s.constant_id = sc.constant_id;
+            s.type = type->fourcc;
+            s.value = compiler.get_constant(sc.id).scalar();
+            sx_mem_write_var(&w, s);
+        } else {
+            sgs_refl_spec_constant s;
+            sx_memset(&s, 0x0, sizeof(s));
+            copy_chunk_name(args, filename, SGS_CHUNK_SPEC, s.name, sizeof(s.name), name);
+            s.constant_id = sc.constant_id;
+            s.type = type->fourcc;
+            s.value = compiler.get_constant(sc.id).scalar();
+            sx_mem_write_var(&w, s);
         }
-    } else {
-        if (binary_size > 0)
-            sx_file_write(&writer, data, binary_size);
-        else
-            sx_file_write(&writer, data, sx_strlen(data));
+        spec.num_constants++;
     }
 
-    sx_file_close_writer(&writer);
-    return true;
+    sx_mem_seekw(&w, 0, SX_WHENCE_BEGIN);
+    sx_mem_write_var(&w, spec);
+
+    *spec_mem = sx_mem_create_block(g_alloc, (int)w.top, w.mem->data);
+    sx_mem_release_writer(&w);
+    return spec.num_constants > 0;
 }
 
-static int cross_compile(const cmd_args& args, std::vector<uint32_t>& spirv,
-    const char* filename, EShLanguage stage, int file_index)
+// CSMP chunk, or CSM2 if strs is set
+static bool output_combined_samplers_bin(const cmd_args& args, const char* filename,
+                                         const spirv_cross::Compiler& compiler, refl_string_pool* strs,
+                                         sx_mem_block** csmp_mem)
 {
-    sx_assert(!spirv.empty());
-    // Using SPIRV-cross
-
-    try {
-        std::unique_ptr<spirv_cross::CompilerGLSL> compiler;
-        // Use spirv-cross to convert to other types of shader
-        if (args.lang == SHADER_LANG_GLES || args.lang == SHADER_LANG_GLSL) {
-            compiler = std::unique_ptr<spirv_cross::CompilerGLSL>(new spirv_cross::CompilerGLSL(spirv));
-        } else if (args.lang == SHADER_LANG_MSL) {
-            compiler = std::unique_ptr<spirv_cross::CompilerMSL>(new spirv_cross::CompilerMSL(spirv));
-        } else if (args.lang == SHADER_LANG_HLSL) {
-            compiler = std::unique_ptr<spirv_cross::CompilerHLSL>(new spirv_cross::CompilerHLSL(spirv));
+    sx_mem_writer w;
+    sx_mem_init_writer(&w, g_alloc, 256);
+
+    sgs_chunk_csmp csmp;
+    csmp.num_samplers = (uint32_t)compiler.get_combined_image_samplers().size();
+    sx_mem_write_var(&w, csmp);
+
+    for (auto& c : compiler.get_combined_image_samplers()) {
+        bool dummy = is_dummy_sampler(compiler, c.sampler_id);
+        const std::string& name = compiler.get_name(c.combined_id);
+        const std::string& image = compiler.get_name(c.image_id);
+        std::string sampler = dummy ? std::string() : compiler.get_name(c.sampler_id);
+        if (strs) {
+            sgs_refl2_combined_sampler r;
+            r.name = strs->add(name.c_str());
+            r.name_hash = sx_hash_fnv32_str(name.c_str());
+            r.binding = get_binding(compiler, c.combined_id);
+            r.image = strs->add(image.c_str());
+            r.image_binding = get_binding(compiler, c.image_id);
+            r.sampler = strs->add(sampler.c_str());
+            r.sampler_binding = dummy ? -1 : get_binding(compiler, c.sampler_id);
+            sx_mem_write_var(&w, r);
         } else {
-            sx_assert(0 && "Language not implemented");
-        }
-
-        spirv_cross::ShaderResources ress = compiler->get_shader_resources();
-
-        spirv_cross::CompilerGLSL::Options opts = compiler->get_common_options();
-        opts.flatten_multidimensional_arrays = true;
-        if (args.lang == SHADER_LANG_GLES) {
-            opts.es = true;
-            opts.version = args.profile_ver;
-        } else if (args.lang == SHADER_LANG_GLSL) {
-            opts.enable_420pack_extension = false;
-            opts.es = false;
-            opts.version = args.profile_ver;
-        } else if (args.lang == SHADER_LANG_HLSL) {
-            spirv_cross::CompilerHLSL* hlsl = (spirv_cross::CompilerHLSL*)compiler.get();
-            spirv_cross::CompilerHLSL::Options hlsl_opts = hlsl->get_hlsl_options();
-
-            hlsl_opts.shader_model = args.profile_ver;
-            hlsl_opts.point_size_compat = true;
-            hlsl_opts.point_coord_compat = true;
-
-            hlsl->set_hlsl_options(hlsl_opts);
-
-            uint32_t new_builtin = hlsl->remap_num_workgroups_builtin();
-            if (new_builtin) {
-                hlsl->set_decoration(new_builtin, spv::DecorationDescriptorSet, 0);
-                hlsl->set_decoration(new_builtin, spv::DecorationBinding, 0);
-            }
+            sgs_refl_combined_sampler r;
+            sx_memset(&r, 0x0, sizeof(r));
+            copy_chunk_name(args, filename, SGS_CHUNK_CSMP, r.name, sizeof(r.name), name);
+            r.binding = get_binding(compiler, c.combined_id);
+            copy_chunk_name(args, filename, SGS_CHUNK_CSMP, r.image, sizeof(r.image), image);
+            r.image_binding = get_binding(compiler, c.image_id);
+            copy_chunk_name(args, filename, SGS_CHUNK_CSMP, r.sampler, sizeof(r.sampler), sampler);
+            r.sampler_binding = dummy ? -1 : get_binding(compiler, c.sampler_id);
+            sx_mem_write_var(&w, r);
         }
+    }
 
-        // Flatten ubos
-        if (args.flatten_ubos) {
-            for (auto& ubo : ress.uniform_buffers)
-                compiler->flatten_buffer_block(ubo.id);
-            for (auto& ubo : ress.push_constant_buffers)
-                compiler->flatten_buffer_block(ubo.id);
-        }
+    *csmp_mem = sx_mem_create_block(g_alloc, (int)w.top, w.mem->data);
+    sx_mem_release_writer(&w);
+    return csmp.num_samplers > 0;
+}
 
-        // Reset vertex input locations for MSL
-        std::vector<int> old_locs;
-        if (args.lang == SHADER_LANG_MSL && stage == EShLangVertex) {
-            for (int i = 0; i < ress.stage_inputs.size(); i++) {
-                spirv_cross::Resource& res = ress.stage_inputs[i];
-                spirv_cross::Bitset mask = compiler->get_decoration_bitset(res.id);
+// UBSP chunk, or UBS2 if strs is set, returns false if no block of the stage is split
+static bool output_ubo_parts_bin(const cmd_args& args, const char* filename, const spirv_cross::Compiler& compiler,
+                                 const spirv_cross::ShaderResources& ress, refl_string_pool* strs,
+                                 sx_mem_block** ubsp_mem)
+{
+    static const uint32_t k_freq_fourccs[UBO_FREQUENCY_COUNT] = {
+        SGS_UBOFREQ_FRAME, SGS_UBOFREQ_MATERIAL, SGS_UBOFREQ_DRAW, 0
+    };
 
-                if (mask.get(spv::DecorationLocation)) {
-                    old_locs.push_back(compiler->get_decoration(res.id, spv::DecorationLocation));
-                    compiler->set_decoration(res.id, spv::DecorationLocation, (uint32_t)i);
-                } else {
-                    old_locs.push_back(-1);
-                }
+    sx_mem_writer w;
+    sx_mem_init_writer(&w, g_alloc, 256);
+
+    sgs_chunk_ubsp ubsp;
+    ubsp.num_parts = 0;
+    sx_mem_write_var(&w, ubsp);
+
+    // parts are matched with the reflected blocks by their block names, the ones that are stripped are skipped
+    for (auto& res : ress.uniform_buffers) {
+        const std::string& name = compiler.get_name(res.base_type_id);
+        for (const ubo_split_part& part : g_ubo_splits) {
+            if (part.name != name)
+                continue;
+
+            if (strs) {
+                sgs_refl2_ubo_part p;
+                p.name = strs->add(part.name.c_str());
+                p.name_hash = sx_hash_fnv32_str(part.name.c_str());
+                p.block = strs->add(part.block.c_str());
+                p.block_hash = sx_hash_fnv32_str(part.block.c_str());
+                p.binding = get_binding(compiler, res.id);
+                p.frequency = k_freq_fourccs[part.freq];
+                p.size_bytes = part.size;
+                sx_mem_write_var(&w, p);
+            } else {
+                sgs_refl_ubo_part p;
+                sx_memset(&p, 0x0, sizeof(p));
+                copy_chunk_name(args, filename, SGS_CHUNK_UBSP, p.name, sizeof(p.name), part.name);
+                copy_chunk_name(args, filename, SGS_CHUNK_UBSP, p.block, sizeof(p.block), part.block);
+                p.binding = get_binding(compiler, res.id);
+                p.frequency = k_freq_fourccs[part.freq];
+                p.size_bytes = part.size;
+                sx_mem_write_var(&w, p);
             }
+            ubsp.num_parts++;
+            break;
         }
+    }
 
-        compiler->set_common_options(opts);
+    sx_mem_seekw(&w, 0, SX_WHENCE_BEGIN);
+    sx_mem_write_var(&w, ubsp);
 
-        std::string code;
-        // Prepare vertex attribute remap for HLSL
-        if (args.lang == SHADER_LANG_HLSL) {
-            // std::vector<spirv_cross::HLSLVertexAttributeRemap> remaps;
-            spirv_cross::CompilerHLSL* hlsl_compiler = (spirv_cross::CompilerHLSL*)compiler.get();
-            for (int i = 0; i < VERTEX_ATTRIB_COUNT; i++) {
-                spirv_cross::HLSLVertexAttributeRemap remap = { (uint32_t)i, k_attrib_names[i] };
-                // remaps.push_back(std::move(remap));
-                hlsl_compiler->add_vertex_attribute_remap(remap);
-            }
+    *ubsp_mem = sx_mem_create_block(g_alloc, (int)w.top, w.mem->data);
+    sx_mem_release_writer(&w);
+    return ubsp.num_parts > 0;
+}
 
-            code = hlsl_compiler->compile();
-        } else {
-            code = compiler->compile();
-        }
+// VFMT chunk
+static bool output_vertex_formats_bin(const spirv_cross::Compiler& compiler, const spirv_cross::ShaderResources& ress,
+                                      sx_mem_block** vfmt_mem)
+{
+    sx_mem_writer w;
+    sx_mem_init_writer(&w, g_alloc, 256);
+
+    sgs_chunk_vfmt vfmt;
+    vfmt.num_inputs = (uint32_t)ress.stage_inputs.size();
+    sx_mem_write_var(&w, vfmt);
+
+    for (auto& res : ress.stage_inputs) {
+        int loc = compiler.has_decoration(res.id, spv::DecorationLocation) ?
+                  (int)compiler.get_decoration(res.id, spv::DecorationLocation) : -1;
+        bool mediump;
+        const vertex_format_mapping* compact = get_compact_vertex_format(compiler, res, loc, &mediump);
+        sgs_refl_vertex_format f;
+        f.loc = loc;
+        f.precision = mediump ? SGS_PRECISION_MEDIUM : SGS_PRECISION_HIGH;
+        f.format = compact ? compact->fourcc : 0;
+        f.size_bytes = compact ? compact->size : 0;
+        sx_mem_write_var(&w, f);
+    }
 
-        // Output code
-        if (g_sgs) {
-            uint32_t sstage;
-            switch (stage) {
-            case EShLangVertex:
-                sstage = SGS_STAGE_VERTEX;
-                break;
-            case EShLangFragment:
-                sstage = SGS_STAGE_FRAGMENT;
-                break;
-            case EShLangCompute:
-                sstage = SGS_STAGE_COMPUTE;
-                break;
-            default:
-                sstage = 0;
-                break;
+    *vfmt_mem = sx_mem_create_block(g_alloc, (int)w.top, w.mem->data);
+    sx_mem_release_writer(&w);
+    return vfmt.num_inputs > 0;
+}
+
+// ARGB chunk, or ARG2 if strs is set
+static void output_argument_buffers_bin(const cmd_args& args, const char* filename,
+                                        const std::vector<msl_argument>& margs, refl_string_pool* strs,
+                                        sx_mem_block** argbuf_mem)
+{
+    sx_mem_writer w;
+    sx_mem_init_writer(&w, g_alloc, 512);
+
+    sgs_chunk_argbuf argbuf;
+    argbuf.num_buffers = 0;
+    for (size_t i = 0; i < margs.size(); i++) {
+        if (i == 0 || margs[i].set != margs[i - 1].set)
+            argbuf.num_buffers++;
+    }
+    sx_mem_write_var(&w, argbuf);
+
+    for (size_t i = 0; i < margs.size(); i++) {
+        if (i > 0 && margs[i].set == margs[i - 1].set)
+            continue;
+
+        sgs_refl_argbuf b;
+        b.set = margs[i].set;
+        b.buffer_index = margs[i].set;
+        b.num_members = 0;
+        b.size_bytes = 0;
+        for (size_t k = i; k < margs.size() && margs[k].set == b.set; k++) {
+            b.num_members++;
+            b.size_bytes = margs[k].offset + 8 * margs[k].array_size;
+        }
+        sx_mem_write_var(&w, b);
+    }
+
+    for (const msl_argument& a : margs) {
+        if (strs) {
+            sgs_refl2_argbuf_member m;
+            m.name = strs->add(a.name.c_str());
+            m.name_hash = sx_hash_fnv32_str(a.name.c_str());
+            m.id = a.id;
+            m.offset = a.offset;
+            m.kind = a.kind;
+            m.binding = a.binding;
+            m.array_size = a.array_size;
+            sx_mem_write_var(&w, m);
+        } else {
+            sgs_refl_argbuf_member m;
+            sx_memset(&m, 0x0, sizeof(m));
+            copy_chunk_name(args, filename, SGS_CHUNK_ARGB, m.name, sizeof(m.name), a.name);
+            m.id = a.id;
+            m.offset = a.offset;
+            m.kind = a.kind;
+            m.binding = a.binding;
+            m.array_size = a.array_size;
+            sx_mem_write_var(&w, m);
+        }
+    }
+
+    *argbuf_mem = sx_mem_create_block(g_alloc, (int)w.top, w.mem->data);
+    sx_mem_release_writer(&w);
+}
+
+static void output_resource_info_bin2(sx_mem_writer* w, refl_string_pool* strs, uint32_t* num_values,
+    const spirv_cross::Compiler& compiler,
+    const spirv_cross::SmallVector<spirv_cross::Resource>& ress,
+    resource_type res_type = RES_TYPE_REGULAR,
+    bool flatten_ubos = false)
+{
+    auto resolve_variable_type = [](const spirv_cross::SPIRType& type) -> uint32_t {
+        const uniform_type_mapping* mapping = find_uniform_type(type);
+        return mapping ? mapping->fourcc : 0;
+    };
+
+    // SoA: hashes and bindings are written before the records, so they can be searched linearly
+    std::vector<uint32_t> hashes;
+    std::vector<int32_t> bindings;
+    sx_mem_writer rw;
+    sx_mem_init_writer(&rw, g_alloc, 512);
+
+    for (auto& res : ress) {
+        auto& type = compiler.get_type(res.type_id);
+        if (res_type == RES_TYPE_SSBO && compiler.buffer_is_hlsl_counter_buffer(res.id))
+            continue;
+
+        bool is_push_constant = compiler.get_storage_class(res.id) == spv::StorageClassPushConstant;
+        bool is_block = compiler.get_decoration_bitset(type.self).get(spv::DecorationBlock) || compiler.get_decoration_bitset(type.self).get(spv::DecorationBufferBlock);
+        bool is_sized_block = is_block && (compiler.get_storage_class(res.id) == spv::StorageClassUniform || compiler.get_storage_class(res.id) == spv::StorageClassUniformConstant);
+        uint32_t fallback_id = !is_push_constant && is_block ? (uint32_t)res.base_type_id : (uint32_t)res.id;
+
+        uint32_t block_size = 0;
+        uint32_t runtime_array_stride = 0;
+        if (is_sized_block) {
+            auto& base_type = compiler.get_type(res.base_type_id);
+            block_size = uint32_t(compiler.get_declared_struct_size(base_type));
+            runtime_array_stride = uint32_t(compiler.get_declared_struct_size_runtime_array(base_type, 1) - compiler.get_declared_struct_size_runtime_array(base_type, 0));
+        }
+
+        spirv_cross::Bitset mask;
+        if (res_type == RES_TYPE_SSBO)
+            mask = compiler.get_buffer_block_flags(res.id);
+        else
+            mask = compiler.get_decoration_bitset(res.id);
+
+        std::string name = !res.name.empty() ? res.name : compiler.get_fallback_name(fallback_id);
+
+        int array_size = 1;
+        if (!type.array.empty()) {
+            int arr_sz = 0;
+            for (auto arr : type.array)
+                arr_sz += arr;
+            array_size = arr_sz;
+        }
+
+        int loc = -1;
+        int binding = -1;
+        if (mask.get(spv::DecorationLocation)) {
+            loc = compiler.get_decoration(res.id, spv::DecorationLocation);
+        }
+
+        if (mask.get(spv::DecorationBinding)) {
+            binding = compiler.get_decoration(res.id, spv::DecorationBinding);
+        }
+
+        if (res_type == RES_TYPE_UNIFORM_BUFFER) {
+            sgs_refl2_uniformbuffer u = { 0 };
+            u.name = strs->add(name.c_str());
+            u.size_bytes = block_size;
+            if (flatten_ubos) {
+                u.array_size = (uint16_t)((sx_max((int)block_size, 16) + 15) / 16);
+            } else {
+                u.array_size = array_size;
             }
+            sx_mem_write_var(&rw, u);
+        } else if (res_type == RES_TYPE_TEXTURE) {
+            sgs_refl2_texture t = { 0 };
+            t.name = strs->add(name.c_str());
+            t.image_dim = k_texture_dim_fourcc[type.image.dim];
+            t.multisample = type.image.ms ? 1 : 0;
+            t.is_array = type.image.arrayed ? 1 : 0;
+            sx_mem_write_var(&rw, t);
+        } else if (res_type == RES_TYPE_VERTEX_INPUT) {
+            sgs_refl2_input i = { 0 };
+            i.name = strs->add(name.c_str());
+            bool has_semantic = loc >= 0 && loc < VERTEX_ATTRIB_COUNT;
+            i.semantic = strs->add(has_semantic ? k_attrib_sem_names[loc] : "");
+            i.semantic_index = has_semantic ? k_attrib_sem_indices[loc] : 0;
+            i.format = resolve_variable_type(type);
+            sx_mem_write_var(&rw, i);
+            binding = loc;
+        } else if (res_type == RES_TYPE_SSBO) {
+            sgs_refl2_buffer b = { 0 };
+            b.name = strs->add(name.c_str());
+            b.size_bytes = block_size;
+            b.array_stride = runtime_array_stride;
+            sx_mem_write_var(&rw, b);
+        }
 
-            if (args.compile_bin) {
-#ifdef BYTECODE_COMPILATION
-                sx_mem_block* mem = compile_binary(code.c_str(), args.out_filepath, args.profile_ver,
-                    stage, args.debug_bin);
-                if (!mem) {
-                    printf("Bytecode compilation of '%s' failed\n", args.out_filepath);
-                    return -1;
-                }
+        hashes.push_back(sx_hash_fnv32_str(name.c_str()));
+        bindings.push_back(binding);
+        ++(*num_values);
+    }
 
-                sgs_add_stage_code_bin(g_sgs, sstage, mem->data, mem->size);
-                sx_mem_destroy_block(mem);
-#endif
+    if (!hashes.empty()) {
+        sx_mem_write(w, hashes.data(), (int)(hashes.size() * sizeof(uint32_t)));
+        sx_mem_write(w, bindings.data(), (int)(bindings.size() * sizeof(int32_t)));
+        sx_mem_write(w, rw.mem->data, (int)rw.pos);
+    }
+    sx_mem_release_writer(&rw);
+}
+
+// strs can already have the names of the other chunks of the stage
+static void output_reflection_bin2(const cmd_args& args, const spirv_cross::Compiler& compiler,
+    const spirv_cross::ShaderResources& ress,
+    const char* filename,
+    EShLanguage stage, refl_string_pool* strs, sx_mem_block** refl_mem)
+{
+    sx_mem_writer w;
+    sx_mem_init_writer(&w, g_alloc, 1024);
+
+    char name[256];
+    sx_os_path_basename(name, sizeof(name), filename);
+
+    sgs_chunk_refl2 refl;
+    sx_memset(&refl, 0x0, sizeof(refl));
+    refl.name = strs->add(name);
+    refl.flatten_ubos = args.flatten_ubos;
+    refl.debug_info = args.debug_bin;
+    sx_mem_write_var(&w, refl);
+
+    if (!ress.stage_inputs.empty() && stage == EShLangVertex) {
+        output_resource_info_bin2(&w, strs, &refl.num_inputs, compiler, ress.stage_inputs, RES_TYPE_VERTEX_INPUT);
+    }
+
+    if (!ress.uniform_buffers.empty()) {
+        output_resource_info_bin2(&w, strs, &refl.num_uniform_buffers, compiler, ress.uniform_buffers,
+            RES_TYPE_UNIFORM_BUFFER, args.flatten_ubos ? true : false);
+    }
+
+    if (!ress.sampled_images.empty()) {
+        output_resource_info_bin2(&w, strs, &refl.num_textures, compiler, ress.sampled_images, RES_TYPE_TEXTURE);
+    }
+
+    if (stage == EShLangCompute) {
+        if (!ress.storage_images.empty()) {
+            output_resource_info_bin2(&w, strs, &refl.num_storage_images, compiler, ress.storage_images,
+                RES_TYPE_TEXTURE);
+        }
+
+        if (!ress.storage_buffers.empty()) {
+            output_resource_info_bin2(&w, strs, &refl.num_storage_buffers, compiler, ress.storage_buffers,
+                RES_TYPE_SSBO);
+        }
+    }
+
+    // string pool
+    refl.strings_size = (uint32_t)strs->data.length();
+    sx_mem_write(&w, strs->data.data(), (int)strs->data.length());
+
+    sx_mem_seekw(&w, 0, SX_WHENCE_BEGIN);
+    sx_mem_write_var(&w, refl);
+
+    // writer memory is over-allocated, copy only the written data
+    *refl_mem = sx_mem_create_block(g_alloc, (int)w.top, w.mem->data);
+    sx_mem_release_writer(&w);
+}
+
+// if binary_size > 0, then we assume the data is binary
+static bool write_file(const char* filepath, const char* data, const char* cvar,
+    bool append = false, int binary_size = -1)
+{
+    sx_file_writer writer;
+    if (!sx_file_open_writer(&writer, filepath, append ? SX_FILE_OPEN_APPEND : 0))
+        return false;
+
+    if (cvar && cvar[0]) {
+        const int items_per_line = 8;
+
+        // .C file
+        if (!append) {
+            // file header
+            char header[512];
+            sx_snprintf(header, sizeof(header),
+                "// This file is automatically created by glslcc v%d.%d.%d\n"
+                "// http://www.github.com/septag/glslcc\n"
+                "// \n"
+                "#pragma once\n\n",
+                VERSION_MAJOR, VERSION_MINOR, VERSION_SUB);
+            sx_file_write_text(&writer, header);
+        }
+
+        char var[128];
+        int len;
+        int char_offset = 0;
+        char hex[32];
+
+        if (binary_size > 0)
+            len = binary_size;
+        else
+            len = sx_strlen(data) + 1; // include the '\0' at the end to null-terminate the string
+
+        // align data to uint32_t (4)
+        const uint32_t* aligned_data = (const uint32_t*)data;
+        int aligned_len = sx_align_mask(len, 3);
+        if (aligned_len > len) {
+            uint32_t* tmp = (uint32_t*)sx_malloc(g_alloc, aligned_len);
+            if (!tmp) {
+                sx_out_of_memory();
+                return false;
+            }
+            sx_memcpy(tmp, data, len);
+            sx_memset((uint8_t*)tmp + len, 0x0, aligned_len - len);
+            aligned_data = tmp;
+        }
+        const char* aligned_ptr = (const char*)aligned_data;
+
+        sx_snprintf(var, sizeof(var), "static const unsigned int %s_size = %d;\n", cvar, len);
+        sx_file_write_text(&writer, var);
+        sx_snprintf(var, sizeof(var), "static const unsigned int %s_data[%d/4] = {\n\t", cvar, aligned_len);
+        sx_file_write_text(&writer, var);
+
+        sx_assert(aligned_len % sizeof(uint32_t) == 0);
+        int uint_count = aligned_len / 4;
+        for (int i = 0; i < uint_count; i++) {
+            if (i != uint_count - 1) {
+                sx_snprintf(hex, sizeof(hex), "0x%08x, ", *aligned_data);
             } else {
-                sgs_add_stage_code(g_sgs, sstage, code.c_str());
+                sx_snprintf(hex, sizeof(hex), "0x%08x };\n", *aligned_data);
             }
+            sx_file_write_text(&writer, hex);
 
-            if (args.reflect) {
-                // turn back location attributs for reflection
-                if (!old_locs.empty()) {
-                    sx_assert(old_locs.size() == ress.stage_inputs.size());
-                    for (int i = 0; i < ress.stage_inputs.size(); i++) {
-                        spirv_cross::Resource& res = ress.stage_inputs[i];
-                        spirv_cross::Bitset mask = compiler->get_decoration_bitset(res.id);
-                        if (old_locs[i] != -1) {
-                            sx_assert(mask.get(spv::DecorationLocation));
-                            old_locs.push_back(compiler->get_decoration(res.id, spv::DecorationLocation));
-                            compiler->set_decoration(res.id, spv::DecorationLocation, old_locs[i]);
-                        }
-                    }
-                }
+            ++char_offset;
+            if (char_offset == items_per_line) {
+                sx_file_write_text(&writer, "\n\t");
+                char_offset = 0;
+            }
 
-                sx_mem_block* mem = nullptr;
-                output_reflection_bin(args, *compiler, ress, args.out_filepath, stage, &mem);
-                sgs_add_stage_reflect(g_sgs, sstage, mem->data, mem->size);
-                sx_mem_destroy_block(mem);
+            ++aligned_data;
+        }
+
+        sx_file_write_text(&writer, "\n");
+
+        if (aligned_ptr != data) {
+            sx_free(g_alloc, const_cast<char*>(aligned_ptr));
+        }
+    } else {
+        if (binary_size > 0)
+            sx_file_write(&writer, data, binary_size);
+        else
+            sx_file_write(&writer, data, sx_strlen(data));
+    }
+
+    sx_file_close_writer(&writer);
+    return true;
+}
+
+// prints the stats, or writes them to the json document if jw is set, and adds them to the SGS file
+static void output_stats(const shader_stats& st, const char* filename, EShLanguage stage, json_writer* jw)
+{
+    if (jw) {
+        json_begin_object(jw, get_stage_name(stage));
+        json_put_string(jw, "file", filename);
+        json_put_int(jw, "instructions", int(st.num_instructions));
+        json_put_int(jw, "alu", int(st.num_alu));
+        json_put_int(jw, "transcendental", int(st.num_transcendental));
+        json_put_int(jw, "texture", int(st.num_texture));
+        json_put_int(jw, "dependent_texture", int(st.num_dependent_texture));
+        json_put_int(jw, "branches", int(st.num_branches));
+        json_put_int(jw, "loops", int(st.num_loops));
+        json_put_int(jw, "max_live_components", int(st.max_live_components));
+        json_put_int(jw, "uniform_buffers", int(st.num_uniform_buffers));
+        json_put_int(jw, "uniform_bytes", int(st.uniform_bytes));
+        json_end_object(jw);
+    } else {
+        printf("%s: %u instructions (alu %u, transcendental %u, texture %u, dependent texture %u), "
+               "%u branches, %u loops, %u live components, %u uniform buffers (%u bytes)\n",
+               filename, st.num_instructions, st.num_alu, st.num_transcendental, st.num_texture,
+               st.num_dependent_texture, st.num_branches, st.num_loops, st.max_live_components,
+               st.num_uniform_buffers, st.uniform_bytes);
+    }
+
+    if (g_sgs) {
+        sgs_chunk_stat chunk;
+        chunk.num_instructions = st.num_instructions;
+        chunk.num_alu = st.num_alu;
+        chunk.num_transcendental = st.num_transcendental;
+        chunk.num_texture = st.num_texture;
+        chunk.num_dependent_texture = st.num_dependent_texture;
+        chunk.num_branches = st.num_branches;
+        chunk.num_loops = st.num_loops;
+        chunk.max_live_components = st.max_live_components;
+        chunk.num_uniform_buffers = st.num_uniform_buffers;
+        chunk.uniform_bytes = st.uniform_bytes;
+        sgs_add_stage_stats(g_sgs, get_sgs_stage(stage), chunk);
+    }
+}
+
+// writes the code and reflection of a cross compiled stage to the SGS file or to separate files
+static int output_stage(const cmd_args& args, const pipeline_stage& st, const char* filename, int file_index)
+{
+    const spirv_cross::CompilerGLSL& compiler = *st.compiler;
+    const spirv_cross::ShaderResources& ress = st.ress;
+    const std::string& code = st.code;
+    EShLanguage stage = st.stage;
+    const compute_info* cs = stage == EShLangCompute ? &st.cs : nullptr;
+
+    // parts are reflected as separate blocks
+    g_ubo_splits = st.ubo_splits;
+
+    if (g_sgs) {
+        uint32_t sstage = get_sgs_stage(stage);
+
+        if (args.compile_bin) {
+#ifdef BYTECODE_COMPILATION
+            sx_mem_block* mem = compile_binary(code.c_str(), args.out_filepath, args.profile_ver,
+                stage, args.debug_bin);
+            if (!mem) {
+                printf("Bytecode compilation of '%s' failed\n", args.out_filepath);
+                return -1;
             }
+
+            sgs_add_stage_code_bin(g_sgs, sstage, mem->data, mem->size);
+            sx_mem_destroy_block(mem);
+#endif
         } else {
-            std::string cvar_code = args.cvar ? args.cvar : "";
-            std::string filepath;
-            if (!cvar_code.empty()) {
-                cvar_code += "_";
-                cvar_code += get_stage_name(stage);
-                filepath = args.out_filepath;
+            sgs_add_stage_code(g_sgs, sstage, code.c_str());
+        }
+
+        if (args.reflect) {
+            // names of the --refl-v2 chunks are in the string pool of REF2, so they are written before it
+            refl_string_pool strs;
+            refl_string_pool* v2_strs = args.refl_v2 ? &strs : nullptr;
+            sx_mem_block* spec_mem = nullptr;
+            bool has_spec = output_spec_constants_bin(args, filename, compiler, v2_strs, &spec_mem);
+            sx_mem_block* csmp_mem = nullptr;
+            bool has_csmp = output_combined_samplers_bin(args, filename, compiler, v2_strs, &csmp_mem);
+            sx_mem_block* ubsp_mem = nullptr;
+            bool has_ubsp = output_ubo_parts_bin(args, filename, compiler, ress, v2_strs, &ubsp_mem);
+            sx_mem_block* argbuf_mem = nullptr;
+            if (args.lang == SHADER_LANG_MSL && args.msl_argument_buffers) {
+                std::vector<msl_argument> margs;
+                get_msl_arguments((const spirv_cross::CompilerMSL&)compiler, ress, &margs);
+                if (!margs.empty())
+                    output_argument_buffers_bin(args, filename, margs, v2_strs, &argbuf_mem);
+            }
+
+            sx_mem_block* mem = nullptr;
+            if (args.refl_v2) {
+                output_reflection_bin2(args, compiler, ress, args.out_filepath, stage, &strs, &mem);
+                sgs_add_stage_reflect(g_sgs, sstage, mem->data, mem->size, SGS_CHUNK_REF2);
             } else {
-                char ext[32];
-                char basename[512];
-                sx_os_path_splitext(ext, sizeof(ext), basename, sizeof(basename), args.out_filepath);
-                filepath = std::string(basename) + std::string("_") + std::string(get_stage_name(stage)) + std::string(ext);
+                output_reflection_bin(args, compiler, ress, args.out_filepath, stage, &mem);
+                sgs_add_stage_reflect(g_sgs, sstage, mem->data, mem->size);
             }
-            bool append = !cvar_code.empty() & (file_index > 0);
+            sx_mem_destroy_block(mem);
 
-            // Check if we have to compile byte-code or output the source only
-            if (args.compile_bin) {
-#ifdef BYTECODE_COMPILATION
-                sx_mem_block* mem = compile_binary(code.c_str(), filepath.c_str(), args.profile_ver,
-                    stage, args.debug_bin);
-                if (!mem) {
-                    printf("Bytecode compilation of '%s' failed\n", filepath.c_str());
-                    return -1;
+            if (cs) {
+                sgs_chunk_cinf cinf;
+                for (int i = 0; i < 3; i++) {
+                    cinf.workgroup_size[i] = cs->workgroup_size[i];
+                    cinf.workgroup_size_spec_ids[i] = cs->workgroup_size_spec_ids[i];
                 }
+                cinf.shared_memory_size = cs->shared_memory_size;
+                sgs_add_stage_chunk(g_sgs, sstage, SGS_CHUNK_CINF, &cinf, sizeof(cinf));
+            }
 
-                if (!write_file(filepath.c_str(), (const char*)mem->data, cvar_code.c_str(), append, mem->size)) {
-                    printf("Writing to '%s' failed\n", filepath.c_str());
-                    return -1;
-                }
+            if (has_spec) {
+                sgs_add_stage_chunk(g_sgs, sstage, args.refl_v2 ? SGS_CHUNK_SPC2 : SGS_CHUNK_SPEC, spec_mem->data,
+                                    spec_mem->size);
+            }
+            sx_mem_destroy_block(spec_mem);
+
+            if (has_csmp) {
+                sgs_add_stage_chunk(g_sgs, sstage, args.refl_v2 ? SGS_CHUNK_CSM2 : SGS_CHUNK_CSMP, csmp_mem->data,
+                                    csmp_mem->size);
+            }
+            sx_mem_destroy_block(csmp_mem);
 
+            if (has_ubsp) {
+                sgs_add_stage_chunk(g_sgs, sstage, args.refl_v2 ? SGS_CHUNK_UBS2 : SGS_CHUNK_UBSP, ubsp_mem->data,
+                                    ubsp_mem->size);
+            }
+            sx_mem_destroy_block(ubsp_mem);
+
+            if (stage == EShLangVertex && args.vertex_formats) {
+                if (output_vertex_formats_bin(compiler, ress, &mem))
+                    sgs_add_stage_chunk(g_sgs, sstage, SGS_CHUNK_VFMT, mem->data, mem->size);
                 sx_mem_destroy_block(mem);
-#endif
-            } else {
-                // output code file
-                if (!write_file(filepath.c_str(), code.c_str(), cvar_code.c_str(), append)) {
-                    printf("Writing to '%s' failed\n", filepath.c_str());
-                    return -1;
-                }
             }
 
-            if (args.reflect) {
-                // turn back location attributs for reflection
-                if (!old_locs.empty()) {
-                    sx_assert(old_locs.size() == ress.stage_inputs.size());
-                    for (int i = 0; i < ress.stage_inputs.size(); i++) {
-                        spirv_cross::Resource& res = ress.stage_inputs[i];
-                        spirv_cross::Bitset mask = compiler->get_decoration_bitset(res.id);
-                        if (old_locs[i] != -1) {
-                            sx_assert(mask.get(spv::DecorationLocation));
-                            old_locs.push_back(compiler->get_decoration(res.id, spv::DecorationLocation));
-                            compiler->set_decoration(res.id, spv::DecorationLocation, old_locs[i]);
-                        }
-                    }
-                }
+            if (argbuf_mem) {
+                sgs_add_stage_chunk(g_sgs, sstage, args.refl_v2 ? SGS_CHUNK_ARG2 : SGS_CHUNK_ARGB, argbuf_mem->data,
+                                    argbuf_mem->size);
+                sx_mem_destroy_block(argbuf_mem);
+            }
+        }
+    } else {
+        std::string cvar_code = args.cvar ? args.cvar : "";
+        std::string filepath;
+        if (!cvar_code.empty()) {
+            cvar_code += "_";
+            cvar_code += get_stage_name(stage);
+            filepath = args.out_filepath;
+        } else {
+            char ext[32];
+            char basename[512];
+            sx_os_path_splitext(ext, sizeof(ext), basename, sizeof(basename), args.out_filepath);
+            filepath = std::string(basename) + std::string("_") + std::string(get_stage_name(stage)) + std::string(ext);
+        }
+        bool append = !cvar_code.empty() & (file_index > 0);
+
+        // Check if we have to compile byte-code or output the source only
+        if (args.compile_bin) {
+#ifdef BYTECODE_COMPILATION
+            sx_mem_block* mem = compile_binary(code.c_str(), filepath.c_str(), args.profile_ver,
+                stage, args.debug_bin);
+            if (!mem) {
+                printf("Bytecode compilation of '%s' failed\n", filepath.c_str());
+                return -1;
+            }
+
+            if (!write_file(filepath.c_str(), (const char*)mem->data, cvar_code.c_str(), append, mem->size)) {
+                printf("Writing to '%s' failed\n", filepath.c_str());
+                return -1;
+            }
+
+            sx_mem_destroy_block(mem);
+#endif
+        } else {
+            // output code file
+            if (!write_file(filepath.c_str(), code.c_str(), cvar_code.c_str(), append)) {
+                printf("Writing to '%s' failed\n", filepath.c_str());
+                return -1;
+            }
+        }
 
-                // output json reflection file
-                // if --reflect is defined, we just output to that file
-                // if --reflect is not defined, check cvar (.C file), and if set, output to the same file (out_filepath)
-                // if --reflect is not defined and there is no cvar, output to out_filepath.json
-                std::string json_str;
-                output_reflection_json(args, *compiler, ress, filepath.c_str(), stage, &json_str, cvar_code.empty());
-
-                std::string reflect_filepath;
-                if (args.reflect_filepath) {
-                    reflect_filepath = args.reflect_filepath;
-                } else if (!cvar_code.empty()) {
-                    reflect_filepath = filepath;
-                    append = true;
-                } else {
-                    reflect_filepath = filepath;
-                    reflect_filepath += ".json";
-                }
+        if (args.reflect) {
+            // output json reflection file
+            // if --reflect is defined, we just output to that file
+            // if --reflect is not defined, check cvar (.C file), and if set, output to the same file (out_filepath)
+            // if --reflect is not defined and there is no cvar, output to out_filepath.json
+            std::string json_str;
+            output_reflection_json(args, compiler, ress, filepath.c_str(), stage, cs, &json_str, cvar_code.empty());
+
+            std::string reflect_filepath;
+            if (args.reflect_filepath) {
+                reflect_filepath = args.reflect_filepath;
+            } else if (!cvar_code.empty()) {
+                reflect_filepath = filepath;
+                append = true;
+            } else {
+                reflect_filepath = filepath;
+                reflect_filepath += ".json";
+            }
 
-                std::string cvar_refl = !cvar_code.empty() ? (cvar_code + "_refl") : "";
-                if (!write_file(reflect_filepath.c_str(), json_str.c_str(), cvar_refl.c_str(), append)) {
-                    printf("Writing to '%s' failed", reflect_filepath.c_str());
-                    return -1;
-                }
+            std::string cvar_refl = !cvar_code.empty() ? (cvar_code + "_refl") : "";
+            if (!write_file(reflect_filepath.c_str(), json_str.c_str(), cvar_refl.c_str(), append)) {
+                printf("Writing to '%s' failed\n", reflect_filepath.c_str());
+                return -1;
             }
         }
-
-        if (!args.silent)
-            puts(filename); // SUCCESS
-        return 0;
-    } catch (const std::exception& e) {
-        printf("SPIRV-cross: %s\n", e.what());
-        return -1;
     }
+
+    return 0;
 }
 
 struct compile_file_desc {
@@ -1360,14 +2078,99 @@ struct compile_file_desc {
     const char* filename;
     uint32_t offset;
     uint32_t size;
+    int start_line;     // line of the //@begin_ block in the file
+};
+
+// Per-stage results that are kept between compiles (watch mode)
+// if the source of a stage (or //@begin_ block) and it's includes are not changed, the parsed shader and
+// SPIR-V are reused and only the link validation is performed for that stage
+struct compile_cache_include {
+    std::string filepath;
+    uint64_t hash;
+};
+
+struct compile_cache_stage {
+    uint64_t source_hash;
+    glslang::TShader* shader;
+    std::vector<uint32_t> spirv;
+    std::vector<compile_cache_include> includes;
+    bool emitted;
+};
+
+struct compile_cache {
+    compile_cache_stage stages[EShLangCount];
 };
 
+static uint64_t hash_file(const char* filepath)
+{
+    sx_mem_block* mem = sx_file_load_bin(g_alloc, filepath);
+    if (!mem)
+        return 0;
+    uint64_t h = sx_hash_xxh64(mem->data, (size_t)mem->size, 0);
+    sx_mem_destroy_block(mem);
+    return h;
+}
+
+static void compile_cache_reset_stage(compile_cache_stage* cs)
+{
+    if (cs->shader) {
+        cs->shader->~TShader();
+        sx_free(g_alloc, cs->shader);
+    }
+    cs->source_hash = 0;
+    cs->shader = nullptr;
+    cs->spirv.clear();
+    cs->includes.clear();
+    cs->emitted = false;
+}
+
+static compile_cache* compile_cache_create()
+{
+    compile_cache* cache = new (sx_malloc(g_alloc, sizeof(compile_cache))) compile_cache();
+    sx_assert(cache);
+    for (int i = 0; i < EShLangCount; i++)
+        compile_cache_reset_stage(&cache->stages[i]);
+    return cache;
+}
+
+static void compile_cache_destroy(compile_cache* cache)
+{
+    sx_assert(cache);
+    for (int i = 0; i < EShLangCount; i++)
+        compile_cache_reset_stage(&cache->stages[i]);
+    cache->~compile_cache();
+    sx_free(g_alloc, cache);
+}
+
+// paths are normalized, so they can be compared with the paths of file change events
+static void compile_cache_set_includes(compile_cache_stage* cs, const std::vector<std::string>& includes)
+{
+    for (const std::string& inc : includes) {
+        char abspath[512];
+        sx_os_path_abspath(abspath, sizeof(abspath), inc.c_str());
+        compile_cache_include ci = { abspath[0] ? std::string(abspath) : inc, hash_file(inc.c_str()) };
+        cs->includes.push_back(ci);
+    }
+}
+
+static bool compile_cache_is_valid(const compile_cache_stage& cs, uint64_t source_hash)
+{
+    if (!cs.shader || cs.source_hash != source_hash)
+        return false;
+
+    // includes may have changed without touching the main source
+    for (const compile_cache_include& inc : cs.includes) {
+        if (hash_file(inc.filepath.c_str()) != inc.hash)
+            return false;
+    }
+    return true;
+}
+
 #define compile_files_ret(_code)   \
     destroy_shaders(shaders);      \
     sx_array_free(g_alloc, files); \
     prog->~TProgram();             \
     sx_free(g_alloc, prog);        \
-    glslang::FinalizeProcess();    \
     return _code;
 
 struct output_parse_result {
@@ -1423,38 +2226,38 @@ static bool parse_output_log(const char* str, std::vector<output_parse_result>*
     return true;
 }
 
+// single line of output_error, glslang format only prints the line, the file is printed before the messages
 static void output_error(const char* err_str, const cmd_args& args, const char* filename, int start_line = 0)
 {
     if (err_str && err_str[0]) {
         std::vector<output_parse_result> lines;
         parse_output_log(err_str, &lines);
-        if (args.err_format == OUTPUT_ERRORFORMAT_GLSLANG) {
+        if (args.err_format == OUTPUT_ERRORFORMAT_GLSLANG)
             fprintf(stdout, "%s\n", filename);
-            for (std::vector<output_parse_result>::iterator il = lines.begin();
-                 il != lines.end(); ++il) {
-                fprintf(stdout, "ERROR: 0:%d:%s\n", il->line + start_line, il->err.c_str());
-            }
-        } else if (args.err_format == OUTPUT_ERRORFORMAT_MSVC) {
-            for (std::vector<output_parse_result>::iterator il = lines.begin();
-                 il != lines.end(); ++il) {
-                char fullpath[256];
-                sx_os_path_abspath(fullpath, sizeof(fullpath), il->file.c_str());
-                fprintf(stderr, "%s(%d,0): error:%s\n", fullpath, il->line + start_line, il->err.c_str());
-            }
-        } else if (args.err_format == OUTPUT_ERRORFORMAT_GCC) {
-            for (std::vector<output_parse_result>::iterator il = lines.begin();
-                 il != lines.end(); ++il) {
-                char fullpath[256];
-                sx_os_path_abspath(fullpath, sizeof(fullpath), il->file.c_str());
-                fprintf(stderr, "%s:%d:0: error:%s\n", fullpath, il->line + start_line, il->err.c_str());
-            }
-        }
+        for (std::vector<output_parse_result>::iterator il = lines.begin(); il != lines.end(); ++il)
+            output_message(args, il->file.c_str(), il->line + start_line, false, il->err.c_str());
     }
 }
 
+// lines of the main file are relative to the //@begin_ block
+static void output_perf_lint(const cmd_args& args, const std::vector<perf_lint_message>& messages,
+                             const compile_file_desc& file)
+{
+    if (messages.empty())
+        return;
+
+    if (args.err_format == OUTPUT_ERRORFORMAT_GLSLANG)
+        fprintf(stdout, "%s\n", file.filename);
+    for (const perf_lint_message& msg : messages) {
+        bool main_file = msg.file.empty() || msg.file == file.filename;
+        std::string text = " perf-lint: " + msg.text;
+        output_message(args, main_file ? file.filename : msg.file.c_str(),
+                       msg.line + (main_file ? file.start_line : 0), true, text.c_str());
+    }
+}
 
 
-static int compile_files(cmd_args& args, const TBuiltInResource& limits_conf)
+static int compile_files(cmd_args& args, const TBuiltInResource& limits_conf, compile_cache* cache = nullptr)
 {
     auto destroy_shaders = [](glslang::TShader**& shaders) {
         for (int i = 0; i < sx_array_count(shaders); i++) {
@@ -1496,8 +2299,6 @@ static int compile_files(cmd_args& args, const TBuiltInResource& limits_conf)
         return count;
     };
 
-    glslang::InitializeProcess();
-
     // Gather files for compilation
     compile_file_desc* files = nullptr;
 
@@ -1592,35 +2393,24 @@ static int compile_files(cmd_args& args, const TBuiltInResource& limits_conf)
     glslang::TProgram* prog = new (sx_malloc(g_alloc, sizeof(glslang::TProgram))) glslang::TProgram();
     glslang::TShader** shaders = nullptr;
 
-    // TODO: add more options for messaging options
-    EShMessages messages = EShMsgDefault;
-    int default_version = 100; // 110 for desktop
-
-    // construct semantics mapping defines
-    // to be used in layout(location = SEMANTIC) inside GLSL
-    std::string semantics_def;
-    for (int i = 0; i < VERTEX_ATTRIB_COUNT; i++) {
-        char sem_line[128];
-        sx_snprintf(sem_line, sizeof(sem_line), "#define %s %d\n", k_attrib_names[i], i);
-        semantics_def += std::string(sem_line);
-    }
-
-    // Add SV_Target semantics for more HLSL compatibility
-    for (int i = 0; i < 8; i++) {
-        char sv_target_line[128];
-        sx_snprintf(sv_target_line, sizeof(sv_target_line), "#define SV_Target%d %d\n", i, i);
-        semantics_def += std::string(sv_target_line);
+    pipeline_options opts;
+    get_pipeline_options(args, limits_conf, &opts);
+    pipeline_preamble preamble;
+    pipeline_get_preamble(opts, &preamble);
+
+    // cached stages are only valid for actual compilation, not for preprocess/validate passes
+    if (args.preprocess || args.validate || args.list_includes)
+        cache = nullptr;
+    bool cached_stages[EShLangCount] = { false };
+
+    // stages parsed with different limits can't be reused
+    uint64_t limits_hash = 0;
+    if (cache) {
+        std::string conf_str = get_conf_str(limits_conf);
+        limits_hash = sx_hash_xxh64(conf_str.c_str(), conf_str.length(), 0);
     }
 
     for (int i = 0; i < sx_array_count(files); i++) {
-        // Always set include_directive in the preamble, because we may need to include shaders
-        std::string def("#extension GL_GOOGLE_include_directive : require\n");
-        def += semantics_def;
-
-        if (args.lang == SHADER_LANG_GLES && args.profile_ver == 200) {
-            def += std::string("#define flat\n");
-        }
-
         // Read target file
         sx_mem_block* mem = sx_file_load_bin(g_alloc, files[i].filename);
         if (!mem) {
@@ -1632,34 +2422,32 @@ static int compile_files(cmd_args& args, const TBuiltInResource& limits_conf)
         sx_assert(shader);
         sx_array_push(g_alloc, shaders, shader);
 
-        char* shader_str;
-        int shader_len;
+        pipeline_source src = { files[i].stage, files[i].filename, (const char*)mem->data, (int)mem->size };
         int start_line = 0;
-        if (files[i].size == 0) {
-            shader_str = (char*)mem->data;
-            shader_len = (int)mem->size;
-        } else {
-            shader_str = (char*)mem->data + files[i].offset;
-            shader_len = (int)files[i].size;
+        if (files[i].size != 0) {
+            src.source = (const char*)mem->data + files[i].offset;
+            src.size = (int)files[i].size;
             start_line = calculate_start_line((const char*)mem->data, files[i].offset);
-
-            #if 0   // TODO: remove later
-            const char* version = "#version 450\n";
-            int version_sz = sx_strlen(version);
-            shader_str = (char*)sx_malloc(g_alloc, files[i].size + version_sz);
-            sx_assert(shader_str);
-            sx_memcpy(shader_str, version, version_sz);
-            sx_memcpy(shader_str + version_sz, (char*)mem->data + files[i].offset, files[i].size);
-            shader_len = files[i].size + version_sz;
-
-            #endif
+            files[i].start_line = start_line;
+        }
+        pipeline_setup_shader(opts, preamble, src, shader);
+
+        uint64_t source_hash = 0;
+        if (cache) {
+            source_hash = sx_hash_xxh64(src.source, (size_t)src.size,
+                                        sx_hash_xxh64(preamble.text.c_str(), preamble.text.length(), limits_hash));
+            compile_cache_stage& cs = cache->stages[files[i].stage];
+            if (compile_cache_is_valid(cs, source_hash)) {
+                // source is not changed, skip parsing and use the previous shader for linking
+                shaders[sx_array_count(shaders) - 1] = nullptr;
+                shader->~TShader();
+                sx_free(g_alloc, shader);
+                prog->addShader(cs.shader);
+                cached_stages[files[i].stage] = true;
+                sx_mem_destroy_block(mem);
+                continue;
+            }
         }
-        shader->setStringsWithLengthsAndNames(&shader_str, &shader_len, &files[i].filename, 1);
-        shader->setInvertY(args.invert_y ? true : false);
-        shader->setEnvInput(glslang::EShSourceGlsl, files[i].stage, glslang::EShClientVulkan, default_version);
-        shader->setEnvClient(glslang::EShClientVulkan, glslang::EShTargetVulkan_1_1);
-        shader->setEnvTarget(glslang::EShTargetSpv, glslang::EShTargetSpv_1_0);
-        add_defines(shader, args, def);
 
         std::string prep_str;
         Includer includer(args.list_includes);
@@ -1669,7 +2457,7 @@ static int compile_files(cmd_args& args, const TBuiltInResource& limits_conf)
         includer.addIncluder(args.includer);
 
         if (args.preprocess || args.list_includes) {
-            if (shader->preprocess(&limits_conf, default_version, ENoProfile, false, false, messages, &prep_str, includer)) {
+            if (pipeline_parse(opts, shader, includer, &prep_str)) {
                 if (args.preprocess) {
                     puts("-------------------");
                     printf("%s:\n", files[i].filename);
@@ -1683,14 +2471,29 @@ static int compile_files(cmd_args& args, const TBuiltInResource& limits_conf)
                 compile_files_ret(-1);
             }
         } else {
-            if (!shader->parse(&limits_conf, default_version, false, messages, includer)) {
+            if (!pipeline_parse(opts, shader, includer)) {
                 output_error(shader->getInfoLog(), args, files[i].filename, start_line);
+                // keep the includes, so the stage is compiled again when the error is fixed in one of them
+                if (cache) {
+                    compile_cache_reset_stage(&cache->stages[files[i].stage]);
+                    compile_cache_set_includes(&cache->stages[files[i].stage], includer.includedFiles());
+                }
                 sx_mem_destroy_block(mem);
                 compile_files_ret(-1);
             }
 
             if (!args.validate)
                 prog->addShader(shader);
+
+            if (cache) {
+                // move the shader ownership to cache
+                compile_cache_stage& cs = cache->stages[files[i].stage];
+                compile_cache_reset_stage(&cs);
+                cs.source_hash = source_hash;
+                cs.shader = shader;
+                compile_cache_set_includes(&cs, includer.includedFiles());
+                shaders[sx_array_count(shaders) - 1] = nullptr;
+            }
         }
 
         sx_mem_destroy_block(mem);
@@ -1701,27 +2504,113 @@ static int compile_files(cmd_args& args, const TBuiltInResource& limits_conf)
         compile_files_ret(0);
     }
 
-    if (!prog->link(messages)) {
-        puts("Link failed: ");
-        fprintf(stderr, "%s\n", prog->getInfoLog());
-        fprintf(stderr, "%s\n", prog->getInfoDebugLog());
+    // SPIR-V of cached stages is reused, the cache keeps the SPIR-V before the program passes
+    int num_files = sx_array_count(files);
+    std::vector<EShLanguage> stages(num_files);
+    std::vector<std::vector<uint32_t>> spirvs(num_files);
+    for (int i = 0; i < num_files; i++) {
+        stages[i] = files[i].stage;
+        if (cached_stages[files[i].stage])
+            spirvs[i] = cache->stages[files[i].stage].spirv;
+    }
+
+    pipeline_program program;
+    std::string log;
+    bool linked = pipeline_link(opts, prog, stages, &spirvs, &program, &log);
+    fputs(log.c_str(), stdout);
+    if (!linked) {
         compile_files_ret(-1);
     }
 
-    // Output and save SPIR-V for each shader
-    for (int i = 0; i < sx_array_count(files); i++) {
-        std::vector<uint32_t> spirv;
+    if (cache) {
+        for (int i = 0; i < num_files; i++) {
+            if (!cached_stages[files[i].stage])
+                cache->stages[files[i].stage].spirv = spirvs[i];
+        }
+    }
+
+    if (args.perf_lint) {
+        for (int i = 0; i < num_files; i++)
+            output_perf_lint(args, program.lint[i], files[i]);
+    }
+
+    log.clear();
+    pipeline_program_passes(opts, stages, &spirvs, &program, &log);
+    fputs(log.c_str(), stdout);
+
+    // stats of all stages are written to a single json file
+    std::string stats_json;
+    json_writer stats_jw;
+    if (args.stats_filepath) {
+        json_init_writer(&stats_jw, &stats_json, "  ");
+        json_begin_object(&stats_jw);
+    }
+
+    // Output and save each shader
+    for (int i = 0; i < num_files; i++) {
+        compile_cache_stage* cs = cache ? &cache->stages[files[i].stage] : nullptr;
+
+        // Individual output files of unchanged stages are already on the disk
+        // but SGS and cvar outputs hold all stages in a single file, so they need to be emitted again
+        // linked stages also depend on the other stage
+        if (cached_stages[files[i].stage] && cs->emitted && !g_sgs && !args.cvar && !args.reflect_filepath &&
+            !args.stats_filepath && !program.linked && !args.auto_bind) {
+            continue;
+        }
+
+        pipeline_stage st;
+        log.clear();
+        bool compiled = pipeline_compile_stage(opts, &program, files[i].stage, spirvs[i], files[i].filename, &st, &log);
+        fputs(log.c_str(), stdout);
+        if (!compiled || !check_limits(args, st.limits, files[i].filename)) {
+            if (cs)
+                cs->emitted = false;
+            compile_files_ret(-1);
+        }
+
+        if (st.relaxed && !args.silent) {
+            printf("%s: mediump %d/%d float values", files[i].filename, st.precision.num_relaxed,
+                   st.precision.num_values);
+            for (size_t k = 0; k < st.precision.names.size(); k++)
+                printf("%s%s", k == 0 ? " (" : ", ", st.precision.names[k].c_str());
+            puts(st.precision.names.empty() ? "" : ")");
+        }
+
+        if (!args.silent) {
+            for (const ubo_layout_report& r : st.ubo_layouts) {
+                printf("%s: uniform block '%s' %u -> %u bytes (%u saved)\n", files[i].filename, r.name.c_str(),
+                       r.old_size, r.new_size, r.old_size - r.new_size);
+            }
+
+            for (size_t k = 0; k < st.ubo_splits.size(); k++) {
+                const ubo_split_part& part = st.ubo_splits[k];
+                bool first = k == 0 || st.ubo_splits[k - 1].block != part.block;
+                bool last = k + 1 == st.ubo_splits.size() || st.ubo_splits[k + 1].block != part.block;
+                if (first)
+                    printf("%s: uniform block '%s' split into ", files[i].filename, part.block.c_str());
+                printf("%s (%u bytes)%s", part.name.c_str(), part.size, last ? "\n" : ", ");
+            }
+        }
 
-        glslang::SpvOptions spv_opts;
-        spv_opts.validate = true;
-        spv::SpvBuildLogger logger;
-        sx_assert(prog->getIntermediate(files[i].stage));
+        if (st.has_stats)
+            output_stats(st.stats, files[i].filename, files[i].stage, args.stats_filepath ? &stats_jw : nullptr);
 
-        glslang::GlslangToSpv(*prog->getIntermediate(files[i].stage), spirv, &logger, &spv_opts);
-        if (!logger.getAllMessages().empty())
-            puts(logger.getAllMessages().c_str());
+        if (output_stage(args, st, files[i].filename, i) != 0) {
+            if (cs)
+                cs->emitted = false;
+            compile_files_ret(-1);
+        }
+
+        if (!args.silent)
+            puts(files[i].filename); // SUCCESS
+        if (cs)
+            cs->emitted = true;
+    }
 
-        if (cross_compile(args, spirv, files[i].filename, files[i].stage, i) != 0) {
+    if (args.stats_filepath) {
+        json_end_object(&stats_jw);
+        if (!write_file(args.stats_filepath, stats_json.c_str(), nullptr)) {
+            printf("Writing to '%s' failed\n", args.stats_filepath);
             compile_files_ret(-1);
         }
     }
@@ -1729,8 +2618,6 @@ static int compile_files(cmd_args& args, const TBuiltInResource& limits_conf)
     destroy_shaders(shaders);
     prog->~TProgram();
     sx_free(g_alloc, prog);
-
-    glslang::FinalizeProcess();
     sx_array_free(g_alloc, files);
 
     return 0;
@@ -1754,6 +2641,315 @@ static void detect_input_file(cmd_args* args, const char* file)
     }
 }
 
+// compiles a single program (vs+fs or cs) and writes the outputs, including the SGS file if it's requested
+static int compile_program(cmd_args& args, const TBuiltInResource& limits_conf, compile_cache* cache = nullptr)
+{
+    if (args.sgs_file && !(args.preprocess | args.validate | args.list_includes)) {
+        g_sgs = sgs_create_file(g_alloc, args.out_filepath, k_shader_langs_fourcc[args.lang], args.profile_ver);
+        sx_assert(g_sgs);
+    }
+
+    int r = compile_files(args, limits_conf, cache);
+
+    if (g_sgs) {
+        if (r == 0 && !sgs_commit(g_sgs)) {
+            printf("Writing SGS file '%s' failed\n", args.out_filepath);
+            r = -1;
+        }
+        sgs_destroy_file(g_sgs);
+        g_sgs = nullptr;
+    }
+
+    return r;
+}
+
+#if SX_PLATFORM_LINUX
+// Watch mode
+// every shader in the watch directory is a program: .glsl files with //@begin_ blocks, .vert/.frag pairs with
+// the same name, or single .vert/.frag/.comp files. Programs are recompiled when their sources or any of their
+// includes change. Outputs go to the --output directory, .comp and .glsl programs have the extension in their
+// output names (name_comp, name_glsl), so they don't overwrite the outputs of a .vert/.frag pair with the same name
+// Stops on SIGINT
+static const int k_watch_debounce_ms = 100;
+
+static volatile sig_atomic_t g_watch_quit = 0;
+
+static void watch_signal_handler(int)
+{
+    g_watch_quit = 1;
+}
+
+static const char* k_watch_output_exts[SHADER_LANG_COUNT] = {
+    ".glsl",
+    ".hlsl",
+    ".metal",
+    ".glsl"
+};
+
+struct watch_program {
+    std::string vs_filepath;
+    std::string fs_filepath;
+    std::string cs_filepath;
+    std::string out_filepath;
+    compile_cache* cache;
+};
+
+static std::string watch_abspath(const char* path)
+{
+    char abspath[512];
+    sx_os_path_abspath(abspath, sizeof(abspath), path);
+    return abspath[0] ? std::string(abspath) : std::string(path);
+}
+
+static bool watch_is_shader_file(const char* filepath)
+{
+    char ext[32];
+    sx_os_path_ext(ext, sizeof(ext), filepath);
+    return sx_strequalnocase(ext, ".vert") || sx_strequalnocase(ext, ".frag") ||
+           sx_strequalnocase(ext, ".comp") || sx_strequalnocase(ext, ".glsl");
+}
+
+static watch_program* watch_find_program(std::vector<watch_program>& progs, const std::string& base)
+{
+    for (watch_program& p : progs) {
+        if (p.out_filepath == base)
+            return &p;
+    }
+    return nullptr;
+}
+
+// scans the watch directory and adds new programs, removes programs that their sources are deleted
+static void watch_scan_programs(const cmd_args& args, const std::string& out_dir, std::vector<watch_program>& progs)
+{
+    for (auto it = progs.begin(); it != progs.end();) {
+        if ((!it->vs_filepath.empty() && !sx_os_path_isfile(it->vs_filepath.c_str())) ||
+            (!it->fs_filepath.empty() && !sx_os_path_isfile(it->fs_filepath.c_str())) ||
+            (!it->cs_filepath.empty() && !sx_os_path_isfile(it->cs_filepath.c_str()))) {
+            compile_cache_destroy(it->cache);
+            it = progs.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    DIR* dir = opendir(args.watch_dir);
+    if (!dir)
+        return;
+
+    // no language in --validate mode
+    std::string out_ext = args.sgs_file ? ".sgs" : (args.cvar ? ".h" : (args.lang < SHADER_LANG_COUNT ? k_watch_output_exts[args.lang] : ""));
+    struct dirent* ent;
+    while ((ent = readdir(dir)) != nullptr) {
+        std::string filepath = watch_abspath((std::string(args.watch_dir) + "/" + ent->d_name).c_str());
+        if (!sx_os_path_isfile(filepath.c_str()) || !watch_is_shader_file(filepath.c_str()))
+            continue;
+
+        char ext[32];
+        char basename[256];
+        sx_os_path_splitext(ext, sizeof(ext), basename, sizeof(basename), ent->d_name);
+        std::string out_name = basename;
+        if (sx_strequalnocase(ext, ".comp") || sx_strequalnocase(ext, ".glsl"))
+            out_name += std::string("_") + (ext + 1);
+        std::string out_filepath = out_dir + "/" + out_name + out_ext;
+
+        watch_program* p = watch_find_program(progs, out_filepath);
+        if (!p) {
+            watch_program np;
+            np.out_filepath = out_filepath;
+            np.cache = compile_cache_create();
+            progs.push_back(np);
+            p = &progs.back();
+        }
+
+        if (sx_strequalnocase(ext, ".vert")) {
+            p->vs_filepath = filepath;
+        } else if (sx_strequalnocase(ext, ".frag")) {
+            p->fs_filepath = filepath;
+        } else if (sx_strequalnocase(ext, ".comp")) {
+            p->cs_filepath = filepath;
+        } else if (sx_strequalnocase(ext, ".glsl")) {
+            p->vs_filepath = filepath;
+            p->fs_filepath = filepath;
+        }
+    }
+    closedir(dir);
+}
+
+static bool watch_program_depends(const watch_program& p, const std::vector<std::string>& changed)
+{
+    for (const std::string& c : changed) {
+        if (c == p.vs_filepath || c == p.fs_filepath || c == p.cs_filepath)
+            return true;
+        for (int i = 0; i < EShLangCount; i++) {
+            for (const compile_cache_include& inc : p.cache->stages[i].includes) {
+                if (c == inc.filepath)
+                    return true;
+            }
+        }
+    }
+    return false;
+}
+
+static void watch_add_dir(int fd, std::vector<std::pair<int, std::string>>& wds, const std::string& dir)
+{
+    for (const auto& wd : wds) {
+        if (wd.second == dir)
+            return;
+    }
+
+    int wd = inotify_add_watch(fd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE);
+    if (wd >= 0)
+        wds.push_back(std::make_pair(wd, dir));
+}
+
+// watches sources and include directories of all programs
+static void watch_update_dirs(int fd, std::vector<std::pair<int, std::string>>& wds, const std::vector<watch_program>& progs)
+{
+    char dirname[512];
+    for (const watch_program& p : progs) {
+        for (int i = 0; i < EShLangCount; i++) {
+            for (const compile_cache_include& inc : p.cache->stages[i].includes) {
+                sx_os_path_dirname(dirname, sizeof(dirname), inc.filepath.c_str());
+                watch_add_dir(fd, wds, dirname);
+            }
+        }
+    }
+}
+
+static void watch_compile_program(const cmd_args& args, const TBuiltInResource& limits_conf, const watch_program& p)
+{
+    cmd_args pargs = args;
+    pargs.vs_filepath = !p.vs_filepath.empty() ? p.vs_filepath.c_str() : nullptr;
+    pargs.fs_filepath = !p.fs_filepath.empty() ? p.fs_filepath.c_str() : nullptr;
+    pargs.cs_filepath = !p.cs_filepath.empty() ? p.cs_filepath.c_str() : nullptr;
+    pargs.out_filepath = args.out_filepath ? p.out_filepath.c_str() : nullptr;
+
+    // .glsl files with //@begin_ blocks are detected by comparing vs and fs file pointers
+    if (pargs.vs_filepath && pargs.fs_filepath && p.vs_filepath == p.fs_filepath)
+        pargs.fs_filepath = pargs.vs_filepath;
+
+    if (pargs.cs_filepath && (pargs.vs_filepath || pargs.fs_filepath)) {
+        printf("Cannot link compute-shader with either fragment shader or vertex shader: %s\n", pargs.cs_filepath);
+        return;
+    }
+
+    compile_program(pargs, limits_conf, p.cache);
+}
+
+static int watch_files(const cmd_args& args, const TBuiltInResource& limits_conf)
+{
+    std::string watch_dir = watch_abspath(args.watch_dir);
+    if (!sx_os_path_isdir(watch_dir.c_str())) {
+        printf("Invalid watch directory: %s\n", args.watch_dir);
+        return -1;
+    }
+
+    // --validate, --preprocess and --list-includes have no output
+    std::string out_dir;
+    if (args.out_filepath) {
+        if (!sx_os_path_isdir(args.out_filepath) && !sx_os_mkdir(args.out_filepath)) {
+            printf("Creating output directory '%s' failed\n", args.out_filepath);
+            return -1;
+        }
+        out_dir = watch_abspath(args.out_filepath);
+    }
+
+    int fd = inotify_init1(IN_NONBLOCK);
+    if (fd < 0) {
+        puts("inotify initialization failed");
+        return -1;
+    }
+
+    std::vector<std::pair<int, std::string>> wds;
+    std::vector<watch_program> progs;
+    watch_add_dir(fd, wds, watch_dir);
+
+    // initial compile of everything
+    watch_scan_programs(args, out_dir, progs);
+    for (const watch_program& p : progs)
+        watch_compile_program(args, limits_conf, p);
+    watch_update_dirs(fd, wds, progs);
+
+    // poll is interrupted by the signal
+    struct sigaction sa;
+    sx_memset(&sa, 0x0, sizeof(sa));
+    sa.sa_handler = watch_signal_handler;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGINT, &sa, nullptr);
+
+    printf("Watching '%s' ...\n", watch_dir.c_str());
+    fflush(stdout);
+
+    alignas(struct inotify_event) char buff[4096];
+    std::vector<std::string> changed;
+    while (!g_watch_quit) {
+        struct pollfd pfd = { fd, POLLIN, 0 };
+        int timeout = -1;
+        bool rescan = false;
+        changed.clear();
+
+        // collect events until there is no more events in the debounce window
+        while (!g_watch_quit && poll(&pfd, 1, timeout) > 0) {
+            ssize_t len;
+            while ((len = read(fd, buff, sizeof(buff))) > 0) {
+                for (char* ptr = buff; ptr < buff + len;) {
+                    const struct inotify_event* e = (const struct inotify_event*)ptr;
+                    ptr += sizeof(struct inotify_event) + e->len;
+                    if (!e->len)
+                        continue;
+
+                    for (const auto& wd : wds) {
+                        if (wd.first != e->wd)
+                            continue;
+
+                        std::string filepath = wd.second + "/" + e->name;
+                        if (std::find(changed.begin(), changed.end(), filepath) == changed.end())
+                            changed.push_back(filepath);
+                        if (wd.second == watch_dir && watch_is_shader_file(e->name) &&
+                            (e->mask & (IN_CREATE | IN_MOVED_TO | IN_DELETE))) {
+                            rescan = true;
+                        }
+                        break;
+                    }
+                }
+            }
+            timeout = k_watch_debounce_ms;
+        }
+
+        if (changed.empty() || g_watch_quit)
+            continue;
+
+        if (rescan) {
+            size_t num_progs = progs.size();
+            watch_scan_programs(args, out_dir, progs);
+            // newly added programs have empty cache and need to be compiled
+            for (size_t i = num_progs; i < progs.size(); i++)
+                changed.push_back(!progs[i].cs_filepath.empty() ? progs[i].cs_filepath : progs[i].vs_filepath.empty() ? progs[i].fs_filepath : progs[i].vs_filepath);
+        }
+
+        for (const watch_program& p : progs) {
+            if (watch_program_depends(p, changed))
+                watch_compile_program(args, limits_conf, p);
+        }
+        watch_update_dirs(fd, wds, progs);
+        fflush(stdout);
+    }
+
+    signal(SIGINT, SIG_DFL);
+    puts("Stopped watching");
+    for (watch_program& p : progs)
+        compile_cache_destroy(p.cache);
+    close(fd);
+    return 0;
+}
+#else
+static int watch_files(const cmd_args& args, const TBuiltInResource& limits_conf)
+{
+    puts("Watch mode is only implemented for linux");
+    return -1;
+}
+#endif // SX_PLATFORM_LINUX
+
 int main(int argc, char* argv[])
 {
     cmd_args args = {};
@@ -1773,7 +2969,7 @@ int main(int argc, char* argv[])
         { "lang", 'l', SX_CMDLINE_OPTYPE_REQUIRED, 0x0, 'l', "Convert to shader language", "gles/msl/hlsl/glsl" },
         { "defines", 'D', SX_CMDLINE_OPTYPE_OPTIONAL, 0x0, 'D', "Preprocessor definitions, seperated by comma or ';'", "Defines" },
         { "invert-y", 'Y', SX_CMDLINE_OPTYPE_FLAG_SET, &args.invert_y, 1, "Invert position.y in vertex shader", 0x0 },
-        { "profile", 'p', SX_CMDLINE_OPTYPE_REQUIRED, 0x0, 'p', "Shader profile version (HLSL: 40, 50, 60), (ES: 200, 300), (GLSL: 330, 400, 420)", "ProfileVersion" },
+        { "profile", 'p', SX_CMDLINE_OPTYPE_REQUIRED, 0x0, 'p', "Shader profile version (HLSL: 40, 50, 60), (ES: 200, 300), (GLSL: 330, 400, 420), (MSL: 12, 20, 21)", "ProfileVersion" },
         { "dumpc", 'C', SX_CMDLINE_OPTYPE_FLAG_SET, &dump_conf, 1, "Dump shader limits configuration", 0x0 },
         { "include-dirs", 'I', SX_CMDLINE_OPTYPE_REQUIRED, 0x0, 'I', "Set include directory for <system> files, seperated by ';'", "Directory(s)" },
         { "preprocess", 'P', SX_CMDLINE_OPTYPE_FLAG_SET, &args.preprocess, 1, "Dump preprocessed result to terminal" },
@@ -1789,6 +2985,27 @@ int main(int argc, char* argv[])
         { "validate", '0', SX_CMDLINE_OPTYPE_FLAG_SET, &args.validate, 1, "Only performs shader validatation and error checking", 0x0 },
         { "err-format", 'E', SX_CMDLINE_OPTYPE_REQUIRED, 0x0, 'E', "Output error format", "glslang/msvc" },
         { "list-includes", 'L', SX_CMDLINE_OPTYPE_FLAG_SET, &args.list_includes, 1, "List include files in shaders, does not generate any output files", 0x0},
+        { "refl-v2", 'R', SX_CMDLINE_OPTYPE_FLAG_SET, &args.refl_v2, 1, "Write REF2 reflection chunks (string pool + name hashes) to SGS files", 0x0 },
+        { "strip-unused", 'u', SX_CMDLINE_OPTYPE_FLAG_SET, &args.strip_unused, 1, "Remove resources and inputs that the shader does not use from output and reflection", 0x0 },
+        { "link-varyings", 'k', SX_CMDLINE_OPTYPE_FLAG_SET, &args.link_varyings, 1, "Remove vertex outputs that the fragment shader does not read (vs+fs only)", 0x0 },
+        { "pack-varyings", 'K', SX_CMDLINE_OPTYPE_FLAG_SET, &args.pack_varyings, 1, "Pack float/vec2/vec3 varyings into shared vec4 slots, implies --link-varyings", 0x0 },
+        { "infer-mediump", 'm', SX_CMDLINE_OPTYPE_FLAG_SET, &args.infer_mediump, 1, "Use mediump for colors, texture samples and clamped values where it's safe (GLES only)", 0x0 },
+        { "unorm-textures", 'n', SX_CMDLINE_OPTYPE_REQUIRED, 0x0, 'n', "Textures that hold normalized data, their samples can be mediump with --infer-mediump, seperated by comma or ';'", "Texture(s)" },
+        { "minify", 'z', SX_CMDLINE_OPTYPE_FLAG_SET, &args.minify, 1, "Shorten internal names and strip whitespace from GLSL/GLES output, interface names are kept", 0x0 },
+        { "stats", 'T', SX_CMDLINE_OPTYPE_OPTIONAL, 0x0, 'T', "Report static cost of each stage (instruction classes, register pressure, uniform bytes), optionally to a json file", "Filepath" },
+        { "msl-argument-buffers", 'a', SX_CMDLINE_OPTYPE_FLAG_SET, &args.msl_argument_buffers, 1, "Pack resources into Metal argument buffers per descriptor set and reflect their layout (MSL 2.0+)", 0x0 },
+        { "pack-ubos", 'U', SX_CMDLINE_OPTYPE_FLAG_SET, &args.pack_ubos, 1, "Reorder uniform block members by update frequency and alignment to remove std140 padding", 0x0 },
+        { "split-ubos", 'B', SX_CMDLINE_OPTYPE_FLAG_SET, &args.split_ubos, 1, "Flatten UBOs into one array per update frequency (frame, material, draw member names), implies --flatten-ubos (GLES/GLSL)", 0x0 },
+        { "auto-bind", 'A', SX_CMDLINE_OPTYPE_FLAG_SET, &args.auto_bind, 1, "Assign dense bindings to each resource class (per program for GLSL/GLES, per stage for HLSL/MSL) and reflect the ranges", 0x0 },
+        { "bind-base", 'H', SX_CMDLINE_OPTYPE_REQUIRED, 0x0, 'H', "First binding of each resource class (ubo, ssbo, texture, image, sampler), lang. prefix applies to one backend", "[Lang.]Class=Base" },
+        { "combine-samplers", 'j', SX_CMDLINE_OPTYPE_FLAG_SET, &args.combine_samplers, 1, "Combine separate images and samplers into <image>_<sampler> samplers and reflect the pairs (GLSL/GLES)", 0x0 },
+        { "spec-defines", 'e', SX_CMDLINE_OPTYPE_REQUIRED, 0x0, 'e', "Declare these defines as int (NAME) or bool (NAME:bool) specialization constants (MSL function constants), test them with if() instead of #if", "Define(s)" },
+        { "specialize", 's', SX_CMDLINE_OPTYPE_REQUIRED, 0x0, 's', "Bake values into the defaults of specialization constants, seperated by comma or ';'", "Name/ConstantId=Value" },
+        { "limits-report", 'Q', SX_CMDLINE_OPTYPE_FLAG_SET, &args.limits_report, 1, "Report how much of each shader limit the stages use", 0x0 },
+        { "limits", 'M', SX_CMDLINE_OPTYPE_REQUIRED, 0x0, 'M', "Load shader limits from a file in --dumpc format, stages that exceed them fail to compile", "Filepath" },
+        { "perf-lint", 'W', SX_CMDLINE_OPTYPE_FLAG_SET, &args.perf_lint, 1, "Warn about code that is slow on tile-based GPUs: dependent reads (GLES2), dynamic uniform indexing, discard, derivatives in branches, highp (GLES)", 0x0 },
+        { "vertex-formats", 'X', SX_CMDLINE_OPTYPE_FLAG_SET, &args.vertex_formats, 1, "Reflect precision and compact format hints of vertex inputs, to json and VFMT chunks of SGS files", 0x0 },
+        { "watch", 'w', SX_CMDLINE_OPTYPE_REQUIRED, 0x0, 'w', "Watch directory and recompile changed shaders, --output is the output directory (linux only)", "Directory" },
         SX_CMDLINE_OPT_END
     };
     sx_cmdline_context* cmdline = sx_cmdline_create_context(g_alloc, argc, (const char**)argv, opts);
@@ -1823,13 +3040,29 @@ int main(int argc, char* argv[])
             args.out_filepath = arg;
             break;
         case 'D':
-            parse_defines(&args, arg);
+            parse_defines(&args.defines, arg);
+            break;
+        case 's':
+            parse_defines(&args.spec_values, arg);
+            break;
+        case 'e':
+            parse_defines(&args.spec_defines, arg);
+            for (int i = 0; i < sx_array_count(args.spec_defines); i++) {
+                char* colon = (char*)sx_strchar(args.spec_defines[i].def, ':');
+                if (colon) {
+                    *colon = 0;
+                    args.spec_defines[i].type = colon + 1;
+                }
+            }
+            break;
+        case 'H':
+            parse_defines(&args.bind_bases, arg);
             break;
         case 'l':
             args.lang = parse_shader_lang(arg);
             break;
         case 'h':
-            print_help(cmdline);
+            print_help(opts);
             break;
         case 'p':
             args.profile_ver = sx_toint(arg);
@@ -1837,6 +3070,9 @@ int main(int argc, char* argv[])
         case 'I':
             parse_includes(&args, arg);
             break;
+        case 'n':
+            parse_names(&args.unorm_textures, arg);
+            break;
         case 'N':
             args.cvar = arg;
             break;
@@ -1844,12 +3080,22 @@ int main(int argc, char* argv[])
             args.reflect_filepath = arg;
             args.reflect = 1;
             break;
+        case 'T':
+            args.stats_filepath = arg;
+            args.stats = 1;
+            break;
         case 'i':
             detect_input_file(&args, arg);
             break;
         case 'E':
             args.err_format = parse_output_errorformat(arg);
             break;
+        case 'M':
+            args.limits_filepath = arg;
+            break;
+        case 'w':
+            args.watch_dir = arg;
+            break;
         default:
             break;
         }
@@ -1860,8 +3106,13 @@ int main(int argc, char* argv[])
         exit(0);
     }
 
+    // limits are loaded once and shared by all compiles of the session
+    TBuiltInResource limits_conf = k_default_conf;
+    if (args.limits_filepath && !load_conf(args.limits_filepath, &limits_conf))
+        exit(-1);
+
     if (dump_conf) {
-        puts(get_default_conf_str().c_str());
+        puts(get_conf_str(limits_conf).c_str());
         exit(0);
     }
 
@@ -1870,7 +3121,7 @@ int main(int argc, char* argv[])
         exit(-1);
     }
 
-    if (!args.vs_filepath && !args.fs_filepath && !args.cs_filepath) {
+    if (!args.vs_filepath && !args.fs_filepath && !args.cs_filepath && !args.watch_dir) {
         puts("You must at least define one input shader file");
         exit(-1);
     }
@@ -1890,7 +3141,33 @@ int main(int argc, char* argv[])
         exit(-1);
     }
 
-    if (args.out_filepath) {
+    // parts are only separate arrays in GL, the other backends would need the part mapping in SGS reflection
+    if (args.split_ubos) {
+        if (args.lang != SHADER_LANG_GLES && args.lang != SHADER_LANG_GLSL) {
+            puts("--split-ubos is only supported for GLES and GLSL");
+            exit(-1);
+        }
+        args.flatten_ubos = 1;
+    }
+
+    uint32_t bind_bases[BINDING_CLASS_COUNT];
+    if (!get_binding_bases(args, bind_bases)) {
+        puts("Binding bases must be Class=Base pairs with classes: ubo, ssbo, texture, image, sampler");
+        exit(-1);
+    }
+
+    pipeline_options pipeline_opts;
+    get_pipeline_options(args, k_default_conf, &pipeline_opts);
+    for (int i = 0; i < sx_array_count(args.spec_defines); i++) {
+        std::string decl;
+        if (!pipeline_spec_define_decl(pipeline_opts, i, &decl)) {
+            printf("Spec define '%s' must be NAME[:int] with an integer value or NAME:bool with a bool value\n",
+                   args.spec_defines[i].def);
+            exit(-1);
+        }
+    }
+
+    if (args.out_filepath && !args.watch_dir) {
         // determine if we output SGS format automatically
         char ext[32];
         sx_os_path_ext(ext, sizeof(ext), args.out_filepath);
@@ -1901,14 +3178,8 @@ int main(int argc, char* argv[])
     // Set default shader profile version
     // HLSL: 50 (5.0)
     // GLSL: 200 (2.00)
-    if (args.profile_ver == 0) {
-        if (args.lang == SHADER_LANG_GLES)
-            args.profile_ver = 200;
-        else if (args.lang == SHADER_LANG_HLSL)
-            args.profile_ver = 50; // D3D11
-        else if (args.lang == SHADER_LANG_GLSL)
-            args.profile_ver = 330;
-    }
+    if (args.profile_ver == 0 && args.lang != SHADER_LANG_COUNT)
+        args.profile_ver = pipeline_default_profile((glslcc_lang)args.lang);
 
 #if SX_PLATFORM_WINDOWS
     if (args.compile_bin && (args.lang != SHADER_LANG_HLSL || args.profile_ver >= 60)) {
@@ -1929,37 +3200,13 @@ int main(int argc, char* argv[])
     }
 #endif
 
-    if (args.sgs_file && !(args.preprocess | args.validate | args.list_includes)) {
-        uint32_t slang = 0;
-        switch (args.lang) {
-        case SHADER_LANG_GLES:
-            slang = SGS_LANG_GLES;
-            break;
-        case SHADER_LANG_HLSL:
-            slang = SGS_LANG_HLSL;
-            break;
-        case SHADER_LANG_MSL:
-            slang = SGS_LANG_MSL;
-            break;
-        case SHADER_LANG_GLSL:
-            slang = SGS_LANG_GLSL;
-            break;
-        default:
-            sx_assert(0);
-            break;
-        }
-        g_sgs = sgs_create_file(g_alloc, args.out_filepath, slang, args.profile_ver);
-        sx_assert(g_sgs);
-    }
-
-    int r = compile_files(args, k_default_conf);
-
-    if (g_sgs) {
-        if (r == 0 && !sgs_commit(g_sgs)) {
-            printf("Writing SGS file '%s' failed\n", args.out_filepath);
-        }
-        sgs_destroy_file(g_sgs);
-    }
+    glslang::InitializeProcess();
+    int r;
+    if (args.watch_dir)
+        r = watch_files(args, limits_conf);
+    else
+        r = compile_program(args, limits_conf);
+    glslang::FinalizeProcess();
 
     sx_cmdline_destroy_context(cmdline, g_alloc);
     cleanup_args(&args);
@@ -0,0 +1,142 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+
+#include "json-writer.h"
+
+#include "sx/string.h"
+
+static void json__indent(json_writer* w, int level)
+{
+    for (int i = 0; i < level; i++)
+        w->out->append(w->space);
+}
+
+static void json__emit_string(json_writer* w, const char* str)
+{
+    static const char* hex = "0123456789ABCDEF";
+    std::string& out = *w->out;
+
+    out.push_back('"');
+    for (const char* s = str; *s; s++) {
+        unsigned char c = (unsigned char)*s;
+        switch (c) {
+        case '"':  out.append("\\\""); break;
+        case '\\': out.append("\\\\"); break;
+        case '\b': out.append("\\b");  break;
+        case '\f': out.append("\\f");  break;
+        case '\n': out.append("\\n");  break;
+        case '\r': out.append("\\r");  break;
+        case '\t': out.append("\\t");  break;
+        default:
+            if (c < 0x1F) {
+                out.append("\\u00");
+                out.push_back(hex[(c >> 4) & 0xF]);
+                out.push_back(hex[c & 0xF]);
+            } else {
+                out.push_back((char)c);
+            }
+            break;
+        }
+    }
+    out.push_back('"');
+}
+
+// writes separator, indentation and key for the next element of the current container
+static void json__begin_value(json_writer* w, const char* key)
+{
+    if (w->depth > 0) {
+        bool first = w->empty[w->depth - 1];
+        w->empty[w->depth - 1] = false;
+
+        if (w->space) {
+            w->out->append(first ? "\n" : ",\n");
+            json__indent(w, w->depth);
+        } else if (!first) {
+            w->out->push_back(',');
+        }
+    }
+
+    if (key) {
+        json__emit_string(w, key);
+        w->out->append(w->space ? ": " : ":");
+    }
+}
+
+static void json__begin_container(json_writer* w, const char* key, char open)
+{
+    sx_assert(w->depth < JSON_WRITER_MAX_DEPTH);
+    json__begin_value(w, key);
+    w->out->push_back(open);
+    w->empty[w->depth++] = true;
+}
+
+static void json__end_container(json_writer* w, char close)
+{
+    sx_assert(w->depth > 0);
+    bool empty = w->empty[--w->depth];
+    if (w->space && !empty) {
+        w->out->push_back('\n');
+        json__indent(w, w->depth);
+    }
+    w->out->push_back(close);
+}
+
+void json_init_writer(json_writer* w, std::string* out, const char* space, size_t reserve_size)
+{
+    w->out = out;
+    w->space = space;
+    w->depth = 0;
+    out->clear();
+    if (reserve_size)
+        out->reserve(reserve_size);
+}
+
+void json_begin_object(json_writer* w, const char* key)
+{
+    json__begin_container(w, key, '{');
+}
+
+void json_end_object(json_writer* w)
+{
+    json__end_container(w, '}');
+}
+
+void json_begin_array(json_writer* w, const char* key)
+{
+    json__begin_container(w, key, '[');
+}
+
+void json_end_array(json_writer* w)
+{
+    json__end_container(w, ']');
+}
+
+void json_put_int(json_writer* w, const char* key, int val)
+{
+    char num[32];
+    json__begin_value(w, key);
+    sx_snprintf(num, sizeof(num), "%d", val);
+    w->out->append(num);
+}
+
+void json_put_double(json_writer* w, const char* key, double val)
+{
+    char num[64];
+    json__begin_value(w, key);
+    sx_snprintf(num, sizeof(num), "%.16g", val);
+    w->out->append(num);
+}
+
+void json_put_bool(json_writer* w, const char* key, bool val)
+{
+    json__begin_value(w, key);
+    w->out->append(val ? "true" : "false");
+}
+
+void json_put_string(json_writer* w, const char* key, const char* val)
+{
+    json__begin_value(w, key);
+    json__emit_string(w, val);
+}
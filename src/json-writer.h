@@ -0,0 +1,33 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+// Streaming json writer: writes values directly into the output string without building a DOM
+// Output is byte-identical to sjson_encode (compact) and sjson_stringify (pretty) of the same document
+//
+#pragma once
+
+#include <stdint.h>
+#include <string>
+
+#define JSON_WRITER_MAX_DEPTH 32
+
+struct json_writer {
+    std::string* out;
+    const char*  space;                         // indentation for pretty output, nullptr for compact output
+    int          depth;
+    bool         empty[JSON_WRITER_MAX_DEPTH];  // container at each depth doesn't have any elements yet
+};
+
+// reserve_size: reserves the output string, so in most cases the document is written with one allocation
+void json_init_writer(json_writer* w, std::string* out, const char* space = nullptr, size_t reserve_size = 0);
+
+// key must be nullptr for array elements, and non-null for object members
+void json_begin_object(json_writer* w, const char* key = nullptr);
+void json_end_object(json_writer* w);
+void json_begin_array(json_writer* w, const char* key = nullptr);
+void json_end_array(json_writer* w);
+void json_put_int(json_writer* w, const char* key, int val);
+void json_put_double(json_writer* w, const char* key, double val);
+void json_put_bool(json_writer* w, const char* key, bool val);
+void json_put_string(json_writer* w, const char* key, const char* val);
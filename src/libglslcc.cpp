@@ -0,0 +1,593 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+#include "libglslcc.h"
+
+#include "sx/timer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "glslang/Public/ShaderLang.h"
+#include "spirv_msl.hpp"
+
+#include "config.h"
+#include "pipeline.h"
+#include "reflect.h"
+#include "sgs-file.h"
+
+// Includer that forwards to the callbacks of the caller
+class CallbackIncluder : public glslang::TShader::Includer {
+public:
+    explicit CallbackIncluder(const glslcc_includer& cb) : m_cb(cb) {}
+
+    virtual ~CallbackIncluder() {}
+
+    IncludeResult* includeSystem(const char* headerName, const char* includerName, size_t inclusionDepth) override
+    {
+        return include(headerName, includerName, true);
+    }
+
+    IncludeResult* includeLocal(const char* headerName, const char* includerName, size_t inclusionDepth) override
+    {
+        return include(headerName, includerName, false);
+    }
+
+    void releaseInclude(IncludeResult* result) override
+    {
+        if (result) {
+            glslcc_include_result* r = (glslcc_include_result*)result->userData;
+            if (m_cb.release_fn)
+                m_cb.release_fn(r, m_cb.user_data);
+            delete r;
+            delete result;
+        }
+    }
+
+private:
+    IncludeResult* include(const char* headerName, const char* includerName, bool system)
+    {
+        if (!m_cb.include_fn)
+            return nullptr;
+
+        glslcc_include_result r;
+        memset(&r, 0x0, sizeof(r));
+        if (!m_cb.include_fn(headerName, includerName, system, &r, m_cb.user_data))
+            return nullptr;
+        return new IncludeResult(r.name ? r.name : headerName, r.data, r.size, new glslcc_include_result(r));
+    }
+
+    glslcc_includer m_cb;
+};
+
+// reflected resources and their names, names are copied to the result block
+template <typename T>
+struct refl_list {
+    std::vector<T>           items;
+    std::vector<std::string> names;
+};
+
+struct stage_output {
+    glslcc_stage                               stage;
+    std::string                                code;
+    glslcc_reflection                          refl;    // compute info, arrays are written with the result
+    refl_list<glslcc_refl_input>               inputs;
+    refl_list<glslcc_refl_buffer>              uniform_buffers;
+    std::vector<refl_list<glslcc_refl_member>> ubo_members;     // members of each uniform buffer
+    std::vector<std::string>                   ubo_blocks;      // split block of each uniform buffer, can be empty
+    refl_list<glslcc_refl_buffer>              storage_buffers;
+    refl_list<glslcc_refl_texture>             textures;
+    refl_list<glslcc_refl_texture>             storage_images;
+    refl_list<glslcc_refl_spec_constant>       spec_constants;
+    refl_list<glslcc_refl_combined_sampler>    combined_samplers;
+    std::vector<std::string>                   combined_images;     // image and sampler of each combined sampler,
+    std::vector<std::string>                   combined_smplrs;     // the sampler is empty for dummy samplers
+    std::vector<glslcc_refl_argbuf>            argbufs;
+    std::vector<refl_list<glslcc_refl_argbuf_member>> argbuf_members;   // members of each argument buffer
+};
+
+struct compile_output {
+    std::string               log;
+    std::vector<stage_output> stages;
+    bool                      has_timings;
+    pipeline_timings          timings;
+};
+
+// places the result and its data in a single block, only measures the size if base is null
+struct block_writer {
+    uint8_t* base;
+    size_t   offset;
+
+    void* alloc(size_t size, size_t align = 8)
+    {
+        offset = (offset + align - 1) & ~(align - 1);
+        void* ptr = base ? base + offset : nullptr;
+        offset += size;
+        return ptr;
+    }
+
+    const char* add_str(const std::string& str)
+    {
+        char* ptr = (char*)alloc(str.length() + 1, 1);
+        if (ptr)
+            memcpy(ptr, str.c_str(), str.length() + 1);
+        return ptr;
+    }
+};
+
+static const EShLanguage k_stages[] = { EShLangVertex, EShLangFragment, EShLangCompute };
+
+static void* default_alloc(size_t size, void* user_data)
+{
+    return malloc(size);
+}
+
+template <typename T>
+static void add_refl_item(refl_list<T>* list, const T& item, const std::string& name)
+{
+    list->items.push_back(item);
+    list->names.push_back(name);
+}
+
+// same data as the SGS reflection of the command line, with the uniform block members of the JSON reflection
+static void reflect_resources(const pipeline_options& opts, const pipeline_stage& st, stage_output* out)
+{
+    static const uint32_t k_freq_fourccs[UBO_FREQUENCY_COUNT] = {
+        SGS_UBOFREQ_FRAME, SGS_UBOFREQ_MATERIAL, SGS_UBOFREQ_DRAW, 0
+    };
+
+    const spirv_cross::Compiler& compiler = *st.compiler;
+    const spirv_cross::ShaderResources& ress = st.ress;
+    auto get_name = [&compiler](const spirv_cross::Resource& res) -> std::string {
+        const spirv_cross::SPIRType& type = compiler.get_type(res.type_id);
+        bool is_push_constant = compiler.get_storage_class(res.id) == spv::StorageClassPushConstant;
+        bool is_block = compiler.has_decoration(type.self, spv::DecorationBlock) ||
+                        compiler.has_decoration(type.self, spv::DecorationBufferBlock);
+        uint32_t fallback_id = !is_push_constant && is_block ? (uint32_t)res.base_type_id : (uint32_t)res.id;
+        return !res.name.empty() ? res.name : compiler.get_fallback_name(fallback_id);
+    };
+    auto get_decoration = [&compiler](const spirv_cross::Resource& res, spv::Decoration deco) -> int {
+        return compiler.has_decoration(res.id, deco) ? (int)compiler.get_decoration(res.id, deco) : -1;
+    };
+    auto get_array_size = [](const spirv_cross::SPIRType& type) -> int {
+        int array_size = 1;
+        if (!type.array.empty()) {
+            array_size = 0;
+            for (auto arr : type.array)
+                array_size += arr;
+        }
+        return array_size;
+    };
+    auto add_textures = [&](const spirv_cross::SmallVector<spirv_cross::Resource>& list,
+                            refl_list<glslcc_refl_texture>* textures) {
+        for (auto& res : list) {
+            const spirv_cross::SPIRType& type = compiler.get_type(res.type_id);
+            glslcc_refl_texture t;
+            memset(&t, 0x0, sizeof(t));
+            t.set = get_decoration(res, spv::DecorationDescriptorSet);
+            t.binding = get_decoration(res, spv::DecorationBinding);
+            t.image_dim = k_texture_dim_fourcc[type.image.dim];
+            t.is_array = type.image.arrayed;
+            t.multisample = type.image.ms;
+            add_refl_item(textures, t, get_name(res));
+        }
+    };
+
+    if (st.stage == EShLangVertex) {
+        for (auto& res : ress.stage_inputs) {
+            glslcc_refl_input i;
+            memset(&i, 0x0, sizeof(i));
+            i.location = get_decoration(res, spv::DecorationLocation);
+            if (i.location >= 0 && i.location < VERTEX_ATTRIB_COUNT) {
+                i.semantic = k_attrib_sem_names[i.location];
+                i.semantic_index = k_attrib_sem_indices[i.location];
+            }
+            i.format = get_vertex_format(compiler.get_type(res.type_id));
+            const vertex_format_mapping* compact = get_compact_vertex_format(compiler, res, i.location, &i.mediump);
+            i.compact_format = compact ? compact->fourcc : 0;
+            add_refl_item(&out->inputs, i, get_name(res));
+        }
+    }
+
+    for (auto& res : ress.uniform_buffers) {
+        glslcc_refl_buffer b;
+        memset(&b, 0x0, sizeof(b));
+        b.set = get_decoration(res, spv::DecorationDescriptorSet);
+        b.binding = get_decoration(res, spv::DecorationBinding);
+        b.size_bytes = (uint32_t)compiler.get_declared_struct_size(compiler.get_type(res.base_type_id));
+        b.array_size = opts.flatten_ubos ? ((int)b.size_bytes + 15) / 16 :
+                                           get_array_size(compiler.get_type(res.type_id));
+
+        // parts of split blocks are matched by their block names
+        std::string block;
+        if (opts.split_ubos) {
+            const std::string& block_name = compiler.get_name(res.base_type_id);
+            ubo_frequency freq = ubo_frequency_from_name(block_name.c_str());
+            for (const ubo_split_part& part : st.ubo_splits) {
+                if (part.name == block_name) {
+                    block = part.block;
+                    freq = part.freq;
+                    break;
+                }
+            }
+            b.frequency = k_freq_fourccs[freq];
+        }
+
+        const spirv_cross::SPIRType& type = compiler.get_type(res.base_type_id);
+        refl_list<glslcc_refl_member> members;
+        for (uint32_t k = 0; k < (uint32_t)type.member_types.size(); k++) {
+            const spirv_cross::SPIRType& member_type = compiler.get_type(type.member_types[k]);
+            const uniform_type_mapping* mapping = find_uniform_type(member_type);
+            glslcc_refl_member m;
+            memset(&m, 0x0, sizeof(m));
+            m.type = mapping ? mapping->fourcc : 0;
+            m.type_str = mapping ? mapping->type_str : "unknown";
+            m.offset = compiler.type_struct_member_offset(type, k);
+            m.size_bytes = (uint32_t)compiler.get_declared_struct_member_size(type, k);
+            m.array_size = member_type.array.empty() ? 0 : get_array_size(member_type);
+            add_refl_item(&members, m, compiler.get_member_name(type.self, k));
+        }
+
+        add_refl_item(&out->uniform_buffers, b, get_name(res));
+        out->ubo_members.push_back(members);
+        out->ubo_blocks.push_back(block);
+    }
+
+    for (auto& res : ress.storage_buffers) {
+        if (compiler.buffer_is_hlsl_counter_buffer(res.id))
+            continue;
+        glslcc_refl_buffer b;
+        memset(&b, 0x0, sizeof(b));
+        b.set = get_decoration(res, spv::DecorationDescriptorSet);
+        b.binding = get_decoration(res, spv::DecorationBinding);
+        b.size_bytes = (uint32_t)compiler.get_declared_struct_size(compiler.get_type(res.base_type_id));
+        b.array_size = get_array_size(compiler.get_type(res.type_id));
+        add_refl_item(&out->storage_buffers, b, get_name(res));
+    }
+
+    add_textures(ress.sampled_images, &out->textures);
+    add_textures(ress.storage_images, &out->storage_images);
+
+    for (auto& sc : compiler.get_specialization_constants()) {
+        const spec_type_mapping* type = resolve_spec_type(compiler, sc);
+        if (!type)
+            continue;
+        glslcc_refl_spec_constant s;
+        memset(&s, 0x0, sizeof(s));
+        s.constant_id = sc.constant_id;
+        s.type = type->fourcc;
+        s.value = compiler.get_constant(sc.id).scalar();
+        add_refl_item(&out->spec_constants, s, compiler.get_name(sc.id));
+    }
+
+    for (auto& cs : compiler.get_combined_image_samplers()) {
+        bool dummy = is_dummy_sampler(compiler, cs.sampler_id);
+        glslcc_refl_combined_sampler c;
+        memset(&c, 0x0, sizeof(c));
+        c.binding = get_binding(compiler, cs.combined_id);
+        c.image_binding = get_binding(compiler, cs.image_id);
+        c.sampler_binding = dummy ? -1 : get_binding(compiler, cs.sampler_id);
+        add_refl_item(&out->combined_samplers, c, compiler.get_name(cs.combined_id));
+        out->combined_images.push_back(compiler.get_name(cs.image_id));
+        out->combined_smplrs.push_back(dummy ? std::string() : compiler.get_name(cs.sampler_id));
+    }
+
+    if (opts.lang == GLSLCC_LANG_MSL && opts.msl_argument_buffers) {
+        std::vector<msl_argument> margs;
+        get_msl_arguments(static_cast<const spirv_cross::CompilerMSL&>(compiler), ress, &margs);
+        for (size_t i = 0; i < margs.size(); i++) {
+            const msl_argument& a = margs[i];
+            if (i == 0 || a.set != margs[i - 1].set) {
+                glslcc_refl_argbuf ab;
+                memset(&ab, 0x0, sizeof(ab));
+                ab.set = a.set;
+                ab.buffer_index = a.set;
+                out->argbufs.push_back(ab);
+                out->argbuf_members.push_back(refl_list<glslcc_refl_argbuf_member>());
+            }
+
+            glslcc_refl_argbuf_member m;
+            memset(&m, 0x0, sizeof(m));
+            m.id = a.id;
+            m.offset = a.offset;
+            m.kind = a.kind;
+            m.binding = a.binding;
+            m.array_size = a.array_size;
+            add_refl_item(&out->argbuf_members.back(), m, a.name);
+            out->argbufs.back().size_bytes = a.offset + 8 * a.array_size;
+        }
+    }
+}
+
+static void get_defines(std::vector<pipeline_define>* defines, const glslcc_define* ds, int count)
+{
+    for (int i = 0; i < count; i++)
+        defines->push_back({ ds[i].name, ds[i].value, nullptr });
+}
+
+static bool get_options(const glslcc_compile_desc& desc, TBuiltInResource* limits, pipeline_options* opts,
+                        std::string* log)
+{
+    opts->lang = desc.lang;
+    opts->profile_ver = desc.profile_ver ? desc.profile_ver : pipeline_default_profile(desc.lang);
+
+    *limits = k_default_conf;
+    std::string err;
+    if (desc.limits && !parse_conf(desc.limits, limits, &err)) {
+        *log += "limits: " + err + "\n";
+        return false;
+    }
+    opts->limits = limits;
+
+    get_defines(&opts->defines, desc.defines, desc.num_defines);
+    get_defines(&opts->spec_values, desc.spec_values, desc.num_spec_values);
+    for (int i = 0; i < desc.num_spec_defines; i++) {
+        const glslcc_spec_define& sd = desc.spec_defines[i];
+        opts->spec_defines.push_back({ sd.name, sd.value, sd.is_bool ? "bool" : nullptr });
+    }
+    for (int i = 0; i < desc.num_unorm_textures; i++)
+        opts->unorm_textures.push_back(desc.unorm_textures[i]);
+
+    opts->shift_bindings = false;
+    for (int i = 0; i < BINDING_CLASS_COUNT; i++) {
+        opts->bind_bases[i] = desc.bind_bases[i];
+        opts->shift_bindings |= desc.bind_bases[i] != 0;
+    }
+
+    uint32_t flags = desc.flags;
+    opts->invert_y = (flags & GLSLCC_FLAG_INVERT_Y) != 0;
+    opts->flatten_ubos = (flags & (GLSLCC_FLAG_FLATTEN_UBOS | GLSLCC_FLAG_SPLIT_UBOS)) != 0;
+    opts->strip_unused = (flags & GLSLCC_FLAG_STRIP_UNUSED) != 0;
+    opts->link_varyings = (flags & GLSLCC_FLAG_LINK_VARYINGS) != 0;
+    opts->pack_varyings = (flags & GLSLCC_FLAG_PACK_VARYINGS) != 0;
+    opts->infer_mediump = (flags & GLSLCC_FLAG_INFER_MEDIUMP) != 0;
+    opts->minify = (flags & GLSLCC_FLAG_MINIFY) != 0;
+    opts->pack_ubos = (flags & GLSLCC_FLAG_PACK_UBOS) != 0;
+    opts->split_ubos = (flags & GLSLCC_FLAG_SPLIT_UBOS) != 0;
+    opts->auto_bind = (flags & GLSLCC_FLAG_AUTO_BIND) != 0;
+    opts->combine_samplers = (flags & GLSLCC_FLAG_COMBINE_SAMPLERS) != 0;
+    opts->msl_argument_buffers = (flags & GLSLCC_FLAG_MSL_ARGUMENT_BUFFERS) != 0;
+    opts->perf_lint = false;
+    opts->stats = false;
+    opts->timings = nullptr;
+
+    if (opts->split_ubos && desc.lang != GLSLCC_LANG_GLES && desc.lang != GLSLCC_LANG_GLSL) {
+        *log += "GLSLCC_FLAG_SPLIT_UBOS is only supported for GLES and GLSL\n";
+        return false;
+    }
+
+    for (int i = 0; i < desc.num_spec_defines; i++) {
+        std::string decl;
+        if (!pipeline_spec_define_decl(*opts, i, &decl)) {
+            *log += std::string("Spec define '") + desc.spec_defines[i].name +
+                    "' must have an integer value, or a bool value if it's a bool\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+// stages fail if they exceed the limits of desc.limits, the default limits are only checked as warnings
+static bool check_limits(const glslcc_compile_desc& desc, const pipeline_stage& st, const char* filename,
+                         std::string* log)
+{
+    bool r = true;
+    for (const limit_usage& u : st.limits) {
+        if (u.used > u.limit && (desc.limits || u.warn)) {
+            char msg[256];
+            snprintf(msg, sizeof(msg), "%s: %s: limits: %s is %d, the limit is %d\n", desc.limits ? "ERROR" : "WARNING",
+                     filename, u.name, u.used, u.limit);
+            *log += msg;
+            r = r && !desc.limits;
+        }
+    }
+    return r;
+}
+
+static bool compile_program(const glslcc_compile_desc& desc, compile_output* out)
+{
+    TBuiltInResource limits;
+    pipeline_options opts;
+    if (!get_options(desc, &limits, &opts, &out->log))
+        return false;
+    if (out->has_timings)
+        opts.timings = &out->timings;
+
+    pipeline_preamble pre;
+    pipeline_get_preamble(opts, &pre);
+
+    // shaders have to be destroyed before the program
+    glslang::TProgram prog;
+    std::vector<std::unique_ptr<glslang::TShader>> shaders;
+    std::vector<pipeline_source> srcs(desc.num_stages);
+    std::vector<EShLanguage> stages(desc.num_stages);
+    CallbackIncluder includer(desc.includer);
+
+    for (int i = 0; i < desc.num_stages; i++) {
+        const glslcc_stage_source& src = desc.stages[i];
+        stages[i] = k_stages[src.stage];
+        srcs[i] = { stages[i], src.name ? src.name : "", src.source,
+                    src.size ? (int)src.size : (int)strlen(src.source) };
+
+        glslang::TShader* shader = new glslang::TShader(stages[i]);
+        shaders.push_back(std::unique_ptr<glslang::TShader>(shader));
+        pipeline_setup_shader(opts, pre, srcs[i], shader);
+
+        bool parsed = pipeline_parse(opts, shader, includer);
+        out->log += shader->getInfoLog();
+        if (!parsed)
+            return false;
+        prog.addShader(shader);
+    }
+
+    std::vector<std::vector<uint32_t>> spirvs;
+    pipeline_program program;
+    if (!pipeline_link(opts, &prog, stages, &spirvs, &program, &out->log))
+        return false;
+    pipeline_program_passes(opts, stages, &spirvs, &program, &out->log);
+
+    out->stages.resize(desc.num_stages);
+    for (int i = 0; i < desc.num_stages; i++) {
+        stage_output* so = &out->stages[i];
+        so->stage = desc.stages[i].stage;
+        memset(&so->refl, 0x0, sizeof(so->refl));
+
+        pipeline_stage st;
+        if (!pipeline_compile_stage(opts, &program, stages[i], spirvs[i], srcs[i].filename, &st, &out->log) ||
+            !check_limits(desc, st, srcs[i].filename, &out->log)) {
+            return false;
+        }
+
+        so->code = st.code;
+        if (stages[i] == EShLangCompute) {
+            for (int k = 0; k < 3; k++)
+                so->refl.workgroup_size[k] = st.cs.workgroup_size[k];
+            so->refl.shared_memory_size = st.cs.shared_memory_size;
+        }
+        reflect_resources(opts, st, so);
+    }
+
+    return true;
+}
+
+// set_item writes the other data of the item (nested lists and strings) after its name
+template <typename T, typename F>
+static const T* write_refl_list(block_writer* w, const refl_list<T>& list, int* count, F set_item)
+{
+    std::vector<T> items = list.items;
+    T* dst = (T*)w->alloc(sizeof(T) * items.size());
+    for (size_t i = 0; i < items.size(); i++) {
+        items[i].name = w->add_str(list.names[i]);
+        set_item(&items[i], i);
+    }
+    if (dst)
+        memcpy(dst, items.data(), sizeof(T) * items.size());
+    *count = (int)items.size();
+    return dst;
+}
+
+template <typename T>
+static const T* write_refl_list(block_writer* w, const refl_list<T>& list, int* count)
+{
+    return write_refl_list(w, list, count, [](T*, size_t) {});
+}
+
+static const glslcc_refl_argbuf* write_argbufs(block_writer* w, const stage_output& so, int* count)
+{
+    std::vector<glslcc_refl_argbuf> argbufs = so.argbufs;
+    glslcc_refl_argbuf* dst = (glslcc_refl_argbuf*)w->alloc(sizeof(glslcc_refl_argbuf) * argbufs.size());
+    for (size_t i = 0; i < argbufs.size(); i++)
+        argbufs[i].members = write_refl_list(w, so.argbuf_members[i], &argbufs[i].num_members);
+    if (dst)
+        memcpy(dst, argbufs.data(), sizeof(glslcc_refl_argbuf) * argbufs.size());
+    *count = (int)argbufs.size();
+    return dst;
+}
+
+static glslcc_result* write_result(const compile_output& out, bool ok, block_writer* w)
+{
+    glslcc_result r;
+    memset(&r, 0x0, sizeof(r));
+    glslcc_result* dst = (glslcc_result*)w->alloc(sizeof(glslcc_result));
+
+    r.ok = ok;
+    r.log = w->add_str(out.log);
+    r.num_stages = ok ? (int)out.stages.size() : 0;
+    for (int i = 0; i < r.num_stages; i++) {
+        const stage_output& so = out.stages[i];
+        glslcc_stage_output& o = r.stages[i];
+        o.stage = so.stage;
+        o.code = w->add_str(so.code);
+        o.code_size = so.code.length();
+        o.refl = so.refl;
+        o.refl.inputs = write_refl_list(w, so.inputs, &o.refl.num_inputs);
+        o.refl.uniform_buffers = write_refl_list(w, so.uniform_buffers, &o.refl.num_uniform_buffers,
+            [&](glslcc_refl_buffer* b, size_t k) {
+                b->members = write_refl_list(w, so.ubo_members[k], &b->num_members);
+                b->block = !so.ubo_blocks[k].empty() ? w->add_str(so.ubo_blocks[k]) : nullptr;
+            });
+        o.refl.storage_buffers = write_refl_list(w, so.storage_buffers, &o.refl.num_storage_buffers);
+        o.refl.textures = write_refl_list(w, so.textures, &o.refl.num_textures);
+        o.refl.storage_images = write_refl_list(w, so.storage_images, &o.refl.num_storage_images);
+        o.refl.spec_constants = write_refl_list(w, so.spec_constants, &o.refl.num_spec_constants);
+        o.refl.combined_samplers = write_refl_list(w, so.combined_samplers, &o.refl.num_combined_samplers,
+            [&](glslcc_refl_combined_sampler* c, size_t k) {
+                c->image = w->add_str(so.combined_images[k]);
+                c->sampler = !so.combined_smplrs[k].empty() ? w->add_str(so.combined_smplrs[k]) : nullptr;
+            });
+        o.refl.argument_buffers = write_argbufs(w, so, &o.refl.num_argument_buffers);
+    }
+
+    if (out.has_timings) {
+        glslcc_timings* timings = (glslcc_timings*)w->alloc(sizeof(glslcc_timings));
+        if (timings) {
+            timings->parse_us = sx_tm_us(out.timings.parse);
+            timings->link_us = sx_tm_us(out.timings.link);
+            timings->spirv_us = sx_tm_us(out.timings.spirv);
+            timings->passes_us = sx_tm_us(out.timings.passes);
+            timings->cross_us = sx_tm_us(out.timings.cross);
+        }
+        r.timings = timings;
+    }
+
+    if (dst)
+        memcpy(dst, &r, sizeof(r));
+    return dst;
+}
+
+void glslcc_init(void)
+{
+    glslang::InitializeProcess();
+    sx_tm_init();
+}
+
+void glslcc_shutdown(void)
+{
+    glslang::FinalizeProcess();
+}
+
+glslcc_result* glslcc_compile(const glslcc_compile_desc* desc)
+{
+    compile_output out;
+    out.has_timings = (desc->flags & GLSLCC_FLAG_TIMINGS) != 0;
+    memset(&out.timings, 0x0, sizeof(out.timings));
+    bool ok = false;
+    if (desc->num_stages < 1 || desc->num_stages > GLSLCC_MAX_STAGES) {
+        out.log = "invalid number of stages\n";
+    } else if (desc->lang < GLSLCC_LANG_GLES || desc->lang > GLSLCC_LANG_GLSL) {
+        out.log = "invalid language\n";
+    } else {
+        ok = true;
+        for (int i = 0; i < desc->num_stages && ok; i++) {
+            glslcc_stage stage = desc->stages[i].stage;
+            if (stage < GLSLCC_STAGE_VERTEX || stage > GLSLCC_STAGE_COMPUTE) {
+                out.log = "invalid stage\n";
+                ok = false;
+            } else if (!desc->stages[i].source) {
+                out.log = "stage has no source\n";
+                ok = false;
+            }
+        }
+        if (ok)
+            ok = compile_program(*desc, &out);
+    }
+
+    glslcc_allocator alloc = desc->allocator;
+    if (!alloc.alloc)
+        alloc.alloc = default_alloc;
+
+    block_writer w = { nullptr, 0 };
+    write_result(out, ok, &w);
+
+    w.base = (uint8_t*)alloc.alloc(w.offset, alloc.user_data);
+    if (!w.base)
+        return nullptr;
+    w.offset = 0;
+    return write_result(out, ok, &w);
+}
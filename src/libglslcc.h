@@ -0,0 +1,275 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+// libglslcc: C API of the compile pipeline, for engines and tools that compile shaders in-process
+//      - sources are compiled from memory, #include files are resolved by a callback
+//      - all the output (code, reflection and the compiler log) is a single block that is allocated with the
+//        caller's allocator, the caller owns it and frees it with the matching free function
+//      - nothing is printed or written to disk
+//
+// Usage:
+//      glslcc_init();
+//      glslcc_compile_desc desc = {0};
+//      desc.lang = GLSLCC_LANG_GLES;
+//      desc.profile_ver = 300;
+//      desc.stages[0] = (glslcc_stage_source){ GLSLCC_STAGE_VERTEX, "shader.vert", vs_code, vs_len };
+//      desc.stages[1] = (glslcc_stage_source){ GLSLCC_STAGE_FRAGMENT, "shader.frag", fs_code, fs_len };
+//      desc.num_stages = 2;
+//      glslcc_result* r = glslcc_compile(&desc);
+//      if (r && r->ok) { ... r->stages[0].code ... }
+//      free(r);
+//      glslcc_shutdown();
+//
+// Vertex formats, image dimensions and the other type codes of the reflection are the fourcc codes of sgs-file.h
+// (SGS_VERTEXFORMAT_*, SGS_IMAGEDIM_*, SGS_SPECTYPE_*, SGS_ARGKIND_*, SGS_UBOFREQ_*)
+//
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GLSLCC_MAX_STAGES 3
+
+typedef enum glslcc_stage {
+    GLSLCC_STAGE_VERTEX = 0,
+    GLSLCC_STAGE_FRAGMENT,
+    GLSLCC_STAGE_COMPUTE
+} glslcc_stage;
+
+typedef enum glslcc_lang {
+    GLSLCC_LANG_GLES = 0,
+    GLSLCC_LANG_HLSL,
+    GLSLCC_LANG_MSL,
+    GLSLCC_LANG_GLSL
+} glslcc_lang;
+
+// same as the command line flags with the same names
+typedef enum glslcc_flags {
+    GLSLCC_FLAG_INVERT_Y = 0x1,
+    GLSLCC_FLAG_FLATTEN_UBOS = 0x2,
+    GLSLCC_FLAG_STRIP_UNUSED = 0x4,
+    GLSLCC_FLAG_LINK_VARYINGS = 0x8,
+    GLSLCC_FLAG_PACK_VARYINGS = 0x10,     // implies GLSLCC_FLAG_LINK_VARYINGS
+    GLSLCC_FLAG_INFER_MEDIUMP = 0x20,     // GLES only
+    GLSLCC_FLAG_MINIFY = 0x40,            // GLES and GLSL only
+    GLSLCC_FLAG_PACK_UBOS = 0x80,
+    GLSLCC_FLAG_AUTO_BIND = 0x100,
+    GLSLCC_FLAG_SPLIT_UBOS = 0x200,           // GLES and GLSL only, implies GLSLCC_FLAG_FLATTEN_UBOS
+    GLSLCC_FLAG_COMBINE_SAMPLERS = 0x400,     // GLES and GLSL only
+    GLSLCC_FLAG_MSL_ARGUMENT_BUFFERS = 0x800,
+    GLSLCC_FLAG_TIMINGS = 0x1000              // fills glslcc_result.timings
+} glslcc_flags;
+
+// resource classes of glslcc_compile_desc.bind_bases
+typedef enum glslcc_binding_class {
+    GLSLCC_BINDING_UNIFORM_BUFFER = 0,
+    GLSLCC_BINDING_STORAGE_BUFFER,
+    GLSLCC_BINDING_TEXTURE,
+    GLSLCC_BINDING_STORAGE_IMAGE,
+    GLSLCC_BINDING_SAMPLER,
+    GLSLCC_BINDING_CLASS_COUNT
+} glslcc_binding_class;
+
+// the returned memory should be aligned to 8 bytes at least
+typedef struct glslcc_allocator {
+    void* (*alloc)(size_t size, void* user_data);
+    void* user_data;
+} glslcc_allocator;
+
+typedef struct glslcc_include_result {
+    const char* name;       // resolved name of the file, used for nested includes and in error messages
+    const char* data;
+    size_t      size;
+    void*       user_data;  // for the release callback
+} glslcc_include_result;
+
+// Resolves #include "header_name" (system = false) and #include <header_name> (system = true)
+// includer_name is the name of the source or the include file that has the directive
+// Returns false if the file can't be found, the result is released with release_fn after it's parsed
+typedef bool (*glslcc_include_fn)(const char* header_name, const char* includer_name, bool system,
+                                  glslcc_include_result* result, void* user_data);
+typedef void (*glslcc_release_include_fn)(const glslcc_include_result* result, void* user_data);
+
+typedef struct glslcc_includer {
+    glslcc_include_fn         include_fn;
+    glslcc_release_include_fn release_fn;
+    void*                     user_data;
+} glslcc_includer;
+
+typedef struct glslcc_define {
+    const char* name;
+    const char* value;      // can be NULL
+} glslcc_define;
+
+// same as --spec-defines: the define is declared as a specialization constant, constant_id is its index
+typedef struct glslcc_spec_define {
+    const char* name;
+    const char* value;      // NULL for the value of the define with the same name: 1 without a value, 0 if it's not defined
+    bool        is_bool;    // int otherwise
+} glslcc_spec_define;
+
+typedef struct glslcc_stage_source {
+    glslcc_stage stage;
+    const char*  name;      // shown in error messages and passed to the include callback
+    const char*  source;
+    size_t       size;      // 0 for null-terminated sources
+} glslcc_stage_source;
+
+typedef struct glslcc_compile_desc {
+    glslcc_stage_source  stages[GLSLCC_MAX_STAGES];
+    int                  num_stages;
+    glslcc_lang          lang;
+    int                  profile_ver;   // same as --profile, 0 for the default of the language
+    uint32_t             flags;         // glslcc_flags
+    const glslcc_define* defines;
+    int                  num_defines;
+    const glslcc_spec_define* spec_defines;
+    int                  num_spec_defines;
+    const glslcc_define* spec_values;   // same as --specialize, names are constant names or constant_ids
+    int                  num_spec_values;
+    const char* const*   unorm_textures;    // same as --unorm-textures, for GLSLCC_FLAG_INFER_MEDIUMP
+    int                  num_unorm_textures;
+    uint32_t             bind_bases[GLSLCC_BINDING_CLASS_COUNT];    // same as --bind-base
+    const char*          limits;        // contents of a --limits file, stages that exceed them fail, can be NULL
+    glslcc_includer      includer;      // #include directives fail if include_fn is NULL
+    glslcc_allocator     allocator;     // malloc is used if alloc is NULL
+} glslcc_compile_desc;
+
+typedef struct glslcc_refl_input {
+    const char* name;
+    int         location;
+    const char* semantic;       // HLSL semantic of the location, static string
+    int         semantic_index;
+    uint32_t    format;         // SGS_VERTEXFORMAT_*
+    uint32_t    compact_format; // smallest format for the semantic and precision of the input
+    bool        mediump;
+} glslcc_refl_input;
+
+typedef struct glslcc_refl_member {
+    const char* name;
+    uint32_t    type;           // SGS_VERTEXFORMAT_* of scalars and vectors, 0 for matrices and structs
+    const char* type_str;       // "float4", "mat4", ..., "unknown" for structs, static string
+    uint32_t    offset;
+    uint32_t    size_bytes;
+    int         array_size;     // 0 if it's not an array
+} glslcc_refl_member;
+
+typedef struct glslcc_refl_buffer {
+    const char*               name;
+    int                       set;
+    int                       binding;
+    uint32_t                  size_bytes;
+    int                       array_size; // uniform buffers: number of vec4s if the block is flattened
+    const glslcc_refl_member* members;    // uniform buffers only
+    int                       num_members;
+    const char*               block;      // GLSLCC_FLAG_SPLIT_UBOS: block of the part, NULL if it's not split
+    uint32_t                  frequency;  // SGS_UBOFREQ_*, 0 if the block has no update frequency
+} glslcc_refl_buffer;
+
+typedef struct glslcc_refl_texture {
+    const char* name;
+    int         set;
+    int         binding;
+    uint32_t    image_dim;      // SGS_IMAGEDIM_*
+    bool        is_array;
+    bool        multisample;
+} glslcc_refl_texture;
+
+typedef struct glslcc_refl_spec_constant {
+    const char* name;
+    uint32_t    constant_id;
+    uint32_t    type;           // SGS_SPECTYPE_*
+    uint32_t    value;          // bits of the default value (bool is 0/1)
+} glslcc_refl_spec_constant;
+
+// GLSLCC_FLAG_COMBINE_SAMPLERS: the combined samplers are also in the textures, with the same names and bindings
+typedef struct glslcc_refl_combined_sampler {
+    const char* name;
+    int         binding;
+    const char* image;
+    int         image_binding;
+    const char* sampler;        // NULL for images that are used without a sampler
+    int         sampler_binding; // -1 without a sampler
+} glslcc_refl_combined_sampler;
+
+// GLSLCC_FLAG_MSL_ARGUMENT_BUFFERS: members are sorted by id, which is the [[id(n)]] index for MTLArgumentEncoder
+typedef struct glslcc_refl_argbuf_member {
+    const char* name;
+    uint32_t    id;
+    uint32_t    offset;         // byte offset for direct encoding, every resource takes 8 bytes
+    uint32_t    kind;           // SGS_ARGKIND_*
+    int         binding;        // binding of the resource in the shader, -1 if it has none
+    uint32_t    array_size;
+} glslcc_refl_argbuf_member;
+
+// argument buffer of a descriptor set
+typedef struct glslcc_refl_argbuf {
+    uint32_t                         set;
+    uint32_t                         buffer_index; // [[buffer(n)]] of the argument buffer
+    uint32_t                         size_bytes;   // size for direct encoding
+    const glslcc_refl_argbuf_member* members;
+    int                              num_members;
+} glslcc_refl_argbuf;
+
+typedef struct glslcc_reflection {
+    const glslcc_refl_input*            inputs;      // vertex inputs
+    int                                 num_inputs;
+    const glslcc_refl_buffer*           uniform_buffers;
+    int                                 num_uniform_buffers;
+    const glslcc_refl_buffer*           storage_buffers;
+    int                                 num_storage_buffers;
+    const glslcc_refl_texture*          textures;
+    int                                 num_textures;
+    const glslcc_refl_texture*          storage_images;
+    int                                 num_storage_images;
+    const glslcc_refl_spec_constant*    spec_constants;
+    int                                 num_spec_constants;
+    const glslcc_refl_combined_sampler* combined_samplers;
+    int                                 num_combined_samplers;
+    const glslcc_refl_argbuf*           argument_buffers;    // MSL only
+    int                                 num_argument_buffers;
+    uint32_t                            workgroup_size[3];       // compute only
+    uint32_t                            shared_memory_size;      // compute only, bytes of all shared variables
+} glslcc_reflection;
+
+typedef struct glslcc_stage_output {
+    glslcc_stage      stage;
+    const char*       code;     // null-terminated source of the target language
+    size_t            code_size;
+    glslcc_reflection refl;
+} glslcc_stage_output;
+
+// time spent in each phase of the compile, summed over the stages
+typedef struct glslcc_timings {
+    double parse_us;    // glslang parse, including preprocess and includes
+    double link_us;
+    double spirv_us;    // SPIR-V generation
+    double passes_us;   // SPIR-V passes: varyings, bindings, precision, uniform blocks
+    double cross_us;    // SPIRV-Cross compile and reflection
+} glslcc_timings;
+
+typedef struct glslcc_result {
+    bool                  ok;
+    const char*           log;    // errors and warnings of all stages, empty if there are none
+    int                   num_stages;
+    glslcc_stage_output   stages[GLSLCC_MAX_STAGES];     // in the order of glslcc_compile_desc.stages
+    const glslcc_timings* timings;  // NULL without GLSLCC_FLAG_TIMINGS, phases after a failure are 0
+} glslcc_result;
+
+// Initializes glslang, call it once before compiling
+void glslcc_init(void);
+void glslcc_shutdown(void);
+
+// Returns NULL only if allocation fails, check ok and log for compile errors
+// The result and all the data that it points to is a single block from desc->allocator (malloc by default)
+glslcc_result* glslcc_compile(const glslcc_compile_desc* desc);
+
+#ifdef __cplusplus
+}
+#endif
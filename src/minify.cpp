@@ -0,0 +1,244 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+#include "minify.h"
+#include "spirv-module.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unordered_set>
+
+// keywords, reserved words and built-in functions that short names must not collide with
+static const char* k_reserved_names[] = {
+    "asm", "do", "if", "in", "for", "int", "out", "abs", "all", "any", "cos", "dot", "exp", "fma", "log",
+    "max", "min", "mix", "mod", "not", "pow", "sin", "tan", "attribute", "bool", "break", "buffer", "bvec2",
+    "bvec3", "bvec4", "case", "centroid", "class", "coherent", "const", "continue", "default", "discard",
+    "dmat2", "dmat3", "dmat4", "double", "dvec2", "dvec3", "dvec4", "else", "enum", "extern", "external",
+    "false", "fixed", "flat", "float", "filter", "goto", "half", "highp", "inline", "inout", "interface",
+    "invariant", "isampler2D", "isampler3D", "ivec2", "ivec3", "ivec4", "layout", "long", "lowp", "mat2",
+    "mat3", "mat4", "mediump", "namespace", "noinline", "noperspective", "output", "packed", "patch",
+    "precise", "precision", "public", "readonly", "resource", "restrict", "return", "sample", "sampler",
+    "sampler2D", "sampler3D", "samplerCube", "shared", "short", "sizeof", "smooth", "static", "struct",
+    "subroutine", "superp", "switch", "template", "this", "true", "typedef", "uint", "uniform", "union",
+    "unsigned", "using", "usampler2D", "usampler3D", "uvec2", "uvec3", "uvec4", "varying", "vec2", "vec3",
+    "vec4", "void", "volatile", "while", "writeonly", "acos", "acosh", "asin", "asinh", "atan", "atanh",
+    "ceil", "clamp", "cosh", "cross", "dFdx", "dFdy", "degrees", "distance", "exp2", "faceforward",
+    "floor", "fract", "fwidth", "inversesqrt", "isinf", "isnan", "length", "log2", "normalize", "radians",
+    "reflect", "refract", "round", "sign", "sinh", "smoothstep", "sqrt", "step", "tanh", "texture",
+    "trunc", "equal", "lessThan", "greaterThan", "main"
+};
+
+static std::string short_name(uint32_t index)
+{
+    static const char* k_chars = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    std::string name;
+    for (index++; index > 0; index = (index - 1) / 52)
+        name.insert(name.begin(), k_chars[(index - 1) % 52]);
+    return name;
+}
+
+static std::string next_name(uint32_t* counter, const std::unordered_set<std::string>& taken)
+{
+    for (;;) {
+        std::string name = short_name((*counter)++);
+        if (taken.find(name) == taken.end())
+            return name;
+    }
+}
+
+void minify_names(std::vector<uint32_t>& spirv)
+{
+    spv_module m;
+    if (!spv_parse(&m, spirv))
+        return;
+
+    uint32_t bound = m.header[3];
+    std::vector<int> defs(bound, -1);
+    std::vector<uint8_t> entry_funcs(bound, 0);
+    std::vector<uint32_t> stack;
+    for (size_t i = 0; i < m.insts.size(); i++) {
+        const spv_inst& inst = m.insts[i];
+        uint32_t id = spv_result_id(inst);
+        if (id)
+            defs[id] = int(i);
+        if (inst.op() == spv::OpEntryPoint)
+            entry_funcs[inst.w[2]] = 1;
+        else if (inst.op() == spv::OpVariable && inst.w[3] != spv::StorageClassFunction &&
+                 inst.w[3] != spv::StorageClassPrivate) {
+            stack.push_back(inst.w[1]);
+        }
+    }
+
+    // types of the interface variables, struct members of those are visible to the application
+    std::vector<uint8_t> interface_types(bound, 0);
+    while (!stack.empty()) {
+        uint32_t id = stack.back();
+        stack.pop_back();
+        if (interface_types[id] || defs[id] < 0)
+            continue;
+        interface_types[id] = 1;
+
+        const spv_inst& def = m.insts[defs[id]];
+        if (def.op() == spv::OpTypePointer)
+            stack.push_back(def.w[3]);
+        else if (def.op() == spv::OpTypeArray || def.op() == spv::OpTypeRuntimeArray)
+            stack.push_back(def.w[2]);
+        else if (def.op() == spv::OpTypeStruct)
+            stack.insert(stack.end(), def.w.begin() + 2, def.w.end());
+    }
+
+    auto renamable = [&](uint32_t id)->bool {
+        if (id >= bound || defs[id] < 0)
+            return false;
+        const spv_inst& def = m.insts[defs[id]];
+        switch (def.op()) {
+        case spv::OpVariable:
+            return def.w[3] == spv::StorageClassFunction || def.w[3] == spv::StorageClassPrivate;
+        case spv::OpFunction:
+            return !entry_funcs[id];
+        case spv::OpFunctionParameter:
+            return true;
+        case spv::OpTypeStruct:
+            return !interface_types[id];
+        default:
+            return false;
+        }
+    };
+
+    std::unordered_set<std::string> reserved(k_reserved_names, k_reserved_names + sizeof(k_reserved_names)/sizeof(char*));
+    std::unordered_set<std::string> taken(reserved);
+    for (const spv_inst& inst : m.insts) {
+        if (inst.op() == spv::OpName && !renamable(inst.w[1]))
+            taken.insert((const char*)&inst.w[2]);
+    }
+
+    uint32_t counter = 0;
+    uint32_t member_counter = 0;
+    std::vector<std::string> member_names;
+    for (spv_inst& inst : m.insts) {
+        if (inst.op() == spv::OpName && renamable(inst.w[1])) {
+            inst.w.resize(2);
+            spv_append_string(&inst, next_name(&counter, taken).c_str());
+        } else if (inst.op() == spv::OpMemberName && renamable(inst.w[1])) {
+            uint32_t index = inst.w[2];
+            while (member_names.size() <= index)
+                member_names.push_back(next_name(&member_counter, reserved));
+            inst.w.resize(3);
+            spv_append_string(&inst, member_names[index].c_str());
+        }
+    }
+
+    spv_write(m, &spirv);
+}
+
+static bool is_ident_char(char c)
+{
+    return isalnum((unsigned char)c) || c == '_';
+}
+
+// whitespace is only needed where removing it would merge two tokens
+static bool needs_space(char prev, char next)
+{
+    if (is_ident_char(prev))
+        return is_ident_char(next) || next == '.';
+    if (prev == '+' || prev == '-')
+        return next == '+' || next == '-';
+    if (prev == '/')
+        return next == '/' || next == '*';
+    return false;
+}
+
+// float literals are written by SPIRV-Cross with all the digits, use the shortest text that gives the same float
+static const char* minify_number(const char* s, std::string* out)
+{
+    const char* end = s;
+    bool is_float = false;
+    if (end[0] == '0' && (end[1] == 'x' || end[1] == 'X')) {
+        end += 2;
+        while (isxdigit((unsigned char)*end))
+            end++;
+    } else {
+        while (isdigit((unsigned char)*end) || *end == '.') {
+            is_float |= *end == '.';
+            end++;
+        }
+        if ((*end == 'e' || *end == 'E') &&
+            (isdigit((unsigned char)end[1]) || ((end[1] == '-' || end[1] == '+') && isdigit((unsigned char)end[2])))) {
+            is_float = true;
+            end += 2;
+            while (isdigit((unsigned char)*end))
+                end++;
+        }
+    }
+
+    // suffixes (u, lf) are kept as they are
+    if (!is_float || is_ident_char(*end)) {
+        out->append(s, end);
+        return end;
+    }
+
+    float value = strtof(std::string(s, end).c_str(), nullptr);
+    char text[32];
+    for (int digits = 1; digits <= 9; digits++) {
+        snprintf(text, sizeof(text), "%.*g", digits, value);
+        if (strtof(text, nullptr) == value)
+            break;
+    }
+    out->append(text);
+    if (!strpbrk(text, ".eEn"))
+        out->append(".0");
+    return end;
+}
+
+std::string minify_glsl(const std::string& code)
+{
+    std::string out;
+    out.reserve(code.size());
+
+    const char* s = code.c_str();
+    bool line_start = true;
+    bool space = false;
+    while (*s) {
+        if (s[0] == '/' && s[1] == '/') {
+            while (*s && *s != '\n')
+                s++;
+        } else if (s[0] == '/' && s[1] == '*') {
+            const char* end = strstr(s + 2, "*/");
+            s = end ? end + 2 : s + strlen(s);
+            space = true;
+        } else if (isspace((unsigned char)*s)) {
+            line_start |= *s == '\n';
+            space = true;
+            s++;
+        } else if (*s == '#' && line_start) {
+            // preprocessor directives keep their own lines
+            if (!out.empty() && out.back() != '\n')
+                out.push_back('\n');
+            const char* eol = strchr(s, '\n');
+            const char* end = eol ? eol : s + strlen(s);
+            while (end > s && isspace((unsigned char)end[-1]))
+                end--;
+            out.append(s, end);
+            out.push_back('\n');
+            s = eol ? eol : s + strlen(s);
+            space = false;
+        } else {
+            bool token_start = space || out.empty() || !is_ident_char(out.back());
+            if (space && !out.empty() && needs_space(out.back(), *s))
+                out.push_back(' ');
+            if (token_start && isdigit((unsigned char)*s))
+                s = minify_number(s, &out);
+            else
+                out.push_back(*s++);
+            line_start = false;
+            space = false;
+        }
+    }
+
+    if (!out.empty() && out.back() != '\n')
+        out.push_back('\n');
+    return out;
+}
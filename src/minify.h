@@ -0,0 +1,17 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+// GLSL/GLES output minifier
+// Names are shortened on the SPIR-V before cross compiling, so only ids that are invisible to the
+// application are touched: locals, functions, private globals and structs that are not part of the
+// interface. Stage inputs/outputs, uniforms, blocks and their members keep their names for reflection
+//
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+void        minify_names(std::vector<uint32_t>& spirv);
+std::string minify_glsl(const std::string& code);
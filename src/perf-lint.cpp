@@ -0,0 +1,577 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+#include "perf-lint.h"
+#include "precision.h"
+#include "spirv-module.h"
+
+#include <string.h>
+#include <algorithm>
+
+struct lint_block {
+    uint32_t label;
+    int      last;          // instruction index of the terminator
+    uint32_t merge;         // merge block of the OpSelectionMerge/OpLoopMerge of the block, 0 if there is none
+    bool     loop;          // block is a loop header
+    uint32_t func;
+};
+
+struct lint_state {
+    spv_module              m;
+    std::vector<int>        defs;               // instruction index of each id, -1 if it's not defined
+    std::vector<int>        lines;              // source line of each instruction, 0 if it's unknown
+    std::vector<uint32_t>   files;              // OpString of the source file of each instruction
+    std::vector<int>        inst_blocks;        // block of each instruction, -1 outside of functions
+    std::vector<uint32_t>   ptr_vars;           // variable or pointer parameter behind each pointer, 0 if unknown
+    std::vector<uint32_t>   storage;            // storage class of variables
+    std::vector<uint8_t>    nonuniform;         // values that can differ between invocations, and variables
+                                                // that are written with such values
+    std::vector<lint_block> blocks;
+    std::vector<int>        label_blocks;       // block of each label id, -1 if it's not a label
+    std::vector<int>        loops;              // smallest loop header that contains each block, -1 if it's not
+                                                // in a loop
+    std::vector<uint8_t>    nonuniform_blocks;  // blocks that are reached by a part of the invocations
+    std::vector<uint8_t>    nonuniform_merges;  // merge blocks of constructs with non-uniform branches
+    std::vector<uint8_t>    nonuniform_funcs;   // functions that are called from non-uniform control flow
+    int                     first_func;
+};
+
+static bool is_sample_op(spv::Op op)
+{
+    return op >= spv::OpImageSampleImplicitLod && op <= spv::OpImageSampleProjDrefExplicitLod;
+}
+
+// instructions that need the derivatives of neighbouring invocations
+static bool is_derivative_op(spv::Op op)
+{
+    switch (op) {
+    case spv::OpImageSampleImplicitLod:
+    case spv::OpImageSampleDrefImplicitLod:
+    case spv::OpImageSampleProjImplicitLod:
+    case spv::OpImageSampleProjDrefImplicitLod:
+    case spv::OpImageSparseSampleImplicitLod:
+    case spv::OpImageSparseSampleDrefImplicitLod:
+    case spv::OpImageSparseSampleProjImplicitLod:
+    case spv::OpImageSparseSampleProjDrefImplicitLod:
+    case spv::OpImageQueryLod:
+        return true;
+    default:
+        return op >= spv::OpDPdx && op <= spv::OpFwidthCoarse;
+    }
+}
+
+static bool is_terminator(spv::Op op)
+{
+    switch (op) {
+    case spv::OpBranch:
+    case spv::OpBranchConditional:
+    case spv::OpSwitch:
+    case spv::OpReturn:
+    case spv::OpReturnValue:
+    case spv::OpKill:
+    case spv::OpUnreachable:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool is_nonuniform(const lint_state& s, uint32_t id)
+{
+    return id < s.nonuniform.size() && s.nonuniform[id];
+}
+
+static bool mark(std::vector<uint8_t>* v, size_t index)
+{
+    if (index >= v->size() || (*v)[index])
+        return false;
+    (*v)[index] = 1;
+    return true;
+}
+
+static void init_state(lint_state* s)
+{
+    const spv_module& m = s->m;
+    uint32_t bound = m.header[3];
+    s->defs.assign(bound, -1);
+    s->ptr_vars.assign(bound, 0);
+    s->storage.assign(bound, 0);
+    s->nonuniform.assign(bound, 0);
+    s->nonuniform_funcs.assign(bound, 0);
+    s->label_blocks.assign(bound, -1);
+    s->lines.assign(m.insts.size(), 0);
+    s->files.assign(m.insts.size(), 0);
+    s->inst_blocks.assign(m.insts.size(), -1);
+    s->first_func = spv_first_function(m);
+
+    uint32_t file = 0, func = 0;
+    int line = 0, block = -1;
+    for (size_t i = 0; i < m.insts.size(); i++) {
+        const spv_inst& inst = m.insts[i];
+        uint32_t id = spv_result_id(inst);
+        if (id && id < bound)
+            s->defs[id] = int(i);
+
+        switch (inst.op()) {
+        case spv::OpVariable:
+            s->ptr_vars[id] = id;
+            s->storage[id] = inst.w[3];
+            break;
+        case spv::OpFunctionParameter:
+            if (m.insts[spv_find_def(m, inst.w[1])].op() == spv::OpTypePointer) {
+                s->ptr_vars[id] = id;
+                s->storage[id] = spv::StorageClassFunction;
+            }
+            break;
+        case spv::OpAccessChain:
+        case spv::OpInBoundsAccessChain:
+        case spv::OpCopyObject:
+            s->ptr_vars[id] = inst.w[3] < bound ? s->ptr_vars[inst.w[3]] : 0;
+            break;
+        case spv::OpLine:
+            file = inst.w[1];
+            line = int(inst.w[2]);
+            break;
+        case spv::OpNoLine:
+            line = 0;
+            break;
+        case spv::OpFunction:
+            func = id;
+            break;
+        case spv::OpFunctionEnd:
+            block = -1;
+            break;
+        case spv::OpLabel: {
+            lint_block b = { id, int(i), 0, false, func };
+            block = int(s->blocks.size());
+            s->label_blocks[id] = block;
+            s->blocks.push_back(b);
+            break;
+        }
+        case spv::OpSelectionMerge:
+            s->blocks[block].merge = inst.w[1];
+            break;
+        case spv::OpLoopMerge:
+            s->blocks[block].merge = inst.w[1];
+            s->blocks[block].loop = true;
+            break;
+        default:
+            if (block != -1 && is_terminator(inst.op()))
+                s->blocks[block].last = int(i);
+            break;
+        }
+
+        s->lines[i] = line;
+        s->files[i] = file;
+        s->inst_blocks[i] = block;
+    }
+
+    s->nonuniform_blocks.assign(s->blocks.size(), 0);
+    s->nonuniform_merges.assign(s->blocks.size(), 0);
+}
+
+static void get_successors(const lint_state& s, const lint_block& b, std::vector<uint32_t>* labels)
+{
+    const spv_inst& term = s.m.insts[b.last];
+    switch (term.op()) {
+    case spv::OpBranch:
+        labels->push_back(term.w[1]);
+        break;
+    case spv::OpBranchConditional:
+        labels->push_back(term.w[2]);
+        labels->push_back(term.w[3]);
+        break;
+    case spv::OpSwitch:
+        // 32bit selectors: default, then literal/label pairs
+        labels->push_back(term.w[2]);
+        for (size_t i = 4; i < term.w.size(); i += 2)
+            labels->push_back(term.w[i]);
+        break;
+    default:
+        break;
+    }
+}
+
+// blocks that are reachable from the successors of block without passing through stop
+static void get_region(const lint_state& s, int block, uint32_t stop, std::vector<int>* region)
+{
+    std::vector<uint8_t> visited(s.blocks.size(), 0);
+    std::vector<uint32_t> stack;
+    get_successors(s, s.blocks[block], &stack);
+    while (!stack.empty()) {
+        uint32_t label = stack.back();
+        stack.pop_back();
+        int b = label < s.label_blocks.size() ? s.label_blocks[label] : -1;
+        if (label == stop || b == -1 || visited[b])
+            continue;
+        visited[b] = 1;
+        region->push_back(b);
+        get_successors(s, s.blocks[b], &stack);
+    }
+}
+
+// smallest loop that contains each block, loop regions don't change so it's done once before the fixpoint
+static void find_loops(lint_state* s)
+{
+    s->loops.assign(s->blocks.size(), -1);
+    std::vector<size_t> loop_sizes(s->blocks.size(), 0);
+    std::vector<int> region;
+    for (size_t b = 0; b < s->blocks.size(); b++) {
+        if (!s->blocks[b].loop)
+            continue;
+        region.clear();
+        get_region(*s, int(b), s->blocks[b].merge, &region);
+        region.push_back(int(b));
+        for (int r : region) {
+            if (s->loops[r] == -1 || region.size() < loop_sizes[r]) {
+                s->loops[r] = int(b);
+                loop_sizes[r] = region.size();
+            }
+        }
+    }
+}
+
+// marks the blocks that only a part of the invocations reach, returns true if something changed
+static bool find_nonuniform_blocks(lint_state* s)
+{
+    bool changed = false;
+    std::vector<int> region;
+    for (size_t b = 0; b < s->blocks.size(); b++) {
+        const lint_block& blk = s->blocks[b];
+        const spv_inst& term = s->m.insts[blk.last];
+        if ((term.op() != spv::OpBranchConditional && term.op() != spv::OpSwitch) || !is_nonuniform(*s, term.w[1]))
+            continue;
+
+        // branches without a merge exit the loop they are in (break/continue conditions)
+        int header = blk.merge ? int(b) : s->loops[b];
+        if (header == -1)
+            continue;
+
+        region.clear();
+        get_region(*s, header, s->blocks[header].merge, &region);
+        if (s->blocks[header].loop)
+            region.push_back(header);
+        for (int r : region)
+            changed |= mark(&s->nonuniform_blocks, r);
+
+        int merge = s->label_blocks[s->blocks[header].merge];
+        if (merge != -1)
+            changed |= mark(&s->nonuniform_merges, merge);
+    }
+
+    for (size_t b = 0; b < s->blocks.size(); b++) {
+        if (s->nonuniform_funcs[s->blocks[b].func])
+            changed |= mark(&s->nonuniform_blocks, b);
+    }
+    return changed;
+}
+
+// propagates non-uniform values through instructions, variables and function calls until nothing changes
+static void find_nonuniform_values(lint_state* s)
+{
+    const spv_module& m = s->m;
+    find_loops(s);
+
+    bool changed = true;
+    while (changed) {
+        changed = find_nonuniform_blocks(s);
+        for (size_t i = s->first_func; i < m.insts.size(); i++) {
+            const spv_inst& inst = m.insts[i];
+            uint32_t id = spv_result_id(inst);
+            int block = s->inst_blocks[i];
+            bool divergent = block != -1 && s->nonuniform_blocks[block];
+            bool taint = false;
+
+            switch (inst.op()) {
+            case spv::OpStore: {
+                uint32_t var = s->ptr_vars[inst.w[1]];
+                if (var && (is_nonuniform(*s, inst.w[2]) || is_nonuniform(*s, inst.w[1]) || divergent))
+                    changed |= mark(&s->nonuniform, var);
+                continue;
+            }
+            case spv::OpLoad: {
+                uint32_t var = s->ptr_vars[inst.w[3]];
+                taint = is_nonuniform(*s, inst.w[3]) ||
+                        (var && (is_nonuniform(*s, var) || s->storage[var] == spv::StorageClassInput));
+                break;
+            }
+            case spv::OpVariable:
+                if (inst.w.size() > 4 && is_nonuniform(*s, inst.w[4]))
+                    changed |= mark(&s->nonuniform, id);
+                continue;
+            case spv::OpFunctionParameter:
+                continue;
+            case spv::OpFunctionCall: {
+                uint32_t func = inst.w[3];
+                int param = s->defs[func] + 1;
+                for (size_t k = 4; k < inst.w.size() && m.insts[param].op() == spv::OpFunctionParameter; k++, param++) {
+                    uint32_t arg = inst.w[k], param_id = m.insts[param].w[2];
+                    uint32_t var = s->ptr_vars[arg];
+                    if (var) {
+                        // pointers go both ways, the callee can write to the variable of the caller
+                        if (is_nonuniform(*s, var))
+                            changed |= mark(&s->nonuniform, param_id);
+                        if (is_nonuniform(*s, param_id))
+                            changed |= mark(&s->nonuniform, var);
+                    } else if (is_nonuniform(*s, arg)) {
+                        changed |= mark(&s->nonuniform, param_id);
+                    }
+                }
+                if (divergent)
+                    changed |= mark(&s->nonuniform_funcs, func);
+                taint = is_nonuniform(*s, func);
+                break;
+            }
+            case spv::OpReturnValue:
+                // functions with non-uniform return values are marked by their id
+                if (is_nonuniform(*s, inst.w[1]) || divergent)
+                    changed |= mark(&s->nonuniform, s->blocks[block].func);
+                continue;
+            case spv::OpPhi:
+                taint = s->nonuniform_merges[block] != 0;
+                for (size_t k = 3; k < inst.w.size(); k += 2)
+                    taint |= is_nonuniform(*s, inst.w[k]);
+                break;
+            case spv::OpCompositeExtract:
+                taint = is_nonuniform(*s, inst.w[3]);
+                break;
+            case spv::OpVectorShuffle:
+            case spv::OpCompositeInsert:
+                taint = is_nonuniform(*s, inst.w[3]) || is_nonuniform(*s, inst.w[4]);
+                break;
+            default: {
+                if (!id)
+                    continue;
+                bool has_result, has_type;
+                spv::HasResultAndType(inst.op(), &has_result, &has_type);
+                size_t start = inst.op() == spv::OpExtInst ? 5 : 1 + (has_result ? 1 : 0) + (has_type ? 1 : 0);
+                for (size_t k = start; k < inst.w.size(); k++)
+                    taint |= is_nonuniform(*s, inst.w[k]);
+                break;
+            }
+            }
+
+            if (id && taint)
+                changed |= mark(&s->nonuniform, id);
+        }
+    }
+}
+
+static std::string get_name(const spv_module& m, uint32_t id)
+{
+    for (const spv_inst& inst : m.insts) {
+        if (inst.op() == spv::OpName && inst.w[1] == id)
+            return std::string((const char*)&inst.w[2]);
+    }
+    return std::string();
+}
+
+static std::string get_member_name(const spv_module& m, uint32_t struct_id, uint32_t index)
+{
+    for (const spv_inst& inst : m.insts) {
+        if (inst.op() == spv::OpMemberName && inst.w[1] == struct_id && inst.w[2] == index)
+            return std::string((const char*)&inst.w[3]);
+    }
+    return std::string();
+}
+
+static bool is_constant(const lint_state& s, uint32_t id)
+{
+    int def = id < s.defs.size() ? s.defs[id] : -1;
+    if (def == -1)
+        return false;
+    spv::Op op = s.m.insts[def].op();
+    return op == spv::OpConstant || op == spv::OpSpecConstant || op == spv::OpConstantNull;
+}
+
+static void add_message(const lint_state& s, size_t inst, const std::string& text,
+                        std::vector<perf_lint_message>* messages)
+{
+    perf_lint_message msg;
+    uint32_t file = s.files[inst];
+    int def = file < s.defs.size() ? s.defs[file] : -1;
+    if (def != -1 && s.m.insts[def].op() == spv::OpString)
+        msg.file = (const char*)&s.m.insts[def].w[2];
+    msg.line = s.lines[inst];
+    msg.text = text;
+    messages->push_back(msg);
+}
+
+// value is a stage input that is only copied around, through function variables and parameters
+static bool is_unmodified_input(const lint_state& s, uint32_t value, int depth = 0)
+{
+    int def = value < s.defs.size() ? s.defs[value] : -1;
+    if (def == -1 || s.m.insts[def].op() != spv::OpLoad || depth > 8)
+        return false;
+    uint32_t ptr = s.m.insts[def].w[3];
+    uint32_t var = s.ptr_vars[ptr];
+    if (!var || var != ptr)
+        return false;
+    if (s.storage[var] == spv::StorageClassInput)
+        return true;
+    if (s.storage[var] != spv::StorageClassFunction)
+        return false;
+
+    // all the values that are written to the variable, or passed to the parameter
+    bool is_param = s.m.insts[s.defs[var]].op() == spv::OpFunctionParameter;
+    uint32_t func = 0, index = 0;
+    if (is_param) {
+        int first = s.defs[var];
+        while (s.m.insts[first - 1].op() == spv::OpFunctionParameter)
+            first--;
+        func = s.m.insts[first - 1].w[2];
+        index = uint32_t(s.defs[var] - first);
+    }
+
+    int num_sources = 0;
+    for (size_t i = s.first_func; i < s.m.insts.size(); i++) {
+        const spv_inst& inst = s.m.insts[i];
+        if (inst.op() == spv::OpStore && s.ptr_vars[inst.w[1]] == var) {
+            if (inst.w[1] != var || !is_unmodified_input(s, inst.w[2], depth + 1))
+                return false;
+            num_sources++;
+        } else if (is_param && inst.op() == spv::OpFunctionCall && inst.w[3] == func && 4 + index < inst.w.size()) {
+            uint32_t arg_var = s.ptr_vars[inst.w[4 + index]];
+            if (!arg_var)
+                return false;
+            for (size_t k = s.first_func; k < s.m.insts.size(); k++) {
+                const spv_inst& store = s.m.insts[k];
+                if (store.op() == spv::OpStore && s.ptr_vars[store.w[1]] == arg_var) {
+                    if (store.w[1] != arg_var || !is_unmodified_input(s, store.w[2], depth + 1))
+                        return false;
+                    num_sources++;
+                }
+            }
+        }
+    }
+    return num_sources > 0;
+}
+
+// coordinates that are loaded directly from a stage input can be fetched before the fragment shader runs
+static void check_dependent_textures(const lint_state& s, std::vector<perf_lint_message>* messages)
+{
+    for (size_t i = s.first_func; i < s.m.insts.size(); i++) {
+        const spv_inst& inst = s.m.insts[i];
+        if (is_sample_op(inst.op()) && !is_unmodified_input(s, inst.w[4]))
+            add_message(s, i, "dependent texture read, coordinates that are not an unmodified varying can't be prefetched", messages);
+    }
+}
+
+// uniform arrays with dynamic indices are read from memory instead of constant registers
+static void check_dynamic_uniform_indices(const lint_state& s, std::vector<perf_lint_message>* messages)
+{
+    for (size_t i = s.first_func; i < s.m.insts.size(); i++) {
+        const spv_inst& inst = s.m.insts[i];
+        if (inst.op() != spv::OpAccessChain && inst.op() != spv::OpInBoundsAccessChain)
+            continue;
+        uint32_t var = s.ptr_vars[inst.w[3]];
+        uint32_t storage = var ? s.storage[var] : 0;
+        if (!var || inst.w[3] != var ||
+            (storage != spv::StorageClassUniform && storage != spv::StorageClassUniformConstant &&
+             storage != spv::StorageClassPushConstant)) {
+            continue;
+        }
+
+        uint32_t type_id = s.m.insts[spv_find_def(s.m, s.m.insts[s.defs[var]].w[1])].w[3];
+        bool block = spv_decoration(s.m, type_id, spv::DecorationBlock);
+        if (spv_decoration(s.m, type_id, spv::DecorationBufferBlock))
+            continue;
+
+        for (size_t k = 4; k < inst.w.size(); k++) {
+            if (is_constant(s, inst.w[k]))
+                continue;
+
+            std::string name;
+            if (block && k > 4 && is_constant(s, inst.w[4]))
+                name = get_member_name(s.m, type_id, s.m.insts[s.defs[inst.w[4]]].w[3]);
+            if (name.empty())
+                name = get_name(s.m, var);
+            add_message(s, i, "dynamic index into uniform '" + name + "', it's read from memory instead of constant registers", messages);
+            break;
+        }
+    }
+}
+
+static void check_discards(const lint_state& s, std::vector<perf_lint_message>* messages)
+{
+    for (size_t i = s.first_func; i < s.m.insts.size(); i++) {
+        spv::Op op = s.m.insts[i].op();
+        if (op == spv::OpKill || op == spv::OpDemoteToHelperInvocationEXT)
+            add_message(s, i, "discard disables early depth test and hidden surface removal, use a separate variant for opaque materials", messages);
+    }
+}
+
+static void check_derivatives(const lint_state& s, std::vector<perf_lint_message>* messages)
+{
+    for (size_t i = s.first_func; i < s.m.insts.size(); i++) {
+        const spv_inst& inst = s.m.insts[i];
+        int block = s.inst_blocks[i];
+        if (!is_derivative_op(inst.op()) || block == -1 || !s.nonuniform_blocks[block])
+            continue;
+        if (inst.op() >= spv::OpDPdx && inst.op() <= spv::OpFwidthCoarse)
+            add_message(s, i, "derivative in non-uniform control flow, move it out of the branch", messages);
+        else
+            add_message(s, i, "implicit lod texture sample in non-uniform control flow, use textureLod/textureGrad or move it out of the branch", messages);
+    }
+}
+
+// variables that the mediump inference relaxes, but are declared (or defaulted to) highp
+static void check_highp(const lint_state& s, const std::vector<uint32_t>& spirv, std::vector<perf_lint_message>* messages)
+{
+    std::vector<uint32_t> relaxed_spirv = spirv;
+    precision_report report;
+    spv_module relaxed;
+    if (!precision_relax(relaxed_spirv, std::vector<std::string>(), &report) || report.names.empty() || !spv_parse(&relaxed, relaxed_spirv))
+        return;
+
+    for (const spv_inst& inst : relaxed.insts) {
+        if (inst.op() != spv::OpDecorate || inst.w[2] != spv::DecorationRelaxedPrecision)
+            continue;
+        uint32_t var = inst.w[1];
+        int def = var < s.defs.size() ? s.defs[var] : -1;
+        if (def == -1 || s.m.insts[def].op() != spv::OpVariable ||
+            spv_decoration(s.m, var, spv::DecorationRelaxedPrecision)) {
+            continue;
+        }
+        std::string name = get_name(s.m, var);
+        if (name.empty())
+            continue;
+
+        // point to the first assignment, declarations of function variables have no line
+        size_t line_inst = size_t(def);
+        for (size_t i = s.first_func; i < s.m.insts.size(); i++) {
+            if (s.m.insts[i].op() == spv::OpStore && s.ptr_vars[s.m.insts[i].w[1]] == var && s.lines[i]) {
+                line_inst = i;
+                break;
+            }
+        }
+        add_message(s, line_inst, "'" + name + "' is highp, mediump keeps enough precision for it", messages);
+    }
+}
+
+bool perf_lint(const std::vector<uint32_t>& spirv, uint32_t checks, std::vector<perf_lint_message>* messages)
+{
+    lint_state s;
+    if (!spv_parse(&s.m, spirv))
+        return false;
+    init_state(&s);
+
+    if (checks & PERF_LINT_DEPENDENT_TEXTURE)
+        check_dependent_textures(s, messages);
+    if (checks & PERF_LINT_DYNAMIC_UNIFORM_INDEX)
+        check_dynamic_uniform_indices(s, messages);
+    if (checks & PERF_LINT_DISCARD)
+        check_discards(s, messages);
+    if (checks & PERF_LINT_DERIVATIVE) {
+        find_nonuniform_values(&s);
+        check_derivatives(s, messages);
+    }
+    if (checks & PERF_LINT_HIGHP)
+        check_highp(s, spirv, messages);
+
+    std::stable_sort(messages->begin(), messages->end(), [](const perf_lint_message& a, const perf_lint_message& b) {
+        return a.file != b.file ? a.file < b.file : a.line < b.line;
+    });
+    return true;
+}
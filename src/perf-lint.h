@@ -0,0 +1,30 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+// Performance lint: flags code patterns that are slow on tile-based (mobile) GPUs
+// Runs on SPIR-V that is generated with OpLine debug info, so messages point to the source lines
+//
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+enum perf_lint_check {
+    PERF_LINT_DEPENDENT_TEXTURE = 0x1,      // texture coordinates that are not an unmodified varying (GLES2)
+    PERF_LINT_DYNAMIC_UNIFORM_INDEX = 0x2,  // non-constant indices into uniform arrays
+    PERF_LINT_DISCARD = 0x4,                // discard, disables early depth and hidden surface removal
+    PERF_LINT_DERIVATIVE = 0x8,             // derivatives and implicit lod samples in non-uniform control flow
+    PERF_LINT_HIGHP = 0x10                  // variables that the mediump inference can relax
+};
+
+struct perf_lint_message {
+    std::string file;       // source file of the line (OpLine), empty if the module has no debug info
+    int         line;
+    std::string text;
+};
+
+// checks is a combination of perf_lint_check flags, messages are sorted by file and line
+// Returns false if the module can't be parsed
+bool perf_lint(const std::vector<uint32_t>& spirv, uint32_t checks, std::vector<perf_lint_message>* messages);
@@ -0,0 +1,822 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+#include "pipeline.h"
+
+#include "sx/string.h"
+#include "sx/timer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "SPIRV/GlslangToSpv.h"
+
+#include "spirv_hlsl.hpp"
+#include "spirv_msl.hpp"
+
+#include "config.h"
+#include "minify.h"
+#include "sgs-file.h"
+#include "varyings.h"
+
+static const int k_default_version = 100;    // 110 for desktop
+
+static const spec_type_mapping k_spec_type_map[] = {
+    { spirv_cross::SPIRType::Boolean, "bool", SGS_SPECTYPE_BOOL },
+    { spirv_cross::SPIRType::Int, "int", SGS_SPECTYPE_INT },
+    { spirv_cross::SPIRType::UInt, "uint", SGS_SPECTYPE_UINT },
+    { spirv_cross::SPIRType::Float, "float", SGS_SPECTYPE_FLOAT }
+};
+
+static bool is_gl(const pipeline_options& opts)
+{
+    return opts.lang == GLSLCC_LANG_GLES || opts.lang == GLSLCC_LANG_GLSL;
+}
+
+static const pipeline_define* find_define(const std::vector<pipeline_define>& defines, const char* name)
+{
+    for (const pipeline_define& d : defines) {
+        if (sx_strequal(d.name, name))
+            return &d;
+    }
+    return nullptr;
+}
+
+int pipeline_default_profile(glslcc_lang lang)
+{
+    switch (lang) {
+    case GLSLCC_LANG_GLES:
+        return 200;
+    case GLSLCC_LANG_HLSL:
+        return 50;    // D3D11
+    case GLSLCC_LANG_GLSL:
+        return 330;
+    default:
+        return 0;
+    }
+}
+
+// constant_id is the index in the list, so all stages share the ids
+// the default value comes from the entry itself or the define with the same name: 0 if it's not defined,
+// 1 if it's defined without a value, true/false or an integer otherwise
+bool pipeline_spec_define_decl(const pipeline_options& opts, int index, std::string* decl)
+{
+    const pipeline_define& sd = opts.spec_defines[index];
+    const char* type = sd.type ? sd.type : "int";
+    if (!sx_strequal(type, "int") && !sx_strequal(type, "bool"))
+        return false;
+
+    const char* val = sd.value;
+    if (!val) {
+        const pipeline_define* d = find_define(opts.defines, sd.name);
+        val = d ? (d->value ? d->value : "1") : "0";
+    }
+
+    char* end;
+    long n = strtol(val, &end, 0);
+    if (sx_strequal(val, "true"))
+        n = 1;
+    else if (sx_strequal(val, "false"))
+        n = 0;
+    else if (end == val || *end)
+        return false;
+
+    char line[256];
+    if (sx_strequal(type, "bool"))
+        sx_snprintf(line, sizeof(line), "layout(constant_id = %d) const bool %s = %s;\n", index, sd.name, n ? "true" : "false");
+    else
+        sx_snprintf(line, sizeof(line), "layout(constant_id = %d) const int %s = %d;\n", index, sd.name, (int)n);
+    *decl = line;
+    return true;
+}
+
+void pipeline_get_preamble(const pipeline_options& opts, pipeline_preamble* pre)
+{
+    // Always set include_directive in the preamble, because we may need to include shaders
+    pre->text = "#extension GL_GOOGLE_include_directive : require\n";
+
+    // semantics mapping defines, to be used in layout(location = SEMANTIC) inside GLSL
+    pre->text += get_semantic_defines();
+
+    if (opts.lang == GLSLCC_LANG_GLES && opts.profile_ver == 200)
+        pre->text += "#define flat\n";
+
+    pre->processes.clear();
+    for (const pipeline_define& d : opts.defines) {
+        if (find_define(opts.spec_defines, d.name))
+            continue;
+        pre->text += "#define " + std::string(d.name);
+        if (d.value)
+            pre->text += std::string(" ") + std::string(d.value);
+        pre->text += "\n";
+        pre->processes.push_back(std::string("D") + d.name);
+    }
+
+    for (int i = 0; i < (int)opts.spec_defines.size(); i++) {
+        std::string decl;
+        if (pipeline_spec_define_decl(opts, i, &decl))
+            pre->text += decl;
+    }
+}
+
+void pipeline_setup_shader(const pipeline_options& opts, const pipeline_preamble& pre, const pipeline_source& src,
+                           glslang::TShader* shader)
+{
+    shader->setStringsWithLengthsAndNames(&src.source, &src.size, &src.filename, 1);
+    shader->setInvertY(opts.invert_y);
+    shader->setEnvInput(glslang::EShSourceGlsl, src.stage, glslang::EShClientVulkan, k_default_version);
+    shader->setEnvClient(glslang::EShClientVulkan, glslang::EShTargetVulkan_1_1);
+    shader->setEnvTarget(glslang::EShTargetSpv, glslang::EShTargetSpv_1_0);
+    shader->setPreamble(pre.text.c_str());
+    shader->addProcesses(pre.processes);
+
+    // bindings are mapped by glslang's iomapper after linking, bases are applied to the SPIR-V
+    shader->setAutoMapBindings(opts.auto_bind);
+}
+
+bool pipeline_parse(const pipeline_options& opts, glslang::TShader* shader, glslang::TShader::Includer& includer,
+                    std::string* preprocessed)
+{
+    uint64_t t = sx_tm_now();
+    bool r;
+    if (preprocessed) {
+        r = shader->preprocess(opts.limits, k_default_version, ENoProfile, false, false, EShMsgDefault,
+                               preprocessed, includer);
+    } else {
+        r = shader->parse(opts.limits, k_default_version, false, EShMsgDefault, includer);
+    }
+    if (opts.timings)
+        opts.timings->parse += sx_tm_since(t);
+    return r;
+}
+
+// spec values are matched by constant name or constant_id
+static bool spec_value_matches(const pipeline_define& d, const std::string& name, uint32_t constant_id)
+{
+    char* end;
+    unsigned long id = strtoul(d.name, &end, 10);
+    return name == d.name || (end != d.name && !*end && id == constant_id);
+}
+
+// entries that match no constant in any stage of the program are most likely typos
+static void check_spec_values(const pipeline_options& opts, const std::vector<std::vector<uint32_t>>& spirvs,
+                              std::string* log)
+{
+    std::vector<bool> matched(opts.spec_values.size(), false);
+    for (const std::vector<uint32_t>& spirv : spirvs) {
+        spirv_cross::Compiler compiler(spirv);
+        for (auto& sc : compiler.get_specialization_constants()) {
+            for (size_t i = 0; i < opts.spec_values.size(); i++) {
+                if (spec_value_matches(opts.spec_values[i], compiler.get_name(sc.id), sc.constant_id))
+                    matched[i] = true;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < opts.spec_values.size(); i++) {
+        if (!matched[i]) {
+            *log += std::string("Warning: --specialize '") + opts.spec_values[i].name +
+                    "' does not match any specialization constant\n";
+        }
+    }
+}
+
+// lints the SPIR-V of the stage with line info, so it's generated again from the intermediate
+static void lint_stage(const pipeline_options& opts, const glslang::TIntermediate& intermediate, EShLanguage stage,
+                       std::vector<perf_lint_message>* messages)
+{
+    std::vector<uint32_t> spirv;
+    glslang::SpvOptions spv_opts;
+    spv_opts.generateDebugInfo = true;
+    spv::SpvBuildLogger logger;
+    glslang::GlslangToSpv(intermediate, spirv, &logger, &spv_opts);
+
+    // dependent reads only stall GLES2 class hardware, later GPUs don't prefetch varyings
+    uint32_t checks = PERF_LINT_DYNAMIC_UNIFORM_INDEX;
+    if (stage == EShLangFragment) {
+        checks |= PERF_LINT_DISCARD | PERF_LINT_DERIVATIVE;
+        if (opts.lang == GLSLCC_LANG_GLES && opts.profile_ver < 300)
+            checks |= PERF_LINT_DEPENDENT_TEXTURE;
+    }
+    if (opts.lang == GLSLCC_LANG_GLES)
+        checks |= PERF_LINT_HIGHP;
+
+    perf_lint(spirv, checks, messages);
+}
+
+bool pipeline_link(const pipeline_options& opts, glslang::TProgram* prog, const std::vector<EShLanguage>& stages,
+                   std::vector<std::vector<uint32_t>>* spirvs, pipeline_program* program, std::string* log)
+{
+    program->linked = false;
+    program->split_bindings.next = 0;
+    program->split_bindings.parts.clear();
+    program->lint.clear();
+
+    uint64_t t = sx_tm_now();
+    if (!prog->link(EShMsgDefault)) {
+        *log += std::string("Link failed: \n") + prog->getInfoLog() + prog->getInfoDebugLog();
+        return false;
+    }
+
+    if (opts.auto_bind && !prog->mapIO()) {
+        *log += std::string("Mapping bindings failed: \n") + prog->getInfoLog();
+        return false;
+    }
+    if (opts.timings)
+        opts.timings->link += sx_tm_since(t);
+
+    // Generate SPIR-V for each shader
+    t = sx_tm_now();
+    int num_stages = (int)stages.size();
+    spirvs->resize(num_stages);
+    for (int i = 0; i < num_stages; i++) {
+        if (!(*spirvs)[i].empty())
+            continue;
+
+        glslang::SpvOptions spv_opts;
+        spv_opts.validate = true;
+        spv::SpvBuildLogger logger;
+        sx_assert(prog->getIntermediate(stages[i]));
+
+        glslang::GlslangToSpv(*prog->getIntermediate(stages[i]), (*spirvs)[i], &logger, &spv_opts);
+        std::string messages = logger.getAllMessages();
+        if (!messages.empty())
+            *log += messages.back() == '\n' ? messages : messages + "\n";
+    }
+    if (opts.timings)
+        opts.timings->spirv += sx_tm_since(t);
+
+    if (!opts.spec_values.empty())
+        check_spec_values(opts, *spirvs, log);
+
+    // lint the stages as they are written, before the optimization passes
+    if (opts.perf_lint) {
+        program->lint.resize(num_stages);
+        for (int i = 0; i < num_stages; i++)
+            lint_stage(opts, *prog->getIntermediate(stages[i]), stages[i], &program->lint[i]);
+    }
+
+    return true;
+}
+
+void pipeline_program_passes(const pipeline_options& opts, const std::vector<EShLanguage>& stages,
+                             std::vector<std::vector<uint32_t>>* spirvs, pipeline_program* program, std::string* log)
+{
+    uint64_t t = sx_tm_now();
+    int num_stages = (int)stages.size();
+
+    // Optimize varyings between vertex and fragment stages
+    if (opts.link_varyings || opts.pack_varyings) {
+        int vs_index = -1, fs_index = -1;
+        for (int i = 0; i < num_stages; i++) {
+            if (stages[i] == EShLangVertex)
+                vs_index = i;
+            else if (stages[i] == EShLangFragment)
+                fs_index = i;
+        }
+
+        if (vs_index != -1 && fs_index != -1) {
+            program->linked = varyings_link((*spirvs)[vs_index], (*spirvs)[fs_index], opts.pack_varyings);
+            if (!program->linked)
+                *log += "Warning: varyings are not linked, vertex/fragment interface is not supported\n";
+        }
+    }
+
+    // GL shares the binding namespaces between stages, D3D and Metal have separate slots for each stage
+    // read-only storage buffers of HLSL take the bases of textures (t registers), writable ones of images (u)
+    bool hlsl = opts.lang == GLSLCC_LANG_HLSL;
+    if (opts.auto_bind) {
+        if (is_gl(opts)) {
+            std::vector<std::vector<uint32_t>*> all;
+            for (int i = 0; i < num_stages; i++)
+                all.push_back(&(*spirvs)[i]);
+            bindings_compact(all, opts.bind_bases, hlsl);
+        } else {
+            for (int i = 0; i < num_stages; i++)
+                bindings_compact({ &(*spirvs)[i] }, opts.bind_bases, hlsl);
+        }
+    } else if (opts.shift_bindings) {
+        for (int i = 0; i < num_stages; i++)
+            bindings_shift({ &(*spirvs)[i] }, opts.bind_bases, hlsl);
+    }
+
+    // split parts get bindings that no block of the program uses
+    if (opts.split_ubos) {
+        for (int i = 0; i < num_stages; i++)
+            ubo_reserve_bindings((*spirvs)[i], &program->split_bindings);
+    }
+
+    if (opts.timings)
+        opts.timings->passes += sx_tm_since(t);
+}
+
+// the constants stay overridable, but backends without specialization (HLSL, GLSL) get the values folded in
+static void specialize_constants(const pipeline_options& opts, spirv_cross::Compiler* compiler)
+{
+    for (auto& sc : compiler->get_specialization_constants()) {
+        const spec_type_mapping* type = resolve_spec_type(*compiler, sc);
+        if (!type)
+            continue;
+
+        const std::string& name = compiler->get_name(sc.id);
+        for (const pipeline_define& d : opts.spec_values) {
+            if (!spec_value_matches(d, name, sc.constant_id))
+                continue;
+
+            spirv_cross::SPIRConstant& c = compiler->get_constant(sc.id);
+            const char* val = d.value ? d.value : "1";
+            switch (type->base_type) {
+            case spirv_cross::SPIRType::Boolean:
+                c.m.c[0].r[0].u32 = (sx_strequal(val, "true") || strtol(val, nullptr, 0) != 0) ? 1 : 0;
+                break;
+            case spirv_cross::SPIRType::Int:
+                c.m.c[0].r[0].i32 = (int32_t)strtol(val, nullptr, 0);
+                break;
+            case spirv_cross::SPIRType::UInt:
+                c.m.c[0].r[0].u32 = (uint32_t)strtoul(val, nullptr, 0);
+                break;
+            default:
+                c.m.c[0].r[0].f32 = strtof(val, nullptr);
+                break;
+            }
+        }
+    }
+}
+
+// builds a combined sampler for each image/sampler pair that the shader uses, named <image>_<sampler> or
+// <image> for images without a sampler
+// the pairs are sorted by the bindings of their image and sampler and take the texture units after the
+// combined samplers of the source, so the engine can bake sampler states per texture unit
+static void combine_image_samplers(spirv_cross::CompilerGLSL* compiler, spirv_cross::ShaderResources* ress,
+                                   std::unordered_set<spirv_cross::VariableID>* active)
+{
+    compiler->build_dummy_sampler_for_combined_images();
+    compiler->build_combined_image_samplers();
+    spirv_cross::SmallVector<spirv_cross::CombinedImageSampler> combined = compiler->get_combined_image_samplers();
+    if (combined.empty())
+        return;
+
+    uint32_t unit = 0;
+    for (auto& res : ress->sampled_images) {
+        const spirv_cross::SPIRType& type = compiler->get_type(res.type_id);
+        uint32_t count = 1;
+        for (auto arr : type.array)
+            count *= arr;
+        unit = sx_max(unit, (uint32_t)sx_max(get_binding(*compiler, res.id), 0) + count);
+    }
+
+    std::sort(combined.begin(), combined.end(),
+              [compiler](const spirv_cross::CombinedImageSampler& a, const spirv_cross::CombinedImageSampler& b) {
+        int ai = get_binding(*compiler, a.image_id), bi = get_binding(*compiler, b.image_id);
+        if (ai != bi)
+            return ai < bi;
+        int as = get_binding(*compiler, a.sampler_id), bs = get_binding(*compiler, b.sampler_id);
+        if (as != bs)
+            return as < bs;
+        return compiler->get_name(a.image_id) + compiler->get_name(a.sampler_id) <
+               compiler->get_name(b.image_id) + compiler->get_name(b.sampler_id);
+    });
+
+    for (auto& c : combined) {
+        std::string name = compiler->get_name(c.image_id);
+        if (!is_dummy_sampler(*compiler, c.sampler_id))
+            name += "_" + compiler->get_name(c.sampler_id);
+        compiler->set_name(c.combined_id, name);
+        compiler->set_decoration(c.combined_id, spv::DecorationDescriptorSet,
+                                 compiler->get_decoration(c.image_id, spv::DecorationDescriptorSet));
+        compiler->set_decoration(c.combined_id, spv::DecorationBinding, unit);
+
+        const spirv_cross::SPIRType& type = compiler->get_type_from_variable(c.combined_id);
+        uint32_t count = 1;
+        for (auto arr : type.array)
+            count *= arr;
+        unit += count;
+    }
+
+    // the separate images and samplers are not emitted anymore, the combined ones are reflected as textures
+    if (active) {
+        for (auto& c : combined)
+            active->insert(c.combined_id);
+        compiler->set_enabled_interface_variables(*active);
+        *ress = compiler->get_shader_resources(*active);
+    } else {
+        *ress = compiler->get_shader_resources();
+    }
+
+    auto is_combined = [&combined](const spirv_cross::Resource& res) {
+        for (auto& c : combined) {
+            if (c.image_id == res.id || c.sampler_id == res.id)
+                return true;
+        }
+        return false;
+    };
+    ress->separate_images.erase(std::remove_if(ress->separate_images.begin(), ress->separate_images.end(), is_combined),
+                                ress->separate_images.end());
+    ress->separate_samplers.erase(std::remove_if(ress->separate_samplers.begin(), ress->separate_samplers.end(), is_combined),
+                                  ress->separate_samplers.end());
+}
+
+// workgroup size is checked with the other shader limits
+static void check_compute_limits(const compute_info& info, const char* filename, std::string* log)
+{
+    char msg[256];
+    uint32_t invocations = info.workgroup_size[0] * info.workgroup_size[1] * info.workgroup_size[2];
+    if (invocations > k_max_compute_invocations) {
+        sx_snprintf(msg, sizeof(msg), "Warning: %s: workgroup has %u invocations, the limit is %u\n", filename,
+                    invocations, k_max_compute_invocations);
+        *log += msg;
+    }
+    if (info.shared_memory_size > k_max_compute_shared_memory_size) {
+        sx_snprintf(msg, sizeof(msg), "Warning: %s: shared memory is %u bytes, the limit is %u\n", filename,
+                    info.shared_memory_size, k_max_compute_shared_memory_size);
+        *log += msg;
+    }
+}
+
+static int get_array_count(const spirv_cross::Compiler& compiler, const spirv_cross::SPIRType& type)
+{
+    int count = 1;
+    for (uint32_t i = 0; i < (uint32_t)type.array.size(); i++) {
+        uint32_t size = type.array_size_literal[i] ? type.array[i] : compiler.get_constant(type.array[i]).scalar();
+        count *= sx_max((int)size, 1);
+    }
+    return count;
+}
+
+// number of locations (vec4 slots) of a stage input/output
+static int get_location_count(const spirv_cross::Compiler& compiler, const spirv_cross::SPIRType& type)
+{
+    int count = 0;
+    if (type.basetype == spirv_cross::SPIRType::Struct) {
+        for (uint32_t member_type : type.member_types)
+            count += get_location_count(compiler, compiler.get_type(member_type));
+    } else {
+        count = type.columns;
+    }
+    return count * get_array_count(compiler, type);
+}
+
+static int get_location_count(const spirv_cross::Compiler& compiler,
+                              const spirv_cross::SmallVector<spirv_cross::Resource>& ress)
+{
+    int count = 0;
+    for (auto& res : ress)
+        count += get_location_count(compiler, compiler.get_type(res.type_id));
+    return count;
+}
+
+// rows of each width (components) that the varyings of a type take, arrays and matrix columns are one row each
+static void get_varying_rows(const spirv_cross::Compiler& compiler, const spirv_cross::SPIRType& type, int rows[5])
+{
+    int count = get_array_count(compiler, type);
+    if (type.basetype == spirv_cross::SPIRType::Struct) {
+        for (int i = 0; i < count; i++) {
+            for (uint32_t member_type : type.member_types)
+                get_varying_rows(compiler, compiler.get_type(member_type), rows);
+        }
+    } else {
+        rows[sx_min<int>(type.vecsize, 4)] += type.columns * count;
+    }
+}
+
+// number of vectors of varyings packed with the rules of the GLSL ES spec (appendix A.7): vec4s take whole rows,
+// vec3s take 3 columns of a row, vec2s are paired and floats fill the free columns before they take new rows
+static int get_packed_varying_count(const spirv_cross::Compiler& compiler,
+                                    const spirv_cross::SmallVector<spirv_cross::Resource>& ress)
+{
+    int rows[5] = {};
+    for (auto& res : ress)
+        get_varying_rows(compiler, compiler.get_type(res.type_id), rows);
+
+    int vec2_rows = (rows[2] + 1) / 2;
+    int free_columns = rows[3] + (rows[2] & 1) * 2;
+    int float_rows = (sx_max(rows[1] - free_columns, 0) + 3) / 4;
+    return rows[4] + rows[3] + vec2_rows + float_rows;
+}
+
+static int get_binding_count(const spirv_cross::Compiler& compiler,
+                             const spirv_cross::SmallVector<spirv_cross::Resource>& ress)
+{
+    int count = 0;
+    for (auto& res : ress)
+        count += get_array_count(compiler, compiler.get_type(res.type_id));
+    return count;
+}
+
+// usage of the limits that apply to the stage, uniforms are counted in vec4s
+static void get_limit_usage(const pipeline_options& opts, const spirv_cross::Compiler& compiler,
+                            const spirv_cross::ShaderResources& ress, EShLanguage stage, const compute_info* cs,
+                            std::vector<limit_usage>* usage)
+{
+    const TBuiltInResource& conf = *opts.limits;
+    int uniform_vectors = 0;
+    for (auto& ubo : ress.uniform_buffers) {
+        int size = (int)compiler.get_declared_struct_size(compiler.get_type(ubo.base_type_id));
+        uniform_vectors += (size + 15) / 16 * get_array_count(compiler, compiler.get_type(ubo.type_id));
+    }
+    int textures = get_binding_count(compiler, ress.sampled_images) + get_binding_count(compiler, ress.separate_images);
+    int images = get_binding_count(compiler, ress.storage_images);
+    int inputs = get_location_count(compiler, ress.stage_inputs);
+    int outputs = get_location_count(compiler, ress.stage_outputs);
+    bool es = opts.lang == GLSLCC_LANG_GLES;
+
+    // GLES drivers pack varyings, so MaxVaryingVectors is checked against the packed vectors
+    int varyings = 0;
+    if (es)
+        varyings = get_packed_varying_count(compiler, stage == EShLangVertex ? ress.stage_outputs : ress.stage_inputs);
+
+    switch (stage) {
+    case EShLangVertex:
+        usage->push_back({ "MaxVertexAttribs", inputs, conf.maxVertexAttribs, false });
+        if (es)
+            usage->push_back({ "MaxVaryingVectors", varyings, conf.maxVaryingVectors, false });
+        else
+            usage->push_back({ "MaxVertexOutputVectors", outputs, conf.maxVertexOutputVectors, false });
+        usage->push_back({ "MaxVertexUniformVectors", uniform_vectors, conf.maxVertexUniformVectors, false });
+        usage->push_back({ "MaxVertexTextureImageUnits", textures, conf.maxVertexTextureImageUnits, false });
+        usage->push_back({ "MaxVertexImageUniforms", images, conf.maxVertexImageUniforms, false });
+        break;
+    case EShLangFragment:
+        if (es)
+            usage->push_back({ "MaxVaryingVectors", varyings, conf.maxVaryingVectors, false });
+        else
+            usage->push_back({ "MaxFragmentInputVectors", inputs, conf.maxFragmentInputVectors, false });
+        usage->push_back({ "MaxFragmentUniformVectors", uniform_vectors, conf.maxFragmentUniformVectors, false });
+        usage->push_back({ "MaxTextureImageUnits", textures, conf.maxTextureImageUnits, false });
+        usage->push_back({ "MaxFragmentImageUniforms", images, conf.maxFragmentImageUniforms, false });
+        usage->push_back({ "MaxDrawBuffers", outputs, conf.maxDrawBuffers, false });
+        break;
+    case EShLangCompute:
+        usage->push_back({ "MaxComputeUniformComponents", uniform_vectors * 4, conf.maxComputeUniformComponents, false });
+        usage->push_back({ "MaxComputeTextureImageUnits", textures, conf.maxComputeTextureImageUnits, false });
+        usage->push_back({ "MaxComputeImageUniforms", images, conf.maxComputeImageUniforms, false });
+        if (cs) {
+            usage->push_back({ "MaxComputeWorkGroupSizeX", (int)cs->workgroup_size[0], conf.maxComputeWorkGroupSizeX, true });
+            usage->push_back({ "MaxComputeWorkGroupSizeY", (int)cs->workgroup_size[1], conf.maxComputeWorkGroupSizeY, true });
+            usage->push_back({ "MaxComputeWorkGroupSizeZ", (int)cs->workgroup_size[2], conf.maxComputeWorkGroupSizeZ, true });
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+static bool cross_compile(const pipeline_options& opts, std::vector<uint32_t>& spirv, const char* filename,
+                          pipeline_stage* out, std::string* log)
+{
+    sx_assert(!spirv.empty());
+
+    // names are shortened in SPIR-V, so reflection still sees the original interface names
+    bool minify = opts.minify && is_gl(opts);
+    if (minify)
+        minify_names(spirv);
+
+    try {
+        std::unique_ptr<spirv_cross::CompilerGLSL>& compiler = out->compiler;
+        // Use spirv-cross to convert to other types of shader
+        if (is_gl(opts))
+            compiler = std::unique_ptr<spirv_cross::CompilerGLSL>(new spirv_cross::CompilerGLSL(spirv));
+        else if (opts.lang == GLSLCC_LANG_MSL)
+            compiler = std::unique_ptr<spirv_cross::CompilerMSL>(new spirv_cross::CompilerMSL(spirv));
+        else
+            compiler = std::unique_ptr<spirv_cross::CompilerHLSL>(new spirv_cross::CompilerHLSL(spirv));
+
+        if (!opts.spec_values.empty())
+            specialize_constants(opts, compiler.get());
+
+        spirv_cross::ShaderResources& ress = out->ress;
+        std::unordered_set<spirv_cross::VariableID> active;
+        if (opts.strip_unused) {
+            // only keep the resources that the entry point actually uses, stage outputs are always kept
+            // so they still match the inputs of the next stage
+            active = compiler->get_active_interface_variables();
+            for (auto& res : compiler->get_shader_resources().stage_outputs)
+                active.insert(res.id);
+            ress = compiler->get_shader_resources(active);
+            compiler->set_enabled_interface_variables(active);
+        } else {
+            ress = compiler->get_shader_resources();
+        }
+
+        const compute_info* cs = nullptr;
+        if (out->stage == EShLangCompute) {
+            get_compute_info(*compiler, spirv, &out->cs);
+            check_compute_limits(out->cs, filename, log);
+            cs = &out->cs;
+        }
+
+        // GL has no separate samplers
+        if (opts.combine_samplers && is_gl(opts))
+            combine_image_samplers(compiler.get(), &ress, opts.strip_unused ? &active : nullptr);
+
+        get_limit_usage(opts, *compiler, ress, out->stage, cs, &out->limits);
+
+        spirv_cross::CompilerGLSL::Options glsl_opts = compiler->get_common_options();
+        glsl_opts.flatten_multidimensional_arrays = true;
+        if (opts.lang == GLSLCC_LANG_GLES) {
+            glsl_opts.es = true;
+            glsl_opts.version = opts.profile_ver;
+        } else if (opts.lang == GLSLCC_LANG_GLSL) {
+            glsl_opts.enable_420pack_extension = false;
+            glsl_opts.es = false;
+            glsl_opts.version = opts.profile_ver;
+        } else if (opts.lang == GLSLCC_LANG_HLSL) {
+            spirv_cross::CompilerHLSL* hlsl = (spirv_cross::CompilerHLSL*)compiler.get();
+            spirv_cross::CompilerHLSL::Options hlsl_opts = hlsl->get_hlsl_options();
+
+            hlsl_opts.shader_model = opts.profile_ver;
+            hlsl_opts.point_size_compat = true;
+            hlsl_opts.point_coord_compat = true;
+
+            hlsl->set_hlsl_options(hlsl_opts);
+
+            uint32_t new_builtin = hlsl->remap_num_workgroups_builtin();
+            if (new_builtin) {
+                hlsl->set_decoration(new_builtin, spv::DecorationDescriptorSet, 0);
+                hlsl->set_decoration(new_builtin, spv::DecorationBinding, 0);
+            }
+
+            for (int i = 0; i < VERTEX_ATTRIB_COUNT; i++) {
+                spirv_cross::HLSLVertexAttributeRemap remap = { (uint32_t)i, k_attrib_names[i] };
+                hlsl->add_vertex_attribute_remap(remap);
+            }
+        } else if (opts.lang == GLSLCC_LANG_MSL) {
+            spirv_cross::CompilerMSL* msl = (spirv_cross::CompilerMSL*)compiler.get();
+            spirv_cross::CompilerMSL::Options msl_opts = msl->get_msl_options();
+
+            // profile 12 = MSL 1.2, specialization constants are emitted as function constants since 1.2
+            if (opts.profile_ver)
+                msl_opts.set_msl_version(opts.profile_ver / 10, opts.profile_ver % 10);
+            if (!opts.spec_defines.empty() && !msl_opts.supports_msl_version(1, 2))
+                *log += "Warning: function constants need MSL 1.2, spec defines are emitted as macros\n";
+
+            // resources of each descriptor set are packed in an argument buffer, bound to [[buffer(set)]]
+            if (opts.msl_argument_buffers) {
+                if (!msl_opts.supports_msl_version(2))
+                    msl_opts.set_msl_version(2);
+                msl_opts.argument_buffers = true;
+            }
+
+            msl->set_msl_options(msl_opts);
+        }
+        compiler->set_common_options(glsl_opts);
+
+        // Flatten ubos
+        if (opts.flatten_ubos) {
+            for (auto& ubo : ress.uniform_buffers)
+                compiler->flatten_buffer_block(ubo.id);
+            for (auto& ubo : ress.push_constant_buffers)
+                compiler->flatten_buffer_block(ubo.id);
+        }
+
+        // Metal vertex inputs are sequential, the original locations are restored for reflection
+        std::vector<int> old_locs;
+        if (opts.lang == GLSLCC_LANG_MSL && out->stage == EShLangVertex) {
+            for (size_t i = 0; i < ress.stage_inputs.size(); i++) {
+                spirv_cross::ID id = ress.stage_inputs[i].id;
+                if (compiler->has_decoration(id, spv::DecorationLocation)) {
+                    old_locs.push_back((int)compiler->get_decoration(id, spv::DecorationLocation));
+                    compiler->set_decoration(id, spv::DecorationLocation, (uint32_t)i);
+                } else {
+                    old_locs.push_back(-1);
+                }
+            }
+        }
+
+        out->code = compiler->compile();
+        if (minify)
+            out->code = minify_glsl(out->code);
+
+        for (size_t i = 0; i < old_locs.size(); i++) {
+            if (old_locs[i] != -1)
+                compiler->set_decoration(ress.stage_inputs[i].id, spv::DecorationLocation, (uint32_t)old_locs[i]);
+        }
+        return true;
+    } catch (const std::exception& e) {
+        *log += std::string("SPIRV-cross: ") + e.what() + "\n";
+        return false;
+    }
+}
+
+bool pipeline_compile_stage(const pipeline_options& opts, pipeline_program* program, EShLanguage stage,
+                            std::vector<uint32_t>& spirv, const char* filename, pipeline_stage* out,
+                            std::string* log)
+{
+    out->stage = stage;
+    out->relaxed = false;
+    out->has_stats = false;
+    sx_memset(&out->cs, 0x0, sizeof(out->cs));
+
+    uint64_t t = sx_tm_now();
+    // other languages ignore RelaxedPrecision
+    if (opts.infer_mediump && opts.lang == GLSLCC_LANG_GLES)
+        out->relaxed = precision_relax(spirv, opts.unorm_textures, &out->precision);
+
+    if (opts.pack_ubos)
+        ubo_optimize_layout(spirv, &out->ubo_layouts);
+
+    if (opts.split_ubos)
+        ubo_split_by_frequency(spirv, &program->split_bindings, &out->ubo_splits);
+
+    if (opts.stats)
+        out->has_stats = stats_gather(spirv, &out->stats);
+
+    if (opts.timings) {
+        opts.timings->passes += sx_tm_since(t);
+        t = sx_tm_now();
+    }
+
+    bool r = cross_compile(opts, spirv, filename, out, log);
+    if (opts.timings)
+        opts.timings->cross += sx_tm_since(t);
+    return r;
+}
+
+const spec_type_mapping* resolve_spec_type(const spirv_cross::Compiler& compiler,
+                                           const spirv_cross::SpecializationConstant& sc)
+{
+    const spirv_cross::SPIRConstant& c = compiler.get_constant(sc.id);
+    const spirv_cross::SPIRType& type = compiler.get_type(c.constant_type);
+    if (type.vecsize != 1 || type.columns != 1 || !type.array.empty())
+        return nullptr;
+
+    int count = sizeof(k_spec_type_map) / sizeof(spec_type_mapping);
+    for (int i = 0; i < count; i++) {
+        if (k_spec_type_map[i].base_type == type.basetype)
+            return &k_spec_type_map[i];
+    }
+    return nullptr;
+}
+
+int get_binding(const spirv_cross::Compiler& compiler, spirv_cross::VariableID id)
+{
+    return compiler.has_decoration(id, spv::DecorationBinding) ? (int)compiler.get_decoration(id, spv::DecorationBinding) : -1;
+}
+
+bool is_dummy_sampler(const spirv_cross::Compiler& compiler, spirv_cross::VariableID id)
+{
+    return !compiler.has_decoration(id, spv::DecorationBinding);
+}
+
+// gathers argument buffer members after compile() has assigned the [[id(n)]] indices, sorted by set and id
+void get_msl_arguments(const spirv_cross::CompilerMSL& msl, const spirv_cross::ShaderResources& ress,
+    std::vector<msl_argument>* margs)
+{
+    auto add_args = [&](const spirv_cross::SmallVector<spirv_cross::Resource>& list, uint32_t kind,
+                        const char* kind_str) {
+        for (auto& res : list) {
+            uint32_t id = msl.get_automatic_msl_resource_binding(res.id);
+            if (id == ~0u)
+                continue;   // not used by the entry point
+
+            const spirv_cross::SPIRType& type = msl.get_type(res.type_id);
+            msl_argument a;
+            a.name = res.name;
+            a.set = msl.get_decoration(res.id, spv::DecorationDescriptorSet);
+            a.id = id;
+            a.offset = 0;
+            a.kind = kind;
+            a.kind_str = kind_str;
+            a.binding = msl.get_decoration_bitset(res.id).get(spv::DecorationBinding) ?
+                (int32_t)msl.get_decoration(res.id, spv::DecorationBinding) : -1;
+            a.array_size = 1;
+            for (auto arr : type.array)
+                a.array_size *= sx_max(arr, 1u);
+            margs->push_back(a);
+
+            // combined image samplers are split into a texture and a sampler member
+            uint32_t sampler_id = msl.get_automatic_msl_resource_binding_secondary(res.id);
+            if (kind == SGS_ARGKIND_TEXTURE && sampler_id != ~0u) {
+                a.name += "Smplr";
+                a.id = sampler_id;
+                a.kind = SGS_ARGKIND_SAMPLER;
+                a.kind_str = "sampler";
+                margs->push_back(a);
+            }
+        }
+    };
+
+    add_args(ress.uniform_buffers, SGS_ARGKIND_UNIFORM_BUFFER, "uniform_buffer");
+    add_args(ress.storage_buffers, SGS_ARGKIND_STORAGE_BUFFER, "storage_buffer");
+    add_args(ress.sampled_images, SGS_ARGKIND_TEXTURE, "texture");
+    add_args(ress.separate_images, SGS_ARGKIND_TEXTURE, "texture");
+    add_args(ress.storage_images, SGS_ARGKIND_STORAGE_IMAGE, "storage_image");
+    add_args(ress.separate_samplers, SGS_ARGKIND_SAMPLER, "sampler");
+
+    std::sort(margs->begin(), margs->end(), [](const msl_argument& a, const msl_argument& b) {
+        return a.set != b.set ? a.set < b.set : a.id < b.id;
+    });
+
+    uint32_t offset = 0;
+    for (size_t i = 0; i < margs->size(); i++) {
+        msl_argument& a = (*margs)[i];
+        if (i > 0 && a.set != (*margs)[i - 1].set)
+            offset = 0;
+        a.offset = offset;
+        offset += 8 * a.array_size;
+    }
+}
@@ -0,0 +1,184 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+// Compile pipeline that is shared by the command line and libglslcc: preamble of the sources, link and SPIR-V
+// generation, the SPIR-V passes and cross compiling. Front ends parse the stages with their own includers and add
+// their outputs (files, SGS, reflection) from the cross compiled stages
+//
+// Usage:
+//      pipeline_preamble pre;
+//      pipeline_get_preamble(opts, &pre);
+//      foreach stage: pipeline_setup_shader(opts, pre, src, shader), pipeline_parse(opts, shader, includer)
+//      pipeline_link(opts, &prog, stages, &spirvs, &program, &log)
+//      pipeline_program_passes(opts, stages, &spirvs, &program, &log)
+//      foreach stage: pipeline_compile_stage(opts, &program, stage, spirv, filename, &out, &log)
+//
+// Warnings and errors that are not tied to a source line are appended to the log, one per line
+//
+#pragma once
+
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "glslang/Public/ShaderLang.h"
+#include "spirv_glsl.hpp"
+
+#include "bindings.h"
+#include "libglslcc.h"
+#include "perf-lint.h"
+#include "precision.h"
+#include "reflect.h"
+#include "stats.h"
+#include "ubo-layout.h"
+
+namespace spirv_cross {
+class CompilerMSL;
+}
+
+struct pipeline_define {
+    const char* name;
+    const char* value;      // can be null
+    const char* type;       // spec defines only: "int" (null) or "bool"
+};
+
+// time spent in each phase, in sx_tm ticks, summed over the stages of the program
+struct pipeline_timings {
+    uint64_t parse;     // includes preprocess and includes
+    uint64_t link;
+    uint64_t spirv;
+    uint64_t passes;    // SPIR-V passes of glslcc: varyings, bindings, precision, uniform blocks, stats
+    uint64_t cross;     // SPIRV-Cross compile and reflection
+};
+
+// same as the command line flags with the same names
+struct pipeline_options {
+    glslcc_lang                  lang;
+    int                          profile_ver;       // pipeline_default_profile if it's not set
+    const TBuiltInResource*      limits;
+    std::vector<pipeline_define> defines;
+    std::vector<pipeline_define> spec_defines;      // declared as specialization constants instead of macros
+    std::vector<pipeline_define> spec_values;       // name or constant_id = value
+    std::vector<std::string>     unorm_textures;
+    uint32_t                     bind_bases[BINDING_CLASS_COUNT];
+    bool                         shift_bindings;    // applies bind_bases without auto_bind
+    bool                         invert_y;
+    bool                         flatten_ubos;
+    bool                         strip_unused;
+    bool                         link_varyings;
+    bool                         pack_varyings;
+    bool                         infer_mediump;
+    bool                         minify;
+    bool                         pack_ubos;
+    bool                         split_ubos;
+    bool                         auto_bind;
+    bool                         combine_samplers;
+    bool                         msl_argument_buffers;
+    bool                         perf_lint;
+    bool                         stats;
+    pipeline_timings*            timings;           // optional, each phase adds its time to it
+};
+
+struct pipeline_preamble {
+    std::string              text;
+    std::vector<std::string> processes;
+};
+
+struct pipeline_source {
+    EShLanguage stage;
+    const char* filename;
+    const char* source;
+    int         size;
+};
+
+// state of the program that the stages share
+struct pipeline_program {
+    bool                                        linked;     // varyings of the vertex/fragment stages are linked
+    ubo_split_bindings                          split_bindings;
+    std::vector<std::vector<perf_lint_message>> lint;       // perf_lint: messages of each stage
+};
+
+struct limit_usage {
+    const char* name;       // name in the limits file
+    int         used;
+    int         limit;
+    bool        warn;       // also checked with the default limits, as a warning
+};
+
+// cross compiled stage, the compiler holds the reflection of the output
+struct pipeline_stage {
+    EShLanguage                                 stage;
+    std::unique_ptr<spirv_cross::CompilerGLSL>  compiler;
+    spirv_cross::ShaderResources                ress;
+    std::string                                 code;
+    compute_info                                cs;                 // compute only
+    bool                                        relaxed;            // infer_mediump relaxed some values
+    precision_report                            precision;
+    std::vector<ubo_layout_report>              ubo_layouts;        // pack_ubos
+    std::vector<ubo_split_part>                 ubo_splits;         // split_ubos, parts are reflected as blocks
+    bool                                        has_stats;
+    shader_stats                                stats;
+    std::vector<limit_usage>                    limits;             // usage of the limits that apply to the stage
+};
+
+// member of a Metal argument buffer
+struct msl_argument {
+    std::string name;
+    uint32_t set;
+    uint32_t id;            // [[id(n)]]
+    uint32_t offset;        // byte offset for direct encoding, 8 bytes per resource
+    uint32_t kind;
+    const char* kind_str;
+    int32_t binding;
+    uint32_t array_size;
+};
+
+struct spec_type_mapping {
+    spirv_cross::SPIRType::BaseType base_type;
+    const char* type_str;
+    uint32_t fourcc;
+};
+
+int pipeline_default_profile(glslcc_lang lang);
+
+// Returns false if the spec define is not NAME[:int] with an integer value or NAME:bool with a bool value
+bool pipeline_spec_define_decl(const pipeline_options& opts, int index, std::string* decl);
+
+void pipeline_get_preamble(const pipeline_options& opts, pipeline_preamble* pre);
+
+// src and pre are referenced by the shader until it's parsed
+void pipeline_setup_shader(const pipeline_options& opts, const pipeline_preamble& pre, const pipeline_source& src,
+                           glslang::TShader* shader);
+
+// only preprocesses the source if preprocessed is set
+bool pipeline_parse(const pipeline_options& opts, glslang::TShader* shader, glslang::TShader::Includer& includer,
+                    std::string* preprocessed = nullptr);
+
+// Links the program and generates SPIR-V for the stages that don't have it, so front ends can pass the SPIR-V of
+// stages that are not changed since the last compile
+bool pipeline_link(const pipeline_options& opts, glslang::TProgram* prog, const std::vector<EShLanguage>& stages,
+                   std::vector<std::vector<uint32_t>>* spirvs, pipeline_program* program, std::string* log);
+
+// Passes that need all stages of the program: varyings and bindings
+void pipeline_program_passes(const pipeline_options& opts, const std::vector<EShLanguage>& stages,
+                             std::vector<std::vector<uint32_t>>* spirvs, pipeline_program* program, std::string* log);
+
+// Optimizes the SPIR-V of the stage and cross compiles it
+bool pipeline_compile_stage(const pipeline_options& opts, pipeline_program* program, EShLanguage stage,
+                            std::vector<uint32_t>& spirv, const char* filename, pipeline_stage* out,
+                            std::string* log);
+
+// only scalar specialization constants can be set by the application, composites are built from them
+const spec_type_mapping* resolve_spec_type(const spirv_cross::Compiler& compiler,
+                                           const spirv_cross::SpecializationConstant& sc);
+
+int get_binding(const spirv_cross::Compiler& compiler, spirv_cross::VariableID id);
+
+// images that are used without a sampler are combined with a dummy sampler, which has no binding
+bool is_dummy_sampler(const spirv_cross::Compiler& compiler, spirv_cross::VariableID id);
+
+// gathers argument buffer members after compile() has assigned the [[id(n)]] indices, sorted by set and id
+void get_msl_arguments(const spirv_cross::CompilerMSL& msl, const spirv_cross::ShaderResources& ress,
+    std::vector<msl_argument>* margs);
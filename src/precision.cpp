@@ -0,0 +1,631 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+#include "precision.h"
+#include "spirv-module.h"
+
+#include "SPIRV/GLSL.std.450.h"
+
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+
+// values within this range keep enough precision in mediump (fp16) for color math
+static const float k_relaxed_limit = 2.0f;
+
+// ranges that still grow after this many passes (accumulators in loops) are given up on
+static const int k_widen_iterations = 8;
+
+struct value_range {
+    float lo;
+    float hi;
+};
+
+static const value_range k_range_full = { -INFINITY, INFINITY };
+static const value_range k_range_unorm = { 0.0f, 1.0f };
+static const value_range k_range_snorm = { -1.0f, 1.0f };
+
+struct precision_state {
+    spv_module               m;
+    std::vector<int>         defs;          // instruction index of each id, -1 if it's not defined
+    std::vector<uint8_t>     float_types;   // 32bit float scalar/vector types
+    std::vector<uint8_t>     is_float;      // value has a float type
+    std::vector<value_range> ranges;        // ranges of float values and tracked variables
+    std::vector<uint8_t>     known;         // range is evaluated, values that aren't stay unknown in loops
+    std::vector<uint32_t>    ptr_vars;      // tracked variable behind each pointer, 0 if not tracked
+    std::vector<uint8_t>     escaped;       // tracked variable is passed around as a pointer
+    std::vector<uint8_t>     sensitive;     // value needs full precision
+    std::vector<uint8_t>     unorm_vars;    // texture variables that hold normalized data
+    uint32_t                 glsl_ext;
+    int                      first_func;
+};
+
+static value_range range_hull(value_range a, value_range b)
+{
+    return { std::min(a.lo, b.lo), std::max(a.hi, b.hi) };
+}
+
+static value_range range_mul(value_range a, value_range b)
+{
+    float c[4] = { a.lo * b.lo, a.lo * b.hi, a.hi * b.lo, a.hi * b.hi };
+    value_range r = { c[0], c[0] };
+    for (int i = 0; i < 4; i++) {
+        // 0 * inf
+        if (isnan(c[i]))
+            return k_range_full;
+        r.lo = std::min(r.lo, c[i]);
+        r.hi = std::max(r.hi, c[i]);
+    }
+    return r;
+}
+
+static bool range_within(value_range r, float limit)
+{
+    return r.lo >= -limit && r.hi <= limit;
+}
+
+static bool range_equal(value_range a, value_range b)
+{
+    return a.lo == b.lo && a.hi == b.hi;
+}
+
+static bool get_range(const precision_state& s, uint32_t id, value_range* r)
+{
+    if (id < s.is_float.size() && s.is_float[id]) {
+        if (!s.known[id])
+            return false;
+        *r = s.ranges[id];
+    } else {
+        *r = k_range_full;
+    }
+    return true;
+}
+
+static bool update_range(precision_state* s, uint32_t id, value_range r, int iteration)
+{
+    if (!s->known[id]) {
+        s->ranges[id] = r;
+        s->known[id] = 1;
+        return true;
+    }
+
+    value_range hull = range_hull(s->ranges[id], r);
+    if (range_equal(hull, s->ranges[id]))
+        return false;
+    s->ranges[id] = iteration >= k_widen_iterations ? k_range_full : hull;
+    return true;
+}
+
+// non-depth float textures that are listed as unorm, sampled images are traced back to their variables
+static bool is_unorm_texture(const precision_state& s, uint32_t id)
+{
+    int def = s.defs[id];
+    if (def < 0)
+        return false;
+    int type = s.defs[s.m.insts[def].w[1]];
+    if (type >= 0 && s.m.insts[type].op() == spv::OpTypeSampledImage)
+        type = s.defs[s.m.insts[type].w[2]];
+    if (type < 0 || s.m.insts[type].op() != spv::OpTypeImage)
+        return false;
+
+    const spv_inst& image = s.m.insts[type];
+    if (!s.float_types[image.w[2]] || image.w[3] == spv::DimBuffer || image.w[3] == spv::DimSubpassData ||
+        image.w[4] == 1) {
+        return false;
+    }
+
+    for (int depth = 0; depth < 8 && def >= 0; depth++) {
+        const spv_inst& inst = s.m.insts[def];
+        switch (inst.op()) {
+        case spv::OpVariable:
+            return s.unorm_vars[inst.w[2]] != 0;
+        case spv::OpSampledImage:
+        case spv::OpLoad:
+        case spv::OpAccessChain:
+        case spv::OpInBoundsAccessChain:
+        case spv::OpCopyObject:
+            def = s.defs[inst.w[3]];
+            break;
+        default:
+            return false;
+        }
+    }
+    return false;
+}
+
+static bool eval_glsl_std(const precision_state& s, const spv_inst& inst, value_range* r)
+{
+    value_range a[3];
+    for (size_t i = 5; i < inst.w.size() && i < 8; i++) {
+        if (!get_range(s, inst.w[i], &a[i - 5]))
+            return false;
+    }
+
+    switch (inst.w[4]) {
+    case GLSLstd450FAbs: {
+        float lo = fabsf(a[0].lo), hi = fabsf(a[0].hi);
+        *r = { (a[0].lo <= 0 && a[0].hi >= 0) ? 0 : std::min(lo, hi), std::max(lo, hi) };
+        break;
+    }
+    case GLSLstd450Floor:
+    case GLSLstd450Ceil:
+    case GLSLstd450Round:
+    case GLSLstd450RoundEven:
+    case GLSLstd450Trunc:
+        *r = { floorf(a[0].lo), ceilf(a[0].hi) };
+        break;
+    case GLSLstd450FSign:
+    case GLSLstd450Sin:
+    case GLSLstd450Cos:
+    case GLSLstd450Normalize:
+        *r = k_range_snorm;
+        break;
+    case GLSLstd450Fract:
+    case GLSLstd450Step:
+    case GLSLstd450SmoothStep:
+        *r = k_range_unorm;
+        break;
+    case GLSLstd450Sqrt:
+        *r = a[0].lo >= 0 ? value_range{ sqrtf(a[0].lo), sqrtf(a[0].hi) } : k_range_full;
+        break;
+    case GLSLstd450Pow:
+        *r = (a[0].lo >= 0 && a[0].hi <= 1.0f && a[1].lo >= 0) ? k_range_unorm : k_range_full;
+        break;
+    case GLSLstd450FMin:
+    case GLSLstd450NMin:
+        *r = { std::min(a[0].lo, a[1].lo), std::min(a[0].hi, a[1].hi) };
+        break;
+    case GLSLstd450FMax:
+    case GLSLstd450NMax:
+        *r = { std::max(a[0].lo, a[1].lo), std::max(a[0].hi, a[1].hi) };
+        break;
+    case GLSLstd450FClamp:
+    case GLSLstd450NClamp: {
+        // min(max(x, lo), hi)
+        value_range t = { std::max(a[0].lo, a[1].lo), std::max(a[0].hi, a[1].hi) };
+        *r = { std::min(t.lo, a[2].lo), std::min(t.hi, a[2].hi) };
+        break;
+    }
+    case GLSLstd450FMix:
+        *r = (a[2].lo >= 0 && a[2].hi <= 1.0f) ? range_hull(a[0], a[1]) : k_range_full;
+        break;
+    default:
+        *r = k_range_full;
+        break;
+    }
+    return true;
+}
+
+// returns false if any of the operands is not evaluated yet
+static bool eval_range(const precision_state& s, const spv_inst& inst, value_range* r)
+{
+    value_range a, b;
+    switch (inst.op()) {
+    case spv::OpLoad: {
+        uint32_t var = s.ptr_vars[inst.w[3]];
+        if (!var) {
+            *r = k_range_full;
+            return true;
+        }
+        if (!s.known[var])
+            return false;
+        *r = s.ranges[var];
+        return true;
+    }
+    case spv::OpCopyObject:
+    case spv::OpCompositeExtract:
+        return get_range(s, inst.w[3], r);
+    case spv::OpFNegate:
+        if (!get_range(s, inst.w[3], &a))
+            return false;
+        *r = { -a.hi, -a.lo };
+        return true;
+    case spv::OpFAdd:
+        if (!get_range(s, inst.w[3], &a) || !get_range(s, inst.w[4], &b))
+            return false;
+        *r = { a.lo + b.lo, a.hi + b.hi };
+        return true;
+    case spv::OpFSub:
+        if (!get_range(s, inst.w[3], &a) || !get_range(s, inst.w[4], &b))
+            return false;
+        *r = { a.lo - b.hi, a.hi - b.lo };
+        return true;
+    case spv::OpFMul:
+    case spv::OpVectorTimesScalar:
+        if (!get_range(s, inst.w[3], &a) || !get_range(s, inst.w[4], &b))
+            return false;
+        *r = range_mul(a, b);
+        return true;
+    case spv::OpDot: {
+        if (!get_range(s, inst.w[3], &a) || !get_range(s, inst.w[4], &b))
+            return false;
+        const spv_inst& type = s.m.insts[s.defs[s.m.insts[s.defs[inst.w[3]]].w[1]]];
+        *r = range_mul(range_mul(a, b), value_range{ 0, float(type.w[3]) });
+        return true;
+    }
+    case spv::OpCompositeInsert:
+    case spv::OpVectorShuffle:
+        if (!get_range(s, inst.w[3], &a) || !get_range(s, inst.w[4], &b))
+            return false;
+        *r = range_hull(a, b);
+        return true;
+    case spv::OpSelect:
+        if (!get_range(s, inst.w[4], &a) || !get_range(s, inst.w[5], &b))
+            return false;
+        *r = range_hull(a, b);
+        return true;
+    case spv::OpCompositeConstruct:
+        if (!get_range(s, inst.w[3], r))
+            return false;
+        for (size_t i = 4; i < inst.w.size(); i++) {
+            if (!get_range(s, inst.w[i], &a))
+                return false;
+            *r = range_hull(*r, a);
+        }
+        return true;
+    case spv::OpPhi: {
+        // values coming from loop back-edges are not evaluated in the first pass
+        bool any = false;
+        for (size_t i = 3; i < inst.w.size(); i += 2) {
+            if (get_range(s, inst.w[i], &a)) {
+                *r = any ? range_hull(*r, a) : a;
+                any = true;
+            }
+        }
+        return any;
+    }
+    case spv::OpExtInst:
+        if (inst.w[3] != s.glsl_ext) {
+            *r = k_range_full;
+            return true;
+        }
+        return eval_glsl_std(s, inst, r);
+    case spv::OpImageSampleDrefImplicitLod:
+    case spv::OpImageSampleDrefExplicitLod:
+    case spv::OpImageSampleProjDrefImplicitLod:
+    case spv::OpImageSampleProjDrefExplicitLod:
+    case spv::OpImageDrefGather:
+        *r = k_range_unorm;
+        return true;
+    case spv::OpImageSampleImplicitLod:
+    case spv::OpImageSampleExplicitLod:
+    case spv::OpImageSampleProjImplicitLod:
+    case spv::OpImageSampleProjExplicitLod:
+    case spv::OpImageFetch:
+    case spv::OpImageGather:
+        *r = is_unorm_texture(s, inst.w[3]) ? k_range_unorm : k_range_full;
+        return true;
+    default:
+        *r = k_range_full;
+        return true;
+    }
+}
+
+// index of the image operands mask of image instructions, 0 for other instructions
+static size_t image_operands_index(spv::Op op)
+{
+    switch (op) {
+    case spv::OpImageWrite:
+        return 4;
+    case spv::OpImageSampleImplicitLod:
+    case spv::OpImageSampleExplicitLod:
+    case spv::OpImageSampleProjImplicitLod:
+    case spv::OpImageSampleProjExplicitLod:
+    case spv::OpImageFetch:
+    case spv::OpImageRead:
+    case spv::OpImageSparseSampleImplicitLod:
+    case spv::OpImageSparseSampleExplicitLod:
+    case spv::OpImageSparseSampleProjImplicitLod:
+    case spv::OpImageSparseSampleProjExplicitLod:
+    case spv::OpImageSparseFetch:
+    case spv::OpImageSparseRead:
+        return 5;
+    case spv::OpImageSampleDrefImplicitLod:
+    case spv::OpImageSampleDrefExplicitLod:
+    case spv::OpImageSampleProjDrefImplicitLod:
+    case spv::OpImageSampleProjDrefExplicitLod:
+    case spv::OpImageGather:
+    case spv::OpImageDrefGather:
+    case spv::OpImageSparseSampleDrefImplicitLod:
+    case spv::OpImageSparseSampleDrefExplicitLod:
+    case spv::OpImageSparseSampleProjDrefImplicitLod:
+    case spv::OpImageSparseSampleProjDrefExplicitLod:
+    case spv::OpImageSparseGather:
+    case spv::OpImageSparseDrefGather:
+        return 6;
+    default:
+        return 0;
+    }
+}
+
+// operand words that are literals and not ids: image operand masks, composite indices and shuffle components
+static bool is_literal_operand(const spv_inst& inst, size_t index)
+{
+    switch (inst.op()) {
+    case spv::OpCompositeExtract:
+        return index >= 4;
+    case spv::OpCompositeInsert:
+    case spv::OpVectorShuffle:
+        return index >= 5;
+    case spv::OpExtInst:
+        return index == 4;
+    default:
+        return index == image_operands_index(inst.op());
+    }
+}
+
+static void mark_operands(precision_state* s, const spv_inst& inst, size_t first)
+{
+    for (size_t i = first; i < inst.w.size(); i++) {
+        if (inst.w[i] < s->sensitive.size() && !is_literal_operand(inst, i))
+            s->sensitive[inst.w[i]] = 1;
+    }
+}
+
+static void setup_values(precision_state* s, const std::vector<std::string>& unorm_textures)
+{
+    spv_module& m = s->m;
+    uint32_t bound = m.header[3];
+    s->defs.assign(bound, -1);
+    s->float_types.assign(bound, 0);
+    s->is_float.assign(bound, 0);
+    s->ranges.assign(bound, k_range_full);
+    s->known.assign(bound, 0);
+    s->ptr_vars.assign(bound, 0);
+    s->escaped.assign(bound, 0);
+    s->sensitive.assign(bound, 0);
+    s->unorm_vars.assign(bound, 0);
+    s->glsl_ext = 0;
+    s->first_func = spv_first_function(m);
+
+    // outputs of the fragment stage are render targets, outputs of other stages are read by the next stage
+    bool track_outputs = false;
+    for (int i = 0; i < s->first_func; i++) {
+        if (m.insts[i].op() == spv::OpEntryPoint) {
+            track_outputs = m.insts[i].w[1] == spv::ExecutionModelFragment;
+            break;
+        }
+    }
+
+    for (size_t i = 0; i < m.insts.size(); i++) {
+        const spv_inst& inst = m.insts[i];
+        bool has_result, has_type;
+        if (inst.op() == spv::OpName && inst.w[1] < bound &&
+            std::find(unorm_textures.begin(), unorm_textures.end(), (const char*)&inst.w[2]) != unorm_textures.end()) {
+            s->unorm_vars[inst.w[1]] = 1;
+        }
+
+        spv::HasResultAndType(inst.op(), &has_result, &has_type);
+        if (!has_result)
+            continue;
+        uint32_t id = inst.w[has_type ? 2 : 1];
+        s->defs[id] = int(i);
+
+        switch (inst.op()) {
+        case spv::OpExtInstImport:
+            if (strcmp((const char*)&inst.w[2], "GLSL.std.450") == 0)
+                s->glsl_ext = id;
+            break;
+        case spv::OpTypeFloat:
+            s->float_types[id] = inst.w[2] == 32;
+            break;
+        case spv::OpTypeVector:
+            s->float_types[id] = s->float_types[inst.w[2]];
+            break;
+        case spv::OpVariable: {
+            // function/private variables and fragment outputs of float types are tracked through loads and stores,
+            // stores to outputs of other stages are sinks like stores to untracked memory
+            spv::StorageClass sc = spv::StorageClass(inst.w[3]);
+            uint32_t pointee = m.insts[s->defs[inst.w[1]]].w[3];
+            int elem = spv_element_def(m, pointee);
+            bool track = (sc == spv::StorageClassFunction || sc == spv::StorageClassPrivate ||
+                          (sc == spv::StorageClassOutput && track_outputs && !spv_is_builtin(m, id, pointee))) &&
+                         elem >= 0 && s->float_types[spv_result_id(m.insts[elem])];
+            if (track) {
+                s->ptr_vars[id] = id;
+                if (inst.w.size() > 4) {
+                    get_range(*s, inst.w[4], &s->ranges[id]);
+                    s->known[id] = 1;
+                }
+            }
+            break;
+        }
+        default:
+            break;
+        }
+
+        if (has_type && s->float_types[inst.w[1]]) {
+            s->is_float[id] = 1;
+            if (int(i) < s->first_func) {
+                // constants, everything else in global scope can't be evaluated
+                value_range r = k_range_full;
+                if (inst.op() == spv::OpConstant) {
+                    memcpy(&r.lo, &inst.w[3], sizeof(float));
+                    r.hi = r.lo;
+                } else if (inst.op() == spv::OpConstantNull) {
+                    r = { 0, 0 };
+                } else if (inst.op() == spv::OpConstantComposite) {
+                    get_range(*s, inst.w[3], &r);
+                    for (size_t k = 4; k < inst.w.size(); k++) {
+                        value_range c;
+                        get_range(*s, inst.w[k], &c);
+                        r = range_hull(r, c);
+                    }
+                }
+                s->ranges[id] = r;
+                s->known[id] = 1;
+            }
+        }
+    }
+
+    // pointers to tracked variables can only be loaded, stored or access chained
+    for (size_t i = s->first_func; i < m.insts.size(); i++) {
+        const spv_inst& inst = m.insts[i];
+        bool has_result, has_type;
+        spv::HasResultAndType(inst.op(), &has_result, &has_type);
+        for (size_t k = 1 + has_result + has_type; k < inst.w.size(); k++) {
+            uint32_t var = inst.w[k] < bound ? s->ptr_vars[inst.w[k]] : 0;
+            if (!var)
+                continue;
+            spv::Op op = inst.op();
+            if ((op == spv::OpLoad && k == 3) || (op == spv::OpStore && k == 1))
+                continue;
+            if ((op == spv::OpAccessChain || op == spv::OpInBoundsAccessChain) && k == 3) {
+                s->ptr_vars[inst.w[2]] = var;
+                continue;
+            }
+            s->escaped[var] = 1;
+        }
+    }
+
+    for (uint32_t id = 0; id < bound; id++) {
+        if (s->ptr_vars[id] == id && s->escaped[id]) {
+            s->ranges[id] = k_range_full;
+            s->known[id] = 1;
+            s->sensitive[id] = 1;
+        }
+    }
+}
+
+static void eval_ranges(precision_state* s)
+{
+    const spv_module& m = s->m;
+    for (int iteration = 0; ; iteration++) {
+        bool changed = false;
+        for (size_t i = s->first_func; i < m.insts.size(); i++) {
+            const spv_inst& inst = m.insts[i];
+            value_range r;
+            if (inst.op() == spv::OpStore) {
+                uint32_t var = s->ptr_vars[inst.w[1]];
+                if (var && !s->escaped[var] && get_range(*s, inst.w[2], &r))
+                    changed |= update_range(s, var, r, iteration);
+                continue;
+            }
+
+            uint32_t id = spv_result_id(inst);
+            if (!id || !s->is_float[id] || !eval_range(*s, inst, &r))
+                continue;
+            changed |= update_range(s, id, r, iteration);
+        }
+
+        if (!changed)
+            break;
+    }
+}
+
+// values that end up in texture coordinates, integer conversions or untracked memory need full precision
+static void eval_sensitivity(precision_state* s)
+{
+    const spv_module& m = s->m;
+    for (size_t i = s->first_func; i < m.insts.size(); i++) {
+        const spv_inst& inst = m.insts[i];
+        spv::Op op = inst.op();
+        if (op >= spv::OpImageSampleImplicitLod && op <= spv::OpImageRead)
+            mark_operands(s, inst, 4);
+        else if (op >= spv::OpImageSparseSampleImplicitLod && op <= spv::OpImageSparseRead)
+            mark_operands(s, inst, 4);
+        else if (op == spv::OpImageWrite || op == spv::OpReturnValue)
+            mark_operands(s, inst, 1);
+        else if (op == spv::OpConvertFToS || op == spv::OpConvertFToU || op == spv::OpBitcast)
+            mark_operands(s, inst, 3);
+        else if (op == spv::OpFunctionCall)
+            mark_operands(s, inst, 4);
+        else if (op == spv::OpExtInst && inst.w[3] != s->glsl_ext)
+            mark_operands(s, inst, 5);
+        else if (op == spv::OpStore && !s->ptr_vars[inst.w[1]])
+            mark_operands(s, inst, 2);
+    }
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t i = m.insts.size(); i-- > size_t(s->first_func); ) {
+            const spv_inst& inst = m.insts[i];
+            if (inst.op() == spv::OpStore) {
+                uint32_t var = s->ptr_vars[inst.w[1]];
+                if (var && s->sensitive[var] && !s->sensitive[inst.w[2]])
+                    s->sensitive[inst.w[2]] = changed = true;
+            } else if (inst.op() == spv::OpLoad) {
+                uint32_t var = s->ptr_vars[inst.w[3]];
+                if (var && s->sensitive[inst.w[2]] && !s->sensitive[var])
+                    s->sensitive[var] = changed = true;
+            } else {
+                bool has_result, has_type;
+                spv::HasResultAndType(inst.op(), &has_result, &has_type);
+                if (!has_result || !s->sensitive[inst.w[has_type ? 2 : 1]])
+                    continue;
+                for (size_t k = 1 + has_result + has_type; k < inst.w.size(); k++) {
+                    if (inst.w[k] < s->sensitive.size() && !is_literal_operand(inst, k) && !s->sensitive[inst.w[k]])
+                        s->sensitive[inst.w[k]] = changed = true;
+                }
+            }
+        }
+    }
+}
+
+bool precision_relax(std::vector<uint32_t>& spirv, const std::vector<std::string>& unorm_textures,
+                     precision_report* report)
+{
+    precision_state s;
+    if (!spv_parse(&s.m, spirv))
+        return false;
+
+    setup_values(&s, unorm_textures);
+    eval_ranges(&s);
+    eval_sensitivity(&s);
+
+    const spv_module& m = s.m;
+    uint32_t bound = m.header[3];
+    std::vector<uint8_t> relaxed(bound, 0);
+    std::vector<const char*> names(bound, nullptr);
+    for (const spv_inst& inst : m.insts) {
+        if (inst.op() == spv::OpDecorate && inst.w[2] == spv::DecorationRelaxedPrecision)
+            relaxed[inst.w[1]] = 1;
+        else if (inst.op() == spv::OpName)
+            names[inst.w[1]] = (const char*)&inst.w[2];
+    }
+
+    report->num_values = 0;
+    report->num_relaxed = 0;
+    report->names.clear();
+
+    std::vector<spv_inst> decorations;
+    for (size_t i = s.first_func; i < m.insts.size(); i++) {
+        uint32_t id = spv_result_id(m.insts[i]);
+        bool var = id && s.ptr_vars[id] == id;
+        if (!id || (!s.is_float[id] && !var))
+            continue;
+
+        report->num_values++;
+        if (relaxed[id] || !s.known[id] || s.sensitive[id] || s.escaped[id] || !range_within(s.ranges[id], k_relaxed_limit))
+            continue;
+
+        decorations.push_back(spv_make(spv::OpDecorate, { id, spv::DecorationRelaxedPrecision }));
+        report->num_relaxed++;
+        if (var && names[id] && names[id][0])
+            report->names.push_back(names[id]);
+    }
+
+    // global variables (outputs, private)
+    for (size_t i = 0; i < size_t(s.first_func); i++) {
+        uint32_t id = spv_result_id(m.insts[i]);
+        if (!id || s.ptr_vars[id] != id)
+            continue;
+
+        report->num_values++;
+        if (relaxed[id] || !s.known[id] || s.sensitive[id] || s.escaped[id] || !range_within(s.ranges[id], k_relaxed_limit))
+            continue;
+
+        decorations.push_back(spv_make(spv::OpDecorate, { id, spv::DecorationRelaxedPrecision }));
+        report->num_relaxed++;
+        if (names[id] && names[id][0])
+            report->names.push_back(names[id]);
+    }
+
+    if (!decorations.empty()) {
+        spv_insert_global(&s.m, decorations);
+        spv_write(s.m, &spirv);
+    }
+    return true;
+}
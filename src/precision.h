@@ -0,0 +1,25 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+// mediump inference for GLES output: decorates float values with RelaxedPrecision when they are known to
+// stay in a small range (colors, texture samples, clamped values) and never flow into texture coordinates,
+// integer conversions or memory that other stages read with full precision
+//
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+struct precision_report {
+    int                      num_values;    // float temporaries and variables in the shader
+    int                      num_relaxed;   // values that are relaxed by the pass
+    std::vector<std::string> names;         // named variables that are relaxed
+};
+
+// Samples of the textures in unorm_textures (variable names) are known to be in [0, 1], which is the case for
+// color textures in unorm formats. Samples of other textures are full range (HDR, float, height data)
+// Returns false if the module can't be parsed, in which case it's left untouched
+bool precision_relax(std::vector<uint32_t>& spirv, const std::vector<std::string>& unorm_textures,
+                     precision_report* report);
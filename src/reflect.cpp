@@ -0,0 +1,278 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+#include "reflect.h"
+#include "sgs-file.h"
+#include "spirv-module.h"
+
+#include "sx/string.h"
+
+const char* k_attrib_names[VERTEX_ATTRIB_COUNT] = {
+    "POSITION",
+    "NORMAL",
+    "TEXCOORD0",
+    "TEXCOORD1",
+    "TEXCOORD2",
+    "TEXCOORD3",
+    "TEXCOORD4",
+    "TEXCOORD5",
+    "TEXCOORD6",
+    "TEXCOORD7",
+    "COLOR0",
+    "COLOR1",
+    "COLOR2",
+    "COLOR3",
+    "TANGENT",
+    "BINORMAL",
+    "BLENDINDICES",
+    "BLENDWEIGHT"
+};
+
+const char* k_attrib_sem_names[VERTEX_ATTRIB_COUNT] = {
+    "POSITION",
+    "NORMAL",
+    "TEXCOORD",
+    "TEXCOORD",
+    "TEXCOORD",
+    "TEXCOORD",
+    "TEXCOORD",
+    "TEXCOORD",
+    "TEXCOORD",
+    "TEXCOORD",
+    "COLOR",
+    "COLOR",
+    "COLOR",
+    "COLOR",
+    "TANGENT",
+    "BINORMAL",
+    "BLENDINDICES",
+    "BLENDWEIGHT"
+};
+
+const int k_attrib_sem_indices[VERTEX_ATTRIB_COUNT] = {
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    0,
+    1,
+    2,
+    3,
+    0,
+    0,
+    0,
+    0
+};
+
+static const uniform_type_mapping k_uniform_map[] = {
+    { spirv_cross::SPIRType::Float, 1, 1, "float", SGS_VERTEXFORMAT_FLOAT },
+    { spirv_cross::SPIRType::Float, 2, 1, "float2", SGS_VERTEXFORMAT_FLOAT2 },
+    { spirv_cross::SPIRType::Float, 3, 1, "float3", SGS_VERTEXFORMAT_FLOAT3 },
+    { spirv_cross::SPIRType::Float, 4, 1, "float4", SGS_VERTEXFORMAT_FLOAT4 },
+    { spirv_cross::SPIRType::Float, 3, 4, "mat3x4", 0 },
+    { spirv_cross::SPIRType::Float, 3, 4, "mat4x3", 0 },
+    { spirv_cross::SPIRType::Float, 3, 3, "mat3x3", 0 },
+    { spirv_cross::SPIRType::Float, 4, 4, "mat4", 0 },
+    { spirv_cross::SPIRType::Int, 1, 1, "int", SGS_VERTEXFORMAT_INT },
+    { spirv_cross::SPIRType::Int, 2, 1, "int2", SGS_VERTEXFORMAT_INT2 },
+    { spirv_cross::SPIRType::Int, 3, 1, "int3", SGS_VERTEXFORMAT_INT3 },
+    { spirv_cross::SPIRType::Int, 4, 1, "int4", SGS_VERTEXFORMAT_INT4 },
+    { spirv_cross::SPIRType::Half, 4, 1, "float", SGS_VERTEXFORMAT_FLOAT },
+    { spirv_cross::SPIRType::Half, 4, 2, "float2", SGS_VERTEXFORMAT_FLOAT2 },
+    { spirv_cross::SPIRType::Half, 4, 3, "float3", SGS_VERTEXFORMAT_FLOAT3 },
+    { spirv_cross::SPIRType::Half, 4, 4, "float4", SGS_VERTEXFORMAT_FLOAT4 }
+};
+
+static const vertex_format_mapping k_vertex_format_map[] = {
+    { SGS_VERTEXFORMAT_FLOAT, "float", 4 },
+    { SGS_VERTEXFORMAT_FLOAT2, "float2", 8 },
+    { SGS_VERTEXFORMAT_FLOAT3, "float3", 12 },
+    { SGS_VERTEXFORMAT_FLOAT4, "float4", 16 },
+    { SGS_VERTEXFORMAT_INT, "int", 4 },
+    { SGS_VERTEXFORMAT_INT2, "int2", 8 },
+    { SGS_VERTEXFORMAT_INT3, "int3", 12 },
+    { SGS_VERTEXFORMAT_INT4, "int4", 16 },
+    { SGS_VERTEXFORMAT_HALF2, "half2", 4 },
+    { SGS_VERTEXFORMAT_HALF4, "half4", 8 },
+    { SGS_VERTEXFORMAT_UBYTE4, "ubyte4", 4 },
+    { SGS_VERTEXFORMAT_UBYTE4N, "ubyte4n", 4 },
+    { SGS_VERTEXFORMAT_BYTE4N, "byte4n", 4 },
+    { SGS_VERTEXFORMAT_USHORT4N, "ushort4n", 8 },
+    { SGS_VERTEXFORMAT_SHORT4N, "short4n", 8 }
+};
+
+const uint32_t k_texture_dim_fourcc[spv::DimSubpassData + 1] = {
+    SGS_IMAGEDIM_1D,
+    SGS_IMAGEDIM_2D,
+    SGS_IMAGEDIM_3D,
+    SGS_IMAGEDIM_CUBE,
+    SGS_IMAGEDIM_RECT,
+    SGS_IMAGEDIM_BUFFER,
+    SGS_IMAGEDIM_SUBPASS
+};
+
+std::string get_semantic_defines()
+{
+    std::string semantics_def;
+    for (int i = 0; i < VERTEX_ATTRIB_COUNT; i++) {
+        char sem_line[128];
+        sx_snprintf(sem_line, sizeof(sem_line), "#define %s %d\n", k_attrib_names[i], i);
+        semantics_def += std::string(sem_line);
+    }
+
+    // Add SV_Target semantics for more HLSL compatibility
+    for (int i = 0; i < 8; i++) {
+        char sv_target_line[128];
+        sx_snprintf(sv_target_line, sizeof(sv_target_line), "#define SV_Target%d %d\n", i, i);
+        semantics_def += std::string(sv_target_line);
+    }
+    return semantics_def;
+}
+
+const vertex_format_mapping* find_vertex_format(uint32_t fourcc)
+{
+    for (size_t i = 0; i < sizeof(k_vertex_format_map) / sizeof(vertex_format_mapping); i++) {
+        if (k_vertex_format_map[i].fourcc == fourcc)
+            return &k_vertex_format_map[i];
+    }
+    return nullptr;
+}
+
+const uniform_type_mapping* find_uniform_type(const spirv_cross::SPIRType& type)
+{
+    for (size_t i = 0; i < sizeof(k_uniform_map) / sizeof(uniform_type_mapping); i++) {
+        if (k_uniform_map[i].base_type == type.basetype && k_uniform_map[i].vec_size == type.vecsize && k_uniform_map[i].columns == type.columns)
+            return &k_uniform_map[i];
+    }
+    return nullptr;
+}
+
+uint32_t get_vertex_format(const spirv_cross::SPIRType& type)
+{
+    const uniform_type_mapping* mapping = find_uniform_type(type);
+    return mapping ? mapping->fourcc : 0;
+}
+
+const vertex_format_mapping* get_compact_vertex_format(const spirv_cross::Compiler& compiler,
+                                                       const spirv_cross::Resource& res, int loc, bool* mediump)
+{
+    const spirv_cross::SPIRType& type = compiler.get_type(res.type_id);
+    uint32_t format = get_vertex_format(type);
+    bool relaxed = compiler.has_decoration(res.id, spv::DecorationRelaxedPrecision);
+    bool is_float = type.basetype == spirv_cross::SPIRType::Float && type.columns == 1 && type.array.empty();
+    uint32_t compact = format;
+
+    *mediump = relaxed;
+    if (type.basetype == spirv_cross::SPIRType::Int || type.basetype == spirv_cross::SPIRType::UInt) {
+        if (loc == VERTEX_INDICES)
+            compact = SGS_VERTEXFORMAT_UBYTE4;
+    } else if (is_float) {
+        switch (loc) {
+        case VERTEX_COLOR0:
+        case VERTEX_COLOR1:
+        case VERTEX_COLOR2:
+        case VERTEX_COLOR3:
+            // highp colors can be HDR or negative
+            if (relaxed)
+                compact = SGS_VERTEXFORMAT_UBYTE4N;
+            break;
+        case VERTEX_NORMAL:
+        case VERTEX_TANGENT:
+        case VERTEX_BITANGENT:
+            compact = relaxed ? SGS_VERTEXFORMAT_BYTE4N : SGS_VERTEXFORMAT_SHORT4N;
+            break;
+        case VERTEX_WEIGHTS:
+            compact = relaxed ? SGS_VERTEXFORMAT_UBYTE4N : SGS_VERTEXFORMAT_USHORT4N;
+            break;
+        case VERTEX_INDICES:
+            break;
+        default:
+            if (relaxed)
+                compact = type.vecsize <= 2 ? SGS_VERTEXFORMAT_HALF2 : SGS_VERTEXFORMAT_HALF4;
+            break;
+        }
+    }
+
+    const vertex_format_mapping* declared = find_vertex_format(format);
+    const vertex_format_mapping* mapping = find_vertex_format(compact);
+    return (declared && mapping && mapping->size >= declared->size) ? declared : mapping;
+}
+
+// natural size and alignment of a type, vec3s are aligned like vec4s (std430)
+static void get_type_layout(const spv_module& m, uint32_t type_id, uint32_t* size, uint32_t* align)
+{
+    const spv_inst& def = m.insts[spv_find_def(m, type_id)];
+    uint32_t elem_size, elem_align;
+    *size = *align = 4;
+    switch (def.op()) {
+    case spv::OpTypeInt:
+    case spv::OpTypeFloat:
+        *size = *align = def.w[2] / 8;
+        break;
+    case spv::OpTypeVector:
+        get_type_layout(m, def.w[2], &elem_size, &elem_align);
+        *size = elem_size * def.w[3];
+        *align = elem_size * (def.w[3] == 3 ? 4 : def.w[3]);
+        break;
+    case spv::OpTypeMatrix:
+        get_type_layout(m, def.w[2], &elem_size, &elem_align);
+        *size = sx_align_mask(elem_size, elem_align - 1) * def.w[3];
+        *align = elem_align;
+        break;
+    case spv::OpTypeArray: {
+        get_type_layout(m, def.w[2], &elem_size, &elem_align);
+        int length = spv_find_def(m, def.w[3]);
+        *size = sx_align_mask(elem_size, elem_align - 1) * (length != -1 ? m.insts[length].w[3] : 1);
+        *align = elem_align;
+        break;
+    }
+    case spv::OpTypeStruct:
+        *size = 0;
+        *align = 1;
+        for (size_t i = 2; i < def.w.size(); i++) {
+            get_type_layout(m, def.w[i], &elem_size, &elem_align);
+            *size = sx_align_mask(*size, elem_align - 1) + elem_size;
+            *align = sx_max(*align, elem_align);
+        }
+        *size = sx_align_mask(*size, *align - 1);
+        break;
+    default:
+        break;
+    }
+}
+
+void get_compute_info(const spirv_cross::Compiler& compiler, const std::vector<uint32_t>& spirv, compute_info* info)
+{
+    sx_memset(info, 0x0, sizeof(compute_info));
+
+    // spec constants have the values of --specialize, if it's set
+    spirv_cross::SpecializationConstant sc[3];
+    compiler.get_work_group_size_specialization_constants(sc[0], sc[1], sc[2]);
+    for (int i = 0; i < 3; i++) {
+        if (sc[i].id != spirv_cross::ID(0)) {
+            info->workgroup_size[i] = compiler.get_constant(sc[i].id).scalar();
+            info->workgroup_size_spec_ids[i] = (int)sc[i].constant_id;
+        } else {
+            info->workgroup_size[i] = compiler.get_execution_mode_argument(spv::ExecutionModeLocalSize, i);
+            info->workgroup_size_spec_ids[i] = -1;
+        }
+    }
+
+    spv_module m;
+    if (!spv_parse(&m, spirv))
+        return;
+    for (const spv_inst& inst : m.insts) {
+        if (inst.op() == spv::OpVariable && inst.w[3] == spv::StorageClassWorkgroup) {
+            uint32_t size, align;
+            get_type_layout(m, m.insts[spv_find_def(m, inst.w[1])].w[3], &size, &align);
+            info->shared_memory_size += size;
+        }
+    }
+}
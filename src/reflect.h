@@ -0,0 +1,76 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+// Reflection data that is shared by the command line and libglslcc: vertex semantics, type and vertex format
+// mappings and the workgroup of compute shaders
+//
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "spirv_cross.hpp"
+
+enum vertex_attribs {
+    VERTEX_POSITION = 0,
+    VERTEX_NORMAL,
+    VERTEX_TEXCOORD0,
+    VERTEX_TEXCOORD1,
+    VERTEX_TEXCOORD2,
+    VERTEX_TEXCOORD3,
+    VERTEX_TEXCOORD4,
+    VERTEX_TEXCOORD5,
+    VERTEX_TEXCOORD6,
+    VERTEX_TEXCOORD7,
+    VERTEX_COLOR0,
+    VERTEX_COLOR1,
+    VERTEX_COLOR2,
+    VERTEX_COLOR3,
+    VERTEX_TANGENT,
+    VERTEX_BITANGENT,
+    VERTEX_INDICES,
+    VERTEX_WEIGHTS,
+    VERTEX_ATTRIB_COUNT
+};
+
+extern const char* k_attrib_names[VERTEX_ATTRIB_COUNT];
+extern const char* k_attrib_sem_names[VERTEX_ATTRIB_COUNT];
+extern const int   k_attrib_sem_indices[VERTEX_ATTRIB_COUNT];
+extern const uint32_t k_texture_dim_fourcc[spv::DimSubpassData + 1];
+
+struct uniform_type_mapping {
+    spirv_cross::SPIRType::BaseType base_type;
+    int vec_size;
+    int columns;
+    const char* type_str;
+    uint32_t fourcc;
+};
+
+struct vertex_format_mapping {
+    uint32_t fourcc;
+    const char* format_str;
+    uint32_t size;
+};
+
+// workgroup of compute shaders
+struct compute_info {
+    uint32_t workgroup_size[3];
+    int      workgroup_size_spec_ids[3];    // constant_id of each dimension, -1 if it's not a specialization constant
+    uint32_t shared_memory_size;            // bytes of all shared variables
+};
+
+// "#define POSITION 0" ... lines of the vertex semantics and SV_Target0..7, for layout(location = SEMANTIC)
+std::string get_semantic_defines();
+
+const uniform_type_mapping*  find_uniform_type(const spirv_cross::SPIRType& type);
+const vertex_format_mapping* find_vertex_format(uint32_t fourcc);
+uint32_t                     get_vertex_format(const spirv_cross::SPIRType& type);
+
+// smallest vertex format for the input, from its semantic and precision
+const vertex_format_mapping* get_compact_vertex_format(const spirv_cross::Compiler& compiler,
+                                                       const spirv_cross::Resource& res, int loc, bool* mediump);
+
+// workgroup size has the specialized values if the constants are set on the compiler
+void get_compute_info(const spirv_cross::Compiler& compiler, const std::vector<uint32_t>& spirv, compute_info* info);
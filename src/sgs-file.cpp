@@ -12,6 +12,12 @@
 
 #include <string>
 
+struct sgs_stage_chunk {
+    uint32_t    fourcc;
+    void*       data;
+    uint32_t    size;
+};
+
 struct sgs_stage {
     uint32_t    stage;
     union {
@@ -22,6 +28,12 @@ struct sgs_stage {
 
     void*       refl;
     uint32_t    refl_size;
+    uint32_t    refl_chunk;     // SGS_CHUNK_REFL or SGS_CHUNK_REF2
+
+    sgs_stage_chunk* chunks;    // sx_array, optional chunks that are written after the reflection
+
+    sgs_chunk_stat stat;
+    bool        has_stat;
 
     void*       cs_refl;
     uint32_t    cs_refl_size;
@@ -108,7 +120,8 @@ void sgs_add_stage_code_bin(sgs_file* f, uint32_t stage, const void* bytecode, i
     s->data_size = len;
 }
 
-void sgs_add_stage_reflect(sgs_file* f, uint32_t stage, const void* reflect, int refl_size)
+void sgs_add_stage_reflect(sgs_file* f, uint32_t stage, const void* reflect, int refl_size, 
+                           uint32_t refl_chunk)
 {
     sgs_stage* s = nullptr;
     // search in stages and see if find it
@@ -131,6 +144,53 @@ void sgs_add_stage_reflect(sgs_file* f, uint32_t stage, const void* reflect, int
     s->refl = sx_malloc(f->alloc, refl_size);
     sx_memcpy(s->refl, reflect, refl_size);
     s->refl_size = refl_size;
+    s->refl_chunk = refl_chunk;
+}
+
+void sgs_add_stage_chunk(sgs_file* f, uint32_t stage, uint32_t fourcc, const void* data, int size)
+{
+    sgs_stage* s = nullptr;
+    // search in stages and see if find it
+    for (int i = 0; i < sx_array_count(f->stages); i++) {
+        if (f->stages[i].stage == stage) {
+            s = &f->stages[i];
+            break;
+        }
+    }
+
+    if (!s) {
+        s = sx_array_add(f->alloc, f->stages, 1);
+        sx_memset(s, 0x0, sizeof(sgs_stage));
+        s->stage = stage;
+    }
+
+    sgs_stage_chunk chunk;
+    chunk.fourcc = fourcc;
+    chunk.data = sx_malloc(f->alloc, size);
+    chunk.size = size;
+    sx_memcpy(chunk.data, data, size);
+    sx_array_push(f->alloc, s->chunks, chunk);
+}
+
+void sgs_add_stage_stats(sgs_file* f, uint32_t stage, const sgs_chunk_stat& stat)
+{
+    sgs_stage* s = nullptr;
+    // search in stages and see if find it
+    for (int i = 0; i < sx_array_count(f->stages); i++) {
+        if (f->stages[i].stage == stage) {
+            s = &f->stages[i];
+            break;
+        }
+    }
+
+    if (!s) {
+        s = sx_array_add(f->alloc, f->stages, 1);
+        sx_memset(s, 0x0, sizeof(sgs_stage));
+        s->stage = stage;
+    }
+
+    s->stat = stat;
+    s->has_stat = true;
 }
 
 bool sgs_commit(sgs_file* f)
@@ -158,8 +218,14 @@ bool sgs_commit(sgs_file* f)
         const uint32_t data_size = s->data_size;
         sx_assert(code_size || data_size);
 
+        uint32_t chunks_size = 0;
+        for (int k = 0; k < sx_array_count(s->chunks); k++)
+            chunks_size += 8 + s->chunks[k].size;
+
         const uint32_t stage_size = 
             (s->refl ? (8 + s->refl_size) : 0) +
+            (s->has_stat ? (8 + sizeof(sgs_chunk_stat)) : 0) +
+            chunks_size +
             (8 + code_size + data_size) +
             sizeof(uint32_t);
         
@@ -184,13 +250,29 @@ bool sgs_commit(sgs_file* f)
             sx_file_write(&writer, s->data, s->data_size);
         }
 
-        // `REFL`
+        // `REFL` or `REF2`
         if (s->refl) {
-            const uint32_t _refl = SGS_CHUNK_REFL;
-            sx_file_write_var(&writer, _refl);
+            sx_file_write_var(&writer, s->refl_chunk);
             sx_file_write_var(&writer, s->refl_size);
             sx_file_write(&writer, s->refl, s->refl_size);
         }
+
+        // `STAT`
+        if (s->has_stat) {
+            const uint32_t _stat = SGS_CHUNK_STAT;
+            const uint32_t stat_size = sizeof(sgs_chunk_stat);
+            sx_file_write_var(&writer, _stat);
+            sx_file_write_var(&writer, stat_size);
+            sx_file_write_var(&writer, s->stat);
+        }
+
+        // `SPEC`, `ARGB`, ...
+        for (int k = 0; k < sx_array_count(s->chunks); k++) {
+            const sgs_stage_chunk& chunk = s->chunks[k];
+            sx_file_write_var(&writer, chunk.fourcc);
+            sx_file_write_var(&writer, chunk.size);
+            sx_file_write(&writer, chunk.data, chunk.size);
+        }
     }
 
     sx_file_close_writer(&writer);
@@ -4,11 +4,32 @@
 //
 
 //
-// File version: 1.1.0
+// File version: 1.9.0
 // File endianness: little
 // 
 // v1.1.0 CHANGES
 //      - added num_storages_images, num_storage_buffers (CS specific) variables to sgs_chunk_refl
+// v1.2.0 CHANGES
+//      - added REF2 chunk (--refl-v2), which replaces REFL: names are kept in a string pool and
+//        resources have precomputed name hashes, for faster lookups and smaller reflection data
+// v1.3.0 CHANGES
+//      - added optional STAT chunk (--stats) after the reflection chunk of each stage
+// v1.4.0 CHANGES
+//      - added SPEC chunk (specialization constants), written with the reflection data of stages that have them
+// v1.5.0 CHANGES
+//      - added ARGB chunk (--msl-argument-buffers): Metal argument buffer layouts of the stage
+// v1.6.0 CHANGES
+//      - added CSMP chunk (--combine-samplers): source image/sampler pairs of the combined samplers (GLSL/GLES)
+// v1.7.0 CHANGES
+//      - added VFMT chunk (--vertex-formats): precision and recommended compact format of vertex inputs, with new
+//        vertex formats
+// v1.8.0 CHANGES
+//      - added CINF chunk: workgroup size and shared memory size of compute stages
+// v1.9.0 CHANGES
+//      - added chunks that are written instead of the chunks with fixed size names when --refl-v2 is set, their
+//        names are offsets in the string pool of the REF2 chunk of the same stage, with fnv1a-32 hashes:
+//        SPC2 (SPEC), ARG2 (ARGB), CSM2 (CSMP), UBS2 (UBSP)
+//      - added UBSP chunk (--split-ubos): source block and update frequency of the parts of split uniform blocks
 //
 #pragma once
 
@@ -19,8 +40,20 @@
 #define SGS_CHUNK           sx_makefourcc('S', 'G', 'S', ' ')
 #define SGS_CHUNK_STAG      sx_makefourcc('S', 'T', 'A', 'G')
 #define SGS_CHUNK_REFL      sx_makefourcc('R', 'E', 'F', 'L')
+#define SGS_CHUNK_REF2      sx_makefourcc('R', 'E', 'F', '2')
 #define SGS_CHUNK_CODE      sx_makefourcc('C', 'O', 'D', 'E')
 #define SGS_CHUNK_DATA      sx_makefourcc('D', 'A', 'T', 'A')
+#define SGS_CHUNK_STAT      sx_makefourcc('S', 'T', 'A', 'T')
+#define SGS_CHUNK_SPEC      sx_makefourcc('S', 'P', 'E', 'C')
+#define SGS_CHUNK_SPC2      sx_makefourcc('S', 'P', 'C', '2')
+#define SGS_CHUNK_ARGB      sx_makefourcc('A', 'R', 'G', 'B')
+#define SGS_CHUNK_ARG2      sx_makefourcc('A', 'R', 'G', '2')
+#define SGS_CHUNK_CSMP      sx_makefourcc('C', 'S', 'M', 'P')
+#define SGS_CHUNK_CSM2      sx_makefourcc('C', 'S', 'M', '2')
+#define SGS_CHUNK_VFMT      sx_makefourcc('V', 'F', 'M', 'T')
+#define SGS_CHUNK_CINF      sx_makefourcc('C', 'I', 'N', 'F')
+#define SGS_CHUNK_UBSP      sx_makefourcc('U', 'B', 'S', 'P')
+#define SGS_CHUNK_UBS2      sx_makefourcc('U', 'B', 'S', '2')
 
 #define SGS_LANG_GLES sx_makefourcc('G', 'L', 'E', 'S')
 #define SGS_LANG_HLSL sx_makefourcc('H', 'L', 'S', 'L')
@@ -36,6 +69,33 @@
 #define SGS_VERTEXFORMAT_INT3       sx_makefourcc('I', 'N', 'T', '3')
 #define SGS_VERTEXFORMAT_INT4       sx_makefourcc('I', 'N', 'T', '4')
 
+// compact vertex formats, only recommended by the VFMT chunk. N formats are normalized to [0, 1] or [-1, 1]
+#define SGS_VERTEXFORMAT_HALF2      sx_makefourcc('H', 'L', 'F', '2')
+#define SGS_VERTEXFORMAT_HALF4      sx_makefourcc('H', 'L', 'F', '4')
+#define SGS_VERTEXFORMAT_UBYTE4     sx_makefourcc('U', 'B', '4', ' ')
+#define SGS_VERTEXFORMAT_UBYTE4N    sx_makefourcc('U', 'B', '4', 'N')
+#define SGS_VERTEXFORMAT_BYTE4N     sx_makefourcc('S', 'B', '4', 'N')
+#define SGS_VERTEXFORMAT_USHORT4N   sx_makefourcc('U', 'S', '4', 'N')
+#define SGS_VERTEXFORMAT_SHORT4N    sx_makefourcc('S', 'S', '4', 'N')
+
+#define SGS_PRECISION_HIGH          sx_makefourcc('H', 'I', 'G', 'H')
+#define SGS_PRECISION_MEDIUM        sx_makefourcc('M', 'E', 'D', 'I')
+
+#define SGS_SPECTYPE_BOOL           sx_makefourcc('B', 'O', 'O', 'L')
+#define SGS_SPECTYPE_INT            sx_makefourcc('I', 'N', 'T', '1')
+#define SGS_SPECTYPE_UINT           sx_makefourcc('U', 'I', 'N', 'T')
+#define SGS_SPECTYPE_FLOAT          sx_makefourcc('F', 'L', 'T', '1')
+
+#define SGS_ARGKIND_UNIFORM_BUFFER  sx_makefourcc('U', 'B', 'U', 'F')
+#define SGS_ARGKIND_STORAGE_BUFFER  sx_makefourcc('S', 'B', 'U', 'F')
+#define SGS_ARGKIND_TEXTURE         sx_makefourcc('T', 'E', 'X', 'T')
+#define SGS_ARGKIND_STORAGE_IMAGE   sx_makefourcc('S', 'I', 'M', 'G')
+#define SGS_ARGKIND_SAMPLER         sx_makefourcc('S', 'M', 'P', 'L')
+
+#define SGS_UBOFREQ_FRAME           sx_makefourcc('F', 'R', 'A', 'M')
+#define SGS_UBOFREQ_MATERIAL        sx_makefourcc('M', 'A', 'T', 'L')
+#define SGS_UBOFREQ_DRAW            sx_makefourcc('D', 'R', 'A', 'W')
+
 #define SGS_STAGE_VERTEX            sx_makefourcc('V', 'E', 'R', 'T')
 #define SGS_STAGE_FRAGMENT          sx_makefourcc('F', 'R', 'A', 'G')
 #define SGS_STAGE_COMPUTE           sx_makefourcc('C', 'O', 'M', 'P')
@@ -102,6 +162,220 @@ struct sgs_refl_uniformbuffer {
     uint16_t array_size;
 };
 
+// REF2
+// Resources are written in this order: inputs, uniform-buffers, textures, storage-images, storage-buffers
+// For each resource type, there are 3 arrays with the same count: 
+//      uint32_t name_hashes[count]: fnv1a-32 hash of the resource names, search this array for lookups by name
+//      int32_t  bindings[count]:    binding of the resource (location for vertex inputs)
+//      sgs_refl2_xxx[count]:        resource data
+// After all resources, comes the string pool (strings_size bytes), all names (uint32_t) are byte offsets of
+// null-terminated strings in the pool
+struct sgs_chunk_refl2 {
+    uint32_t name;
+    uint32_t num_inputs;
+    uint32_t num_textures;
+    uint32_t num_uniform_buffers;
+    uint32_t num_storage_images;
+    uint32_t num_storage_buffers;
+    uint32_t strings_size;
+    uint16_t flatten_ubos;
+    uint16_t debug_info;
+};
+
+struct sgs_refl2_input {
+    uint32_t name;
+    uint32_t semantic;
+    uint32_t semantic_index;
+    uint32_t format;
+};
+
+struct sgs_refl2_texture {
+    uint32_t name;
+    uint32_t image_dim;
+    uint8_t  multisample;
+    uint8_t  is_array;
+    uint16_t _reserved;
+};
+
+struct sgs_refl2_buffer {
+    uint32_t name;
+    uint32_t size_bytes;
+    uint32_t array_stride;
+};
+
+struct sgs_refl2_uniformbuffer {
+    uint32_t name;
+    uint32_t size_bytes;
+    uint16_t array_size;
+    uint16_t _reserved;
+};
+
+// STAT
+// Static cost estimates of the stage, see stats.h
+struct sgs_chunk_stat {
+    uint32_t num_instructions;
+    uint32_t num_alu;
+    uint32_t num_transcendental;
+    uint32_t num_texture;
+    uint32_t num_dependent_texture;
+    uint32_t num_branches;
+    uint32_t num_loops;
+    uint32_t max_live_components;
+    uint32_t num_uniform_buffers;
+    uint32_t uniform_bytes;
+};
+
+// SPEC
+// Scalar specialization constants of the stage: sgs_refl_spec_constant[num_constants]
+// The application overrides them by constant_id: MSL function_constant(constant_id), or for GLSL/GLES/HLSL
+// by defining SPIRV_CROSS_CONSTANT_ID_<constant_id> in front of the source before compiling it
+// Names are cut to 31 characters (glslcc warns about it), look them up by constant_id or use --refl-v2
+struct sgs_chunk_spec {
+    uint32_t num_constants;
+};
+
+struct sgs_refl_spec_constant {
+    char     name[32];
+    uint32_t constant_id;
+    uint32_t type;          // SGS_SPECTYPE_xxx
+    uint32_t value;         // bits of the default value (bool is 0/1)
+};
+
+// SPC2
+// Same as SPEC, written instead of it with --refl-v2: sgs_chunk_spec, then sgs_refl2_spec_constant[num_constants]
+struct sgs_refl2_spec_constant {
+    uint32_t name;          // offset in the string pool of REF2
+    uint32_t name_hash;     // fnv1a-32
+    uint32_t constant_id;
+    uint32_t type;          // SGS_SPECTYPE_xxx
+    uint32_t value;         // bits of the default value (bool is 0/1)
+};
+
+// ARGB
+// Metal argument buffers, one per descriptor set: sgs_refl_argbuf[num_buffers], followed by the members of all
+// buffers in the same order: sgs_refl_argbuf_member[sum of num_members]
+// Members are sorted by id, which is the [[id(n)]] index for MTLArgumentEncoder. offset is the byte offset for
+// direct encoding (Metal 3), where every resource takes 8 bytes (MTLResourceID or gpuAddress)
+// Member names are cut to 31 characters (glslcc warns about it), use --refl-v2 for long names
+struct sgs_chunk_argbuf {
+    uint32_t num_buffers;
+};
+
+struct sgs_refl_argbuf {
+    uint32_t set;           // descriptor set
+    uint32_t buffer_index;  // [[buffer(n)]] of the argument buffer
+    uint32_t num_members;
+    uint32_t size_bytes;    // size for direct encoding
+};
+
+struct sgs_refl_argbuf_member {
+    char     name[32];
+    uint32_t id;
+    uint32_t offset;
+    uint32_t kind;          // SGS_ARGKIND_xxx
+    int32_t  binding;       // binding of the resource in the shader
+    uint32_t array_size;
+};
+
+// ARG2
+// Same as ARGB, written instead of it with --refl-v2: sgs_chunk_argbuf, sgs_refl_argbuf[num_buffers], then
+// sgs_refl2_argbuf_member[sum of num_members]
+struct sgs_refl2_argbuf_member {
+    uint32_t name;          // offset in the string pool of REF2
+    uint32_t name_hash;     // fnv1a-32
+    uint32_t id;
+    uint32_t offset;
+    uint32_t kind;          // SGS_ARGKIND_xxx
+    int32_t  binding;       // binding of the resource in the shader
+    uint32_t array_size;
+};
+
+// CSMP
+// Combined samplers built from separate images and samplers: sgs_refl_combined_sampler[num_samplers]
+// The combined samplers are also listed in the textures of the reflection chunk, binding is their texture unit
+// Images that are used without a sampler (texelFetch) are combined with a dummy sampler: sampler is empty and
+// sampler_binding is -1
+// Names are cut to 31 characters (glslcc warns about it), so they may not match the names of the textures, match
+// them by binding or use --refl-v2
+struct sgs_chunk_csmp {
+    uint32_t num_samplers;
+};
+
+struct sgs_refl_combined_sampler {
+    char    name[32];
+    int32_t binding;
+    char    image[32];
+    int32_t image_binding;
+    char    sampler[32];
+    int32_t sampler_binding;
+};
+
+// CSM2
+// Same as CSMP, written instead of it with --refl-v2: sgs_chunk_csmp, then sgs_refl2_combined_sampler[num_samplers]
+// name_hash is the same as the hash of the texture in REF2, sampler is an empty string for dummy samplers
+struct sgs_refl2_combined_sampler {
+    uint32_t name;          // offset in the string pool of REF2
+    uint32_t name_hash;     // fnv1a-32
+    int32_t  binding;
+    uint32_t image;
+    int32_t  image_binding;
+    uint32_t sampler;
+    int32_t  sampler_binding;
+};
+
+// VFMT
+// Vertex stages only: sgs_refl_vertex_format[num_inputs], in the same order as the inputs of the reflection chunk
+// precision is MEDIUM for mediump inputs. format is the smallest vertex format that keeps the precision the
+// shader needs, picked from the semantic: UBYTE4N for mediump colors, SHORT4N (BYTE4N if mediump) for
+// normals/tangents, USHORT4N (UBYTE4N) for weights, UBYTE4 for integer indices and HALF2/4 for other mediump
+// inputs. It's the declared format when there is nothing smaller
+struct sgs_chunk_vfmt {
+    uint32_t num_inputs;
+};
+
+struct sgs_refl_vertex_format {
+    int32_t  loc;
+    uint32_t precision;     // SGS_PRECISION_xxx
+    uint32_t format;        // SGS_VERTEXFORMAT_xxx
+    uint32_t size_bytes;    // size of format
+};
+
+// CINF
+// Compute stages only, written after the reflection chunk
+struct sgs_chunk_cinf {
+    uint32_t workgroup_size[3];
+    int32_t  workgroup_size_spec_ids[3];    // constant_id of each dimension, -1 if it's not a spec constant
+    uint32_t shared_memory_size;            // bytes of all shared variables
+};
+
+// UBSP
+// Parts of the uniform blocks that are split by --split-ubos: sgs_refl_ubo_part[num_parts]
+// Each part is also a uniform buffer of the reflection chunk, with its own binding. The first part of a block keeps
+// the binding of the block. Names are cut to 31 characters (glslcc warns about it), use --refl-v2 for long names
+struct sgs_chunk_ubsp {
+    uint32_t num_parts;
+};
+
+struct sgs_refl_ubo_part {
+    char     name[32];      // block name of the part, <block>_<frequency> (<block> without a frequency)
+    char     block[32];     // name of the block that is split
+    int32_t  binding;       // binding of the part in the uniform buffers of the reflection chunk
+    uint32_t frequency;     // SGS_UBOFREQ_xxx, 0 for members without a frequency
+    uint32_t size_bytes;
+};
+
+// UBS2
+// Same as UBSP, written instead of it with --refl-v2: sgs_chunk_ubsp, then sgs_refl2_ubo_part[num_parts]
+struct sgs_refl2_ubo_part {
+    uint32_t name;          // offset in the string pool of REF2
+    uint32_t name_hash;     // fnv1a-32
+    uint32_t block;         // offset in the string pool of REF2
+    uint32_t block_hash;    // fnv1a-32
+    int32_t  binding;
+    uint32_t frequency;     // SGS_UBOFREQ_xxx, 0 for members without a frequency
+    uint32_t size_bytes;
+};
+
 #pragma pack(pop)
 
 struct sgs_file;
@@ -110,5 +384,8 @@ sgs_file* sgs_create_file(const sx_alloc* alloc, const char* filepath, uint32_t
 void      sgs_destroy_file(sgs_file* f);
 void      sgs_add_stage_code(sgs_file* f, uint32_t stage, const char* code);
 void      sgs_add_stage_code_bin(sgs_file* f, uint32_t stage, const void* bytecode, int len);
-void      sgs_add_stage_reflect(sgs_file* f, uint32_t stage, const void* reflect, int reflect_size);
+void      sgs_add_stage_reflect(sgs_file* f, uint32_t stage, const void* reflect, int reflect_size,
+                                uint32_t refl_chunk = SGS_CHUNK_REFL);
+void      sgs_add_stage_chunk(sgs_file* f, uint32_t stage, uint32_t fourcc, const void* data, int size);
+void      sgs_add_stage_stats(sgs_file* f, uint32_t stage, const sgs_chunk_stat& stat);
 bool      sgs_commit(sgs_file* f);
@@ -0,0 +1,250 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+#include "spirv-module.h"
+
+#include <string.h>
+
+bool spv_parse(spv_module* m, const std::vector<uint32_t>& spirv)
+{
+    if (spirv.size() < 5 || spirv[0] != spv::MagicNumber)
+        return false;
+
+    memcpy(m->header, spirv.data(), sizeof(m->header));
+    size_t i = 5;
+    while (i < spirv.size()) {
+        uint32_t count = spirv[i] >> spv::WordCountShift;
+        if (count == 0 || i + count > spirv.size())
+            return false;
+        spv_inst inst;
+        inst.w.assign(spirv.begin() + i, spirv.begin() + i + count);
+        m->insts.push_back(std::move(inst));
+        i += count;
+    }
+    return true;
+}
+
+void spv_write(const spv_module& m, std::vector<uint32_t>* spirv)
+{
+    spirv->assign(m.header, m.header + 5);
+    for (const spv_inst& inst : m.insts)
+        spirv->insert(spirv->end(), inst.w.begin(), inst.w.end());
+}
+
+void spv_fix_count(spv_inst* inst)
+{
+    inst->w[0] = (uint32_t(inst->w.size()) << spv::WordCountShift) | (inst->w[0] & spv::OpCodeMask);
+}
+
+spv_inst spv_make(spv::Op op, std::initializer_list<uint32_t> operands)
+{
+    spv_inst inst;
+    inst.w.push_back(uint32_t(op));
+    inst.w.insert(inst.w.end(), operands);
+    spv_fix_count(&inst);
+    return inst;
+}
+
+uint32_t spv_result_id(const spv_inst& inst)
+{
+    bool has_result, has_type;
+    spv::HasResultAndType(inst.op(), &has_result, &has_type);
+    return has_result ? inst.w[has_type ? 2 : 1] : 0;
+}
+
+int spv_find_def(const spv_module& m, uint32_t id)
+{
+    for (size_t i = 0; i < m.insts.size(); i++) {
+        if (spv_result_id(m.insts[i]) == id)
+            return int(i);
+    }
+    return -1;
+}
+
+int spv_first_function(const spv_module& m)
+{
+    for (size_t i = 0; i < m.insts.size(); i++) {
+        if (m.insts[i].op() == spv::OpFunction)
+            return int(i);
+    }
+    return int(m.insts.size());
+}
+
+// index of the OpEntryPoint, modules with multiple entry points are not supported
+int spv_entry_point(const spv_module& m)
+{
+    int index = -1;
+    for (size_t i = 0; i < m.insts.size(); i++) {
+        if (m.insts[i].op() == spv::OpEntryPoint) {
+            if (index != -1)
+                return -1;
+            index = int(i);
+        }
+    }
+    return index;
+}
+
+// number of words taken by the literal string that starts at word 'start'
+size_t spv_string_words(const spv_inst& inst, size_t start)
+{
+    for (size_t i = start; i < inst.w.size(); i++) {
+        uint32_t w = inst.w[i];
+        if (!(w & 0xff) || !(w & 0xff00) || !(w & 0xff0000) || !(w & 0xff000000))
+            return i - start + 1;
+    }
+    return inst.w.size() - start;
+}
+
+bool spv_decoration(const spv_module& m, uint32_t id, spv::Decoration deco, uint32_t* value)
+{
+    for (const spv_inst& inst : m.insts) {
+        if (inst.op() == spv::OpDecorate && inst.w[1] == id && inst.w[2] == uint32_t(deco)) {
+            if (value)
+                *value = inst.w.size() > 3 ? inst.w[3] : 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+// strips arrays from the type
+int spv_element_def(const spv_module& m, uint32_t type_id)
+{
+    int def = spv_find_def(m, type_id);
+    while (def >= 0 && (m.insts[def].op() == spv::OpTypeArray || m.insts[def].op() == spv::OpTypeRuntimeArray))
+        def = spv_find_def(m, m.insts[def].w[2]);
+    return def;
+}
+
+bool spv_is_builtin(const spv_module& m, uint32_t var_id, uint32_t type_id)
+{
+    if (spv_decoration(m, var_id, spv::DecorationBuiltIn))
+        return true;
+
+    // gl_PerVertex style blocks have the builtins on struct members
+    int def = spv_element_def(m, type_id);
+    if (def < 0 || m.insts[def].op() != spv::OpTypeStruct)
+        return false;
+    uint32_t struct_id = m.insts[def].w[1];
+    for (const spv_inst& inst : m.insts) {
+        if (inst.op() == spv::OpMemberDecorate && inst.w[1] == struct_id && inst.w[3] == spv::DecorationBuiltIn)
+            return true;
+    }
+    return false;
+}
+
+// logical layout sections of the global part of the module, used to place new instructions
+static int spv_layout_rank(spv::Op op)
+{
+    switch (op) {
+    case spv::OpCapability:
+    case spv::OpExtension:
+    case spv::OpExtInstImport:
+    case spv::OpMemoryModel:
+    case spv::OpEntryPoint:
+    case spv::OpExecutionMode:
+    case spv::OpExecutionModeId:
+        return 0;
+    case spv::OpString:
+    case spv::OpSourceExtension:
+    case spv::OpSource:
+    case spv::OpSourceContinued:
+        return 1;
+    case spv::OpName:
+    case spv::OpMemberName:
+        return 2;
+    case spv::OpModuleProcessed:
+        return 3;
+    case spv::OpDecorate:
+    case spv::OpMemberDecorate:
+    case spv::OpDecorationGroup:
+    case spv::OpGroupDecorate:
+    case spv::OpGroupMemberDecorate:
+    case spv::OpDecorateId:
+    case spv::OpDecorateString:
+    case spv::OpMemberDecorateString:
+        return 4;
+    default:
+        return 5;
+    }
+}
+
+// inserts debug and annotation instructions at the end of their section
+void spv_insert_global(spv_module* m, spv_inst inst)
+{
+    int rank = spv_layout_rank(inst.op());
+    size_t pos = 0;
+    while (pos < m->insts.size() && spv_layout_rank(m->insts[pos].op()) <= rank)
+        pos++;
+    m->insts.insert(m->insts.begin() + pos, std::move(inst));
+}
+
+// inserts a type or constant right after the declaration of the type it depends on
+// inserts a batch of instructions from the same section
+void spv_insert_global(spv_module* m, const std::vector<spv_inst>& insts)
+{
+    int rank = spv_layout_rank(insts[0].op());
+    size_t pos = 0;
+    while (pos < m->insts.size() && spv_layout_rank(m->insts[pos].op()) <= rank)
+        pos++;
+    m->insts.insert(m->insts.begin() + pos, insts.begin(), insts.end());
+}
+
+uint32_t spv_insert_after(spv_module* m, uint32_t dep_id, spv::Op op, std::initializer_list<uint32_t> operands)
+{
+    int def = spv_find_def(*m, dep_id);
+    m->insts.insert(m->insts.begin() + def + 1, spv_make(op, operands));
+    return spv_result_id(m->insts[def + 1]);
+}
+
+uint32_t spv_pointer_type(spv_module* m, spv::StorageClass sc, uint32_t pointee)
+{
+    for (const spv_inst& inst : m->insts) {
+        if (inst.op() == spv::OpTypePointer && inst.w[2] == uint32_t(sc) && inst.w[3] == pointee)
+            return inst.w[1];
+    }
+    return spv_insert_after(m, pointee, spv::OpTypePointer, { m->header[3]++, uint32_t(sc), pointee });
+}
+
+uint32_t spv_vector_type(spv_module* m, uint32_t scalar, uint32_t count)
+{
+    for (const spv_inst& inst : m->insts) {
+        if (inst.op() == spv::OpTypeVector && inst.w[2] == scalar && inst.w[3] == count)
+            return inst.w[1];
+    }
+    return spv_insert_after(m, scalar, spv::OpTypeVector, { m->header[3]++, scalar, count });
+}
+
+uint32_t spv_constant(spv_module* m, uint32_t type, uint32_t value)
+{
+    for (const spv_inst& inst : m->insts) {
+        if (inst.op() == spv::OpConstant && inst.w[1] == type && inst.w.size() == 4 && inst.w[3] == value)
+            return inst.w[2];
+    }
+    return spv_insert_after(m, type, spv::OpConstant, { type, m->header[3]++, value });
+}
+
+uint32_t spv_float_zero(spv_module* m, uint32_t float_type)
+{
+    return spv_constant(m, float_type, 0);
+}
+
+void spv_append_string(spv_inst* inst, const char* str)
+{
+    size_t len = strlen(str);
+    for (size_t i = 0; i <= len; i += 4) {
+        uint32_t word = 0;
+        for (size_t k = 0; k < 4 && i + k < len; k++)
+            word |= uint32_t(uint8_t(str[i + k])) << (k * 8);
+        inst->w.push_back(word);
+    }
+    spv_fix_count(inst);
+}
+
+void spv_add_name(spv_module* m, uint32_t id, const char* name)
+{
+    spv_inst inst = spv_make(spv::OpName, { id });
+    spv_append_string(&inst, name);
+    spv_insert_global(m, std::move(inst));
+}
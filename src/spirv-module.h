@@ -0,0 +1,57 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+// Minimal SPIR-V module representation for the passes that rewrite glslang output before cross compiling
+// Instructions are kept as word arrays in module order, new ids are allocated by bumping the id bound
+//
+#pragma once
+
+#ifndef SPV_ENABLE_UTILITY_CODE
+#   define SPV_ENABLE_UTILITY_CODE
+#endif
+#include "SPIRV/spirv.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <initializer_list>
+#include <vector>
+
+struct spv_inst {
+    std::vector<uint32_t> w;
+
+    spv::Op op() const { return spv::Op(w[0] & spv::OpCodeMask); }
+};
+
+struct spv_module {
+    uint32_t              header[5];    // header[3] is the id bound
+    std::vector<spv_inst> insts;
+};
+
+bool spv_parse(spv_module* m, const std::vector<uint32_t>& spirv);
+void spv_write(const spv_module& m, std::vector<uint32_t>* spirv);
+
+// instruction helpers
+void     spv_fix_count(spv_inst* inst);
+spv_inst spv_make(spv::Op op, std::initializer_list<uint32_t> operands);
+uint32_t spv_result_id(const spv_inst& inst);
+size_t   spv_string_words(const spv_inst& inst, size_t start);
+void     spv_append_string(spv_inst* inst, const char* str);
+
+// queries, return instruction indices or -1
+int  spv_find_def(const spv_module& m, uint32_t id);
+int  spv_first_function(const spv_module& m);
+int  spv_entry_point(const spv_module& m);
+int  spv_element_def(const spv_module& m, uint32_t type_id);
+bool spv_decoration(const spv_module& m, uint32_t id, spv::Decoration deco, uint32_t* value = nullptr);
+bool spv_is_builtin(const spv_module& m, uint32_t var_id, uint32_t type_id);
+
+// module edits, types and constants are reused if they already exist
+void     spv_insert_global(spv_module* m, spv_inst inst);
+void     spv_insert_global(spv_module* m, const std::vector<spv_inst>& insts);
+uint32_t spv_insert_after(spv_module* m, uint32_t dep_id, spv::Op op, std::initializer_list<uint32_t> operands);
+uint32_t spv_pointer_type(spv_module* m, spv::StorageClass sc, uint32_t pointee);
+uint32_t spv_vector_type(spv_module* m, uint32_t scalar, uint32_t count);
+uint32_t spv_constant(spv_module* m, uint32_t type, uint32_t value);    // 32bit scalar constant
+uint32_t spv_float_zero(spv_module* m, uint32_t float_type);
+void     spv_add_name(spv_module* m, uint32_t id, const char* name);
@@ -0,0 +1,562 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+#include "stats.h"
+#include "spirv-module.h"
+
+#include "SPIRV/GLSL.std.450.h"
+
+#include "spirv_cross.hpp"
+
+#include <string.h>
+#include <algorithm>
+#include <unordered_map>
+
+struct stats_state {
+    spv_module            m;
+    std::vector<int>      defs;         // instruction index of each id, -1 if it's not defined
+    std::vector<uint32_t> components;   // 32bit components of each type, 0 for pointers and opaque types
+    std::vector<uint32_t> ptr_vars;     // function variable behind each pointer, 0 if there is none
+    std::vector<uint8_t>  memory_vars;  // function variables with dynamic indexing, assumed to be in local memory
+    uint32_t              glsl_ext;
+    int                   first_func;
+};
+
+static bool is_texture_op(spv::Op op)
+{
+    return (op >= spv::OpImageSampleImplicitLod && op <= spv::OpImageRead) ||
+           (op >= spv::OpImageSparseSampleImplicitLod && op <= spv::OpImageSparseDrefGather) ||
+           op == spv::OpImageSparseRead;
+}
+
+static bool is_alu_op(spv::Op op)
+{
+    return op == spv::OpVectorExtractDynamic || op == spv::OpVectorInsertDynamic || op == spv::OpTranspose ||
+           (op >= spv::OpConvertFToU && op <= spv::OpBitcast) ||
+           (op >= spv::OpSNegate && op <= spv::OpSMulExtended) ||
+           (op >= spv::OpAny && op <= spv::OpFUnordGreaterThanEqual) ||
+           (op >= spv::OpShiftRightLogical && op <= spv::OpBitCount) ||
+           (op >= spv::OpDPdx && op <= spv::OpFwidthCoarse);
+}
+
+static bool is_transcendental(uint32_t glsl_op)
+{
+    switch (glsl_op) {
+    case GLSLstd450Sin:
+    case GLSLstd450Cos:
+    case GLSLstd450Tan:
+    case GLSLstd450Asin:
+    case GLSLstd450Acos:
+    case GLSLstd450Atan:
+    case GLSLstd450Sinh:
+    case GLSLstd450Cosh:
+    case GLSLstd450Tanh:
+    case GLSLstd450Asinh:
+    case GLSLstd450Acosh:
+    case GLSLstd450Atanh:
+    case GLSLstd450Atan2:
+    case GLSLstd450Pow:
+    case GLSLstd450Exp:
+    case GLSLstd450Log:
+    case GLSLstd450Exp2:
+    case GLSLstd450Log2:
+    case GLSLstd450Sqrt:
+    case GLSLstd450InverseSqrt:
+    case GLSLstd450Length:
+    case GLSLstd450Distance:
+    case GLSLstd450Normalize:
+    case GLSLstd450Refract:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// instructions that only describe the structure of the code and cost nothing by themselves
+static bool is_structural_op(spv::Op op)
+{
+    switch (op) {
+    case spv::OpFunction:
+    case spv::OpFunctionParameter:
+    case spv::OpFunctionEnd:
+    case spv::OpLabel:
+    case spv::OpVariable:
+    case spv::OpLine:
+    case spv::OpNoLine:
+    case spv::OpSelectionMerge:
+    case spv::OpLoopMerge:
+    case spv::OpBranch:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// ids that are read by an instruction, literal operands of the common instructions are skipped
+static void get_operands(const stats_state& s, const spv_inst& inst, std::vector<uint32_t>* ids)
+{
+    ids->clear();
+    bool has_result, has_type;
+    spv::HasResultAndType(inst.op(), &has_result, &has_type);
+    size_t start = 1 + (has_result ? 1 : 0) + (has_type ? 1 : 0);
+    size_t end = inst.w.size();
+    switch (inst.op()) {
+    case spv::OpExtInst:            start = 5;  break;
+    case spv::OpLoad:               end = 4;    break;
+    case spv::OpStore:              end = 3;    break;
+    case spv::OpCompositeExtract:   end = 4;    break;
+    case spv::OpCompositeInsert:
+    case spv::OpVectorShuffle:      end = 5;    break;
+    case spv::OpBranchConditional:
+    case spv::OpSwitch:             end = 2;    break;
+    case spv::OpLabel:
+    case spv::OpBranch:
+    case spv::OpSelectionMerge:
+    case spv::OpLoopMerge:          return;
+    default:                        break;
+    }
+
+    for (size_t i = start; i < end; i++) {
+        if (inst.w[i] < s.defs.size())
+            ids->push_back(inst.w[i]);
+    }
+}
+
+static uint32_t array_length(const stats_state& s, uint32_t id)
+{
+    int def = s.defs[id];
+    if (def >= 0 && s.m.insts[def].op() == spv::OpConstant)
+        return s.m.insts[def].w[3];
+    return 1;
+}
+
+static void count_components(stats_state* s)
+{
+    for (int i = 0; i < s->first_func; i++) {
+        const spv_inst& inst = s->m.insts[i];
+        uint32_t* c = s->components.data();
+        switch (inst.op()) {
+        case spv::OpTypeBool:
+            c[inst.w[1]] = 1;
+            break;
+        case spv::OpTypeInt:
+        case spv::OpTypeFloat:
+            c[inst.w[1]] = inst.w[2] > 32 ? 2 : 1;
+            break;
+        case spv::OpTypeVector:
+        case spv::OpTypeMatrix:
+            c[inst.w[1]] = c[inst.w[2]] * inst.w[3];
+            break;
+        case spv::OpTypeArray:
+            c[inst.w[1]] = c[inst.w[2]] * array_length(*s, inst.w[3]);
+            break;
+        case spv::OpTypeStruct:
+            for (size_t k = 2; k < inst.w.size(); k++)
+                c[inst.w[1]] += c[inst.w[k]];
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+// marks the values that are computed from texture results, through temporaries and function variables,
+// and counts the texture instructions that use one of them as coordinates
+static uint32_t count_dependent_textures(const stats_state& s)
+{
+    std::vector<uint8_t> tainted(s.defs.size(), 0);
+    std::vector<uint32_t> ops;
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t i = s.first_func; i < s.m.insts.size(); i++) {
+            const spv_inst& inst = s.m.insts[i];
+            uint32_t id = spv_result_id(inst);
+            uint8_t taint = 0;
+            if (inst.op() == spv::OpStore) {
+                uint32_t var = s.ptr_vars[inst.w[1]];
+                if (var && tainted[inst.w[2]] && !tainted[var]) {
+                    tainted[var] = 1;
+                    changed = true;
+                }
+                continue;
+            } else if (inst.op() == spv::OpLoad) {
+                uint32_t var = s.ptr_vars[inst.w[3]];
+                taint = var && tainted[var];
+            } else if (is_texture_op(inst.op())) {
+                taint = 1;
+            } else if (id && inst.op() != spv::OpVariable && inst.op() != spv::OpAccessChain &&
+                       inst.op() != spv::OpInBoundsAccessChain) {
+                get_operands(s, inst, &ops);
+                for (uint32_t op : ops)
+                    taint |= tainted[op];
+            }
+
+            if (id && taint && !tainted[id]) {
+                tainted[id] = 1;
+                changed = true;
+            }
+        }
+    }
+
+    uint32_t count = 0;
+    for (size_t i = s.first_func; i < s.m.insts.size(); i++) {
+        const spv_inst& inst = s.m.insts[i];
+        if (is_texture_op(inst.op()) && tainted[inst.w[4]])
+            count++;
+    }
+    return count;
+}
+
+struct live_block {
+    size_t                begin;
+    size_t                end;          // one past the terminator
+    std::vector<int>      succs;
+    std::vector<uint64_t> gen;          // live range globals read before they are written in the block
+    std::vector<uint64_t> kill;
+    std::vector<uint64_t> live_in;
+    std::vector<uint64_t> live_out;
+};
+
+static void set_bit(std::vector<uint64_t>& bits, int index)
+{
+    bits[index >> 6] |= uint64_t(1) << (index & 63);
+}
+
+static bool test_bit(const std::vector<uint64_t>& bits, int index)
+{
+    return (bits[index >> 6] >> (index & 63)) & 1;
+}
+
+struct live_values {
+    std::vector<int>      index;        // value index of each id in the current function, -1 if it's not a value
+    std::vector<uint32_t> ids;
+    std::vector<uint32_t> weights;      // 32bit components
+    std::vector<int>      def_block;    // -1 for variables
+    std::vector<int>      global;       // index in the block bitsets, -1 for values local to their block
+};
+
+// values that an instruction reads and writes
+// writes through access chains count as writes of the whole variable, which underestimates the pressure of
+// partially updated variables but doesn't keep variables alive from the start of the function
+static void get_uses_defs(const stats_state& s, const live_values& v, const spv_inst& inst,
+                          std::vector<uint32_t>* ops, std::vector<int>* uses, std::vector<int>* defs)
+{
+    uses->clear();
+    defs->clear();
+    switch (inst.op()) {
+    case spv::OpStore: {
+        uint32_t var = s.ptr_vars[inst.w[1]];
+        if (v.index[inst.w[2]] >= 0)
+            uses->push_back(v.index[inst.w[2]]);
+        if (var && v.index[var] >= 0)
+            defs->push_back(v.index[var]);
+        return;
+    }
+    case spv::OpLoad: {
+        uint32_t var = s.ptr_vars[inst.w[3]];
+        if (var && v.index[var] >= 0)
+            uses->push_back(v.index[var]);
+        break;
+    }
+    case spv::OpVariable:
+        return;
+    case spv::OpAccessChain:
+    case spv::OpInBoundsAccessChain:
+        for (size_t i = 4; i < inst.w.size(); i++) {
+            if (v.index[inst.w[i]] >= 0)
+                uses->push_back(v.index[inst.w[i]]);
+        }
+        return;
+    default:
+        get_operands(s, inst, ops);
+        for (uint32_t op : *ops) {
+            if (v.index[op] >= 0)
+                uses->push_back(v.index[op]);
+        }
+        break;
+    }
+
+    uint32_t id = spv_result_id(inst);
+    if (id && v.index[id] >= 0)
+        defs->push_back(v.index[id]);
+}
+
+// peak number of live components in a function, liveness is solved on the values that live across blocks
+// and the values local to a block are added while walking the block backwards
+static uint32_t function_pressure(const stats_state& s, size_t begin, size_t end, live_values* v)
+{
+    std::vector<live_block> blocks;
+    std::unordered_map<uint32_t, int> label_blocks;
+    for (size_t i = begin; i < end; i++) {
+        const spv_inst& inst = s.m.insts[i];
+        if (inst.op() == spv::OpLabel) {
+            live_block b = {};
+            b.begin = i + 1;
+            label_blocks[inst.w[1]] = int(blocks.size());
+            blocks.push_back(b);
+        } else if (!blocks.empty() && blocks.back().end == 0 &&
+                   (inst.op() == spv::OpBranch || inst.op() == spv::OpBranchConditional ||
+                    inst.op() == spv::OpSwitch || inst.op() == spv::OpReturn ||
+                    inst.op() == spv::OpReturnValue || inst.op() == spv::OpKill ||
+                    inst.op() == spv::OpUnreachable)) {
+            blocks.back().end = i + 1;
+        }
+    }
+    if (blocks.empty())
+        return 0;
+
+    for (size_t b = 0; b < blocks.size(); b++) {
+        live_block& block = blocks[b];
+        if (block.end == 0)
+            block.end = block.begin;
+        const spv_inst& term = s.m.insts[block.end - 1];
+        std::vector<uint32_t> targets;
+        if (term.op() == spv::OpBranch) {
+            targets.push_back(term.w[1]);
+        } else if (term.op() == spv::OpBranchConditional) {
+            targets.push_back(term.w[2]);
+            targets.push_back(term.w[3]);
+        } else if (term.op() == spv::OpSwitch) {
+            targets.push_back(term.w[2]);
+            for (size_t k = 4; k < term.w.size(); k += 2)
+                targets.push_back(term.w[k]);
+        }
+        for (uint32_t t : targets) {
+            auto it = label_blocks.find(t);
+            int succ = it != label_blocks.end() ? it->second : -1;
+            if (succ >= 0 && std::find(block.succs.begin(), block.succs.end(), succ) == block.succs.end())
+                block.succs.push_back(succ);
+        }
+    }
+
+    // values: parameters, temporaries and function variables that are kept in registers
+    v->ids.clear();
+    v->weights.clear();
+    v->def_block.clear();
+    v->global.clear();
+    auto add_value = [&](uint32_t id, uint32_t weight, int block) {
+        v->index[id] = int(v->ids.size());
+        v->ids.push_back(id);
+        v->weights.push_back(weight);
+        v->def_block.push_back(block);
+        v->global.push_back(-1);
+    };
+    int block = 0;
+    for (size_t i = begin; i < end; i++) {
+        const spv_inst& inst = s.m.insts[i];
+        if (inst.op() == spv::OpLabel && i >= blocks[0].begin)
+            block++;
+        if (inst.op() == spv::OpVariable) {
+            int ptr_type = s.defs[inst.w[1]];
+            if (ptr_type >= 0 && s.components[s.m.insts[ptr_type].w[3]] && !s.memory_vars[inst.w[2]])
+                add_value(inst.w[2], s.components[s.m.insts[ptr_type].w[3]], -1);
+        } else if (inst.op() != spv::OpFunction) {
+            bool has_result, has_type;
+            spv::HasResultAndType(inst.op(), &has_result, &has_type);
+            if (has_result && has_type && s.components[inst.w[1]])
+                add_value(inst.w[2], s.components[inst.w[1]], block);
+        }
+    }
+
+    // values that are used outside of the block they are defined in need the global liveness
+    std::vector<uint32_t> ops;
+    std::vector<int> uses, defs;
+    int num_globals = 0;
+    for (size_t b = 0; b < blocks.size(); b++) {
+        for (size_t i = blocks[b].begin; i < blocks[b].end; i++) {
+            const spv_inst& inst = s.m.insts[i];
+            get_uses_defs(s, *v, inst, &ops, &uses, &defs);
+            for (int u : uses) {
+                if (v->global[u] < 0 &&
+                    (v->def_block[u] != int(b) || inst.op() == spv::OpPhi)) {
+                    v->global[u] = num_globals++;
+                }
+            }
+        }
+    }
+
+    size_t num_words = (num_globals + 63) / 64;
+    for (live_block& b : blocks) {
+        b.gen.resize(num_words, 0);
+        b.kill.resize(num_words, 0);
+        b.live_in.resize(num_words, 0);
+        b.live_out.resize(num_words, 0);
+        for (size_t i = b.begin; i < b.end; i++) {
+            get_uses_defs(s, *v, s.m.insts[i], &ops, &uses, &defs);
+            for (int u : uses) {
+                int g = v->global[u];
+                if (g >= 0 && !test_bit(b.kill, g))
+                    set_bit(b.gen, g);
+            }
+            for (int d : defs) {
+                if (v->global[d] >= 0)
+                    set_bit(b.kill, v->global[d]);
+            }
+        }
+    }
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t b = blocks.size(); b-- > 0;) {
+            live_block& block = blocks[b];
+            for (int succ : block.succs) {
+                for (size_t k = 0; k < num_words; k++)
+                    block.live_out[k] |= blocks[succ].live_in[k];
+            }
+            for (size_t k = 0; k < num_words; k++) {
+                uint64_t live_in = block.gen[k] | (block.live_out[k] & ~block.kill[k]);
+                if (live_in != block.live_in[k]) {
+                    block.live_in[k] = live_in;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    std::vector<int> global_values(num_globals);
+    for (size_t i = 0; i < v->ids.size(); i++) {
+        if (v->global[i] >= 0)
+            global_values[v->global[i]] = int(i);
+    }
+
+    uint32_t peak = 0;
+    std::vector<uint8_t> live(v->ids.size(), 0);
+    std::vector<int> touched;
+    for (const live_block& b : blocks) {
+        uint32_t cur = 0;
+        touched.clear();
+        for (int g = 0; g < num_globals; g++) {
+            if (test_bit(b.live_out, g)) {
+                live[global_values[g]] = 1;
+                touched.push_back(global_values[g]);
+                cur += v->weights[global_values[g]];
+            }
+        }
+        peak = std::max(peak, cur);
+
+        for (size_t i = b.end; i-- > b.begin;) {
+            get_uses_defs(s, *v, s.m.insts[i], &ops, &uses, &defs);
+            for (int d : defs) {
+                // a result that is never read still takes its registers while it's written
+                if (!live[d])
+                    peak = std::max(peak, cur + v->weights[d]);
+                else
+                    cur -= v->weights[d];
+                live[d] = 0;
+            }
+            for (int u : uses) {
+                if (!live[u]) {
+                    live[u] = 1;
+                    touched.push_back(u);
+                    cur += v->weights[u];
+                }
+            }
+            peak = std::max(peak, cur);
+        }
+
+        for (int t : touched)
+            live[t] = 0;
+    }
+
+    for (uint32_t id : v->ids)
+        v->index[id] = -1;
+    return peak;
+}
+
+static void count_uniforms(const std::vector<uint32_t>& spirv, shader_stats* st)
+{
+    try {
+        spirv_cross::Compiler compiler(spirv.data(), spirv.size());
+        spirv_cross::ShaderResources ress = compiler.get_shader_resources();
+        std::vector<spirv_cross::Resource> buffers(ress.uniform_buffers.begin(), ress.uniform_buffers.end());
+        buffers.insert(buffers.end(), ress.push_constant_buffers.begin(), ress.push_constant_buffers.end());
+        for (const spirv_cross::Resource& res : buffers) {
+            const spirv_cross::SPIRType& type = compiler.get_type(res.type_id);
+            uint32_t size = uint32_t(compiler.get_declared_struct_size(compiler.get_type(res.base_type_id)));
+            for (uint32_t dim : type.array)
+                size *= std::max(dim, 1u);
+            st->num_uniform_buffers++;
+            st->uniform_bytes += size;
+        }
+    } catch (const std::exception&) {
+    }
+}
+
+bool stats_gather(const std::vector<uint32_t>& spirv, shader_stats* st)
+{
+    memset(st, 0x0, sizeof(shader_stats));
+
+    stats_state s;
+    if (!spv_parse(&s.m, spirv))
+        return false;
+
+    uint32_t bound = s.m.header[3];
+    s.defs.assign(bound, -1);
+    s.components.assign(bound, 0);
+    s.ptr_vars.assign(bound, 0);
+    s.memory_vars.assign(bound, 0);
+    s.glsl_ext = 0;
+    s.first_func = spv_first_function(s.m);
+    for (size_t i = 0; i < s.m.insts.size(); i++) {
+        const spv_inst& inst = s.m.insts[i];
+        uint32_t id = spv_result_id(inst);
+        if (id)
+            s.defs[id] = int(i);
+        if (inst.op() == spv::OpExtInstImport && strcmp((const char*)&inst.w[2], "GLSL.std.450") == 0)
+            s.glsl_ext = inst.w[1];
+        else if (inst.op() == spv::OpVariable && inst.w[3] == spv::StorageClassFunction)
+            s.ptr_vars[inst.w[2]] = inst.w[2];
+        else if (inst.op() == spv::OpAccessChain || inst.op() == spv::OpInBoundsAccessChain) {
+            uint32_t var = s.ptr_vars[inst.w[3]];
+            s.ptr_vars[inst.w[2]] = var;
+            for (size_t k = 4; k < inst.w.size() && var; k++) {
+                int index = s.defs[inst.w[k]];
+                if (index < 0 || s.m.insts[index].op() != spv::OpConstant)
+                    s.memory_vars[var] = 1;
+            }
+        }
+    }
+    count_components(&s);
+
+    for (size_t i = s.first_func; i < s.m.insts.size(); i++) {
+        const spv_inst& inst = s.m.insts[i];
+        spv::Op op = inst.op();
+        if (is_structural_op(op)) {
+            st->num_loops += op == spv::OpLoopMerge ? 1 : 0;
+            continue;
+        }
+
+        st->num_instructions++;
+        if (is_texture_op(op)) {
+            st->num_texture++;
+        } else if (op == spv::OpBranchConditional || op == spv::OpSwitch) {
+            st->num_branches++;
+        } else if (op == spv::OpExtInst && inst.w[3] == s.glsl_ext) {
+            if (is_transcendental(inst.w[4]))
+                st->num_transcendental++;
+            else
+                st->num_alu++;
+        } else if (is_alu_op(op)) {
+            st->num_alu++;
+        }
+    }
+    st->num_dependent_texture = count_dependent_textures(s);
+
+    live_values v;
+    v.index.assign(bound, -1);
+    for (size_t i = s.first_func; i < s.m.insts.size(); i++) {
+        if (s.m.insts[i].op() != spv::OpFunction)
+            continue;
+        size_t end = i;
+        while (end < s.m.insts.size() && s.m.insts[end].op() != spv::OpFunctionEnd)
+            end++;
+        st->max_live_components = std::max(st->max_live_components, function_pressure(s, i, end, &v));
+        i = end;
+    }
+
+    count_uniforms(spirv, st);
+    return true;
+}
@@ -0,0 +1,27 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+// Static shader cost report: counts instructions of the SPIR-V that is handed to the cross compiler
+// The numbers are estimates for comparing shaders and permutations, not a replacement for vendor tools
+//
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+struct shader_stats {
+    uint32_t num_instructions;      // instructions in function bodies, excluding labels, variables and merges
+    uint32_t num_alu;               // arithmetic, conversion, compare, logical and derivative instructions
+    uint32_t num_transcendental;    // sin/cos/pow/exp/log/sqrt/normalize ... (GLSL.std.450)
+    uint32_t num_texture;           // image samples, fetches, gathers and reads
+    uint32_t num_dependent_texture; // texture instructions with coordinates computed from another texture result
+    uint32_t num_branches;          // conditional branches and switches
+    uint32_t num_loops;
+    uint32_t max_live_components;   // peak number of live 32bit components, estimates the register pressure
+    uint32_t num_uniform_buffers;   // uniform buffers and push constants
+    uint32_t uniform_bytes;         // declared size of uniform buffers and push constants
+};
+
+// Returns false if the module can't be parsed
+bool stats_gather(const std::vector<uint32_t>& spirv, shader_stats* st);
@@ -0,0 +1,712 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+#include "ubo-layout.h"
+#include "spirv-module.h"
+
+#include <ctype.h>
+#include <string.h>
+#include <algorithm>
+
+struct ubo_member {
+    uint32_t      index;    // index in the declared struct
+    uint32_t      align;
+    uint32_t      size;
+    uint32_t      offset;
+    ubo_frequency freq;
+};
+
+struct ubo_context {
+    const spv_module*     m;
+    std::vector<int>      defs;
+    std::vector<uint32_t> array_strides;
+};
+
+static bool contains_nocase(const char* str, const char* sub)
+{
+    size_t len = strlen(sub);
+    for (; *str; str++) {
+        size_t i = 0;
+        while (i < len && tolower((unsigned char)str[i]) == sub[i])
+            i++;
+        if (i == len)
+            return true;
+    }
+    return false;
+}
+
+ubo_frequency ubo_frequency_from_name(const char* name)
+{
+    if (contains_nocase(name, "frame"))
+        return UBO_FREQUENCY_FRAME;
+    if (contains_nocase(name, "material"))
+        return UBO_FREQUENCY_MATERIAL;
+    if (contains_nocase(name, "draw") || contains_nocase(name, "object") || contains_nocase(name, "instance"))
+        return UBO_FREQUENCY_DRAW;
+    return UBO_FREQUENCY_NONE;
+}
+
+const char* ubo_frequency_str(ubo_frequency freq)
+{
+    static const char* k_names[UBO_FREQUENCY_COUNT] = { "frame", "material", "draw", "none" };
+    return k_names[freq];
+}
+
+static uint32_t align_up(uint32_t value, uint32_t align)
+{
+    return (value + align - 1) / align * align;
+}
+
+static void init_context(ubo_context* ctx, const spv_module& m, std::vector<uint32_t>* types)
+{
+    ctx->m = &m;
+    ctx->defs.assign(m.header[3], -1);
+    ctx->array_strides.assign(m.header[3], 0);
+    types->assign(m.header[3], 0);
+    for (size_t i = 0; i < m.insts.size(); i++) {
+        const spv_inst& inst = m.insts[i];
+        bool has_result, has_type;
+        spv::HasResultAndType(inst.op(), &has_result, &has_type);
+        if (has_result)
+            ctx->defs[inst.w[has_type ? 2 : 1]] = int(i);
+        if (has_result && has_type)
+            (*types)[inst.w[2]] = inst.w[1];
+        if (inst.op() == spv::OpDecorate && inst.w[2] == spv::DecorationArrayStride)
+            ctx->array_strides[inst.w[1]] = inst.w[3];
+    }
+}
+
+static const spv_inst* get_def(const ubo_context& ctx, uint32_t id)
+{
+    return id < ctx.defs.size() && ctx.defs[id] >= 0 ? &ctx.m->insts[ctx.defs[id]] : nullptr;
+}
+
+static const char* get_name(const spv_module& m, uint32_t id)
+{
+    for (const spv_inst& inst : m.insts) {
+        if (inst.op() == spv::OpName && inst.w[1] == id)
+            return (const char*)&inst.w[2];
+    }
+    return "";
+}
+
+static bool member_decoration(const spv_module& m, uint32_t struct_id, uint32_t index, spv::Decoration deco,
+                              uint32_t* value = nullptr)
+{
+    for (const spv_inst& inst : m.insts) {
+        if (inst.op() == spv::OpMemberDecorate && inst.w[1] == struct_id && inst.w[2] == index &&
+            inst.w[3] == uint32_t(deco)) {
+            if (value)
+                *value = inst.w.size() > 4 ? inst.w[4] : 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+// std140 alignment and size, matrix_stride is the MatrixStride decoration of the struct member
+static bool type_layout(const ubo_context& ctx, uint32_t type_id, uint32_t matrix_stride, bool row_major,
+                        uint32_t* align, uint32_t* size)
+{
+    const spv_inst* def = get_def(ctx, type_id);
+    if (!def)
+        return false;
+
+    switch (def->op()) {
+    case spv::OpTypeInt:
+    case spv::OpTypeFloat:
+        if (def->w[2] != 32 && def->w[2] != 64)
+            return false;
+        *align = *size = def->w[2] / 8;
+        return true;
+    case spv::OpTypeVector: {
+        uint32_t comp_align, comp_size;
+        if (!type_layout(ctx, def->w[2], 0, false, &comp_align, &comp_size))
+            return false;
+        *size = comp_size * def->w[3];
+        *align = comp_size * (def->w[3] == 3 ? 4 : def->w[3]);
+        return true;
+    }
+    case spv::OpTypeMatrix: {
+        const spv_inst* column = get_def(ctx, def->w[2]);
+        if (!matrix_stride || !column)
+            return false;
+        *size = matrix_stride * (row_major ? column->w[3] : def->w[3]);
+        *align = matrix_stride;
+        return true;
+    }
+    case spv::OpTypeArray: {
+        const spv_inst* length = get_def(ctx, def->w[3]);
+        uint32_t elem_align, elem_size;
+        if (!length || length->op() != spv::OpConstant || !ctx.array_strides[type_id] ||
+            !type_layout(ctx, def->w[2], matrix_stride, row_major, &elem_align, &elem_size)) {
+            return false;
+        }
+        *size = ctx.array_strides[type_id] * length->w[3];
+        *align = std::max(elem_align, 16u);
+        return true;
+    }
+    case spv::OpTypeStruct: {
+        // nested structs keep their own layout
+        uint32_t max_align = 16, end = 0;
+        for (uint32_t i = 0; i < def->w.size() - 2; i++) {
+            uint32_t offset, mstride = 0, malign, msize;
+            if (!member_decoration(*ctx.m, type_id, i, spv::DecorationOffset, &offset))
+                return false;
+            member_decoration(*ctx.m, type_id, i, spv::DecorationMatrixStride, &mstride);
+            if (!type_layout(ctx, def->w[2 + i], mstride,
+                             member_decoration(*ctx.m, type_id, i, spv::DecorationRowMajor), &malign, &msize)) {
+                return false;
+            }
+            max_align = std::max(max_align, malign);
+            end = std::max(end, offset + msize);
+        }
+        *align = max_align;
+        *size = align_up(end, max_align);
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+// members of a block in declaration order, false if the block doesn't follow std140 rules
+static bool get_block_members(const ubo_context& ctx, uint32_t struct_id, std::vector<ubo_member>* members)
+{
+    const spv_inst& def = *get_def(ctx, struct_id);
+    uint32_t end = 0;
+    for (uint32_t i = 0; i < def.w.size() - 2; i++) {
+        ubo_member mem = { i, 0, 0, 0, UBO_FREQUENCY_NONE };
+        uint32_t mstride = 0;
+        if (!member_decoration(*ctx.m, struct_id, i, spv::DecorationOffset, &mem.offset))
+            return false;
+        member_decoration(*ctx.m, struct_id, i, spv::DecorationMatrixStride, &mstride);
+        if (!type_layout(ctx, def.w[2 + i], mstride, member_decoration(*ctx.m, struct_id, i, spv::DecorationRowMajor),
+                         &mem.align, &mem.size)) {
+            return false;
+        }
+        if (align_up(end, mem.align) != mem.offset)
+            return false;
+        end = mem.offset + mem.size;
+        members->push_back(mem);
+    }
+
+    for (const spv_inst& inst : ctx.m->insts) {
+        if (inst.op() == spv::OpMemberName && inst.w[1] == struct_id && inst.w[2] < members->size())
+            (*members)[inst.w[2]].freq = ubo_frequency_from_name((const char*)&inst.w[3]);
+    }
+    return true;
+}
+
+static uint32_t block_size(const std::vector<ubo_member>& members)
+{
+    uint32_t size = 0;
+    for (const ubo_member& mem : members)
+        size = std::max(size, mem.offset + mem.size);
+    return size;
+}
+
+// frequency groups in order, each sorted by alignment, smaller members fill the holes in front of bigger ones
+static std::vector<ubo_member> pack_members(const std::vector<ubo_member>& members)
+{
+    std::vector<ubo_member> pending(members);
+    std::stable_sort(pending.begin(), pending.end(), [](const ubo_member& a, const ubo_member& b) {
+        return a.freq != b.freq ? a.freq < b.freq : a.align > b.align;
+    });
+
+    std::vector<ubo_member> packed;
+    uint32_t offset = 0;
+    while (!pending.empty()) {
+        size_t pick = 0;
+        uint32_t aligned = align_up(offset, pending[0].align);
+        for (size_t i = 1; i < pending.size() && aligned != offset && pending[i].freq == pending[0].freq; i++) {
+            if (align_up(offset, pending[i].align) + pending[i].size <= aligned) {
+                pick = i;
+                break;
+            }
+        }
+
+        ubo_member mem = pending[pick];
+        mem.offset = align_up(offset, mem.align);
+        offset = mem.offset + mem.size;
+        packed.push_back(mem);
+        pending.erase(pending.begin() + pick);
+    }
+    return packed;
+}
+
+// block structs that are only used through Uniform pointers can be reordered
+static bool is_block_reorderable(const ubo_context& ctx, uint32_t struct_id)
+{
+    for (const spv_inst& inst : ctx.m->insts) {
+        bool has_result, has_type;
+        spv::HasResultAndType(inst.op(), &has_result, &has_type);
+        if (has_type && inst.w[1] == struct_id)
+            return false;
+        if (inst.op() == spv::OpTypeStruct &&
+            std::find(inst.w.begin() + 2, inst.w.end(), struct_id) != inst.w.end()) {
+            return false;
+        }
+        if (inst.op() == spv::OpTypePointer && inst.w[3] == struct_id && inst.w[2] != spv::StorageClassUniform)
+            return false;
+    }
+    return true;
+}
+
+// walks the indices of access chains, calls fn(operand_index, new_member_index) for the indices of reordered structs
+template <typename Fn>
+static void remap_access_chains(const ubo_context& ctx, const std::vector<uint32_t>& types,
+                                const std::vector<std::vector<uint32_t>>& remaps, Fn fn)
+{
+    for (size_t i = 0; i < ctx.m->insts.size(); i++) {
+        const spv_inst& inst = ctx.m->insts[i];
+        spv::Op op = inst.op();
+        if (op != spv::OpAccessChain && op != spv::OpInBoundsAccessChain && op != spv::OpPtrAccessChain &&
+            op != spv::OpInBoundsPtrAccessChain) {
+            continue;
+        }
+
+        const spv_inst* ptr_type = get_def(ctx, inst.w[3] < types.size() ? types[inst.w[3]] : 0);
+        if (!ptr_type || ptr_type->op() != spv::OpTypePointer)
+            continue;
+        uint32_t type_id = ptr_type->w[3];
+        size_t first = (op == spv::OpPtrAccessChain || op == spv::OpInBoundsPtrAccessChain) ? 5 : 4;
+        for (size_t k = first; k < inst.w.size(); k++) {
+            const spv_inst* def = get_def(ctx, type_id);
+            if (!def)
+                break;
+            if (def->op() == spv::OpTypeStruct) {
+                const spv_inst* index = get_def(ctx, inst.w[k]);
+                if (!index || index->op() != spv::OpConstant)
+                    break;
+                uint32_t member = index->w[3];
+                if (type_id < remaps.size() && !remaps[type_id].empty())
+                    fn(i, k, index->w[1], remaps[type_id][member]);
+                type_id = def->w[2 + member];
+            } else {
+                type_id = def->w[2];
+            }
+        }
+    }
+}
+
+bool ubo_optimize_layout(std::vector<uint32_t>& spirv, std::vector<ubo_layout_report>* reports)
+{
+    spv_module m;
+    if (!spv_parse(&m, spirv))
+        return false;
+
+    ubo_context ctx;
+    std::vector<uint32_t> types;
+    init_context(&ctx, m, &types);
+
+    // remaps[struct_id][old_index] = new_index
+    std::vector<std::vector<uint32_t>> remaps(m.header[3]);
+    std::vector<std::vector<ubo_member>> layouts(m.header[3]);
+    for (const spv_inst& inst : m.insts) {
+        if (inst.op() != spv::OpVariable || inst.w[3] != spv::StorageClassUniform)
+            continue;
+
+        const spv_inst* ptr_type = get_def(ctx, inst.w[1]);
+        uint32_t struct_id = ptr_type ? ptr_type->w[3] : 0;
+        const spv_inst* def = get_def(ctx, struct_id);
+        while (def && (def->op() == spv::OpTypeArray || def->op() == spv::OpTypeRuntimeArray)) {
+            struct_id = def->w[2];
+            def = get_def(ctx, struct_id);
+        }
+        if (!def || def->op() != spv::OpTypeStruct || !remaps[struct_id].empty() ||
+            !spv_decoration(m, struct_id, spv::DecorationBlock) || !is_block_reorderable(ctx, struct_id)) {
+            continue;
+        }
+
+        std::vector<ubo_member> members;
+        if (!get_block_members(ctx, struct_id, &members) || members.size() < 2)
+            continue;
+        std::vector<ubo_member> packed = pack_members(members);
+
+        uint32_t old_size = block_size(members);
+        uint32_t new_size = block_size(packed);
+        bool reordered = false;
+        for (size_t i = 0; i < packed.size(); i++)
+            reordered |= packed[i].index != i;
+        if (!reordered || new_size > old_size)
+            continue;
+
+        remaps[struct_id].resize(packed.size());
+        for (size_t i = 0; i < packed.size(); i++)
+            remaps[struct_id][packed[i].index] = uint32_t(i);
+        layouts[struct_id] = packed;
+
+        if (reports) {
+            ubo_layout_report report;
+            report.name = get_name(m, struct_id);
+            report.old_size = old_size;
+            report.new_size = new_size;
+            reports->push_back(report);
+        }
+    }
+
+    // create the new index constants first, inserting them moves the instructions
+    std::vector<std::pair<uint32_t, uint32_t>> constants;
+    remap_access_chains(ctx, types, remaps, [&](size_t, size_t, uint32_t type, uint32_t index) {
+        constants.push_back(std::make_pair(type, index));
+    });
+    for (const std::pair<uint32_t, uint32_t>& c : constants)
+        spv_constant(&m, c.first, c.second);
+
+    for (size_t i = 0; i < m.insts.size(); i++) {
+        uint32_t id = spv_result_id(m.insts[i]);
+        if (id >= ctx.defs.size()) {
+            ctx.defs.resize(id + 1, -1);
+            types.resize(id + 1, 0);
+        }
+        if (id)
+            ctx.defs[id] = int(i);
+    }
+
+    std::vector<std::pair<size_t, size_t>> operands;
+    std::vector<uint32_t> values;
+    remap_access_chains(ctx, types, remaps, [&](size_t inst_index, size_t operand, uint32_t type, uint32_t index) {
+        operands.push_back(std::make_pair(inst_index, operand));
+        values.push_back(spv_constant(&m, type, index));
+    });
+    for (size_t i = 0; i < operands.size(); i++)
+        m.insts[operands[i].first].w[operands[i].second] = values[i];
+
+    for (spv_inst& inst : m.insts) {
+        spv::Op op = inst.op();
+        if (op == spv::OpTypeStruct && !remaps[inst.w[1]].empty()) {
+            const std::vector<ubo_member>& layout = layouts[inst.w[1]];
+            std::vector<uint32_t> members(inst.w.begin() + 2, inst.w.end());
+            for (size_t i = 0; i < layout.size(); i++)
+                inst.w[2 + i] = members[layout[i].index];
+        } else if ((op == spv::OpMemberName || op == spv::OpMemberDecorate || op == spv::OpMemberDecorateString) &&
+                   !remaps[inst.w[1]].empty()) {
+            uint32_t index = remaps[inst.w[1]][inst.w[2]];
+            inst.w[2] = index;
+            if (op == spv::OpMemberDecorate && inst.w[3] == spv::DecorationOffset)
+                inst.w[4] = layouts[inst.w[1]][index].offset;
+        }
+    }
+
+    spv_write(m, &spirv);
+    return true;
+}
+
+// uniform variables that are only used as the base of access chains with a constant member index
+static bool is_var_splittable(const ubo_context& ctx, uint32_t var_id)
+{
+    for (const spv_inst& inst : ctx.m->insts) {
+        switch (inst.op()) {
+        case spv::OpAccessChain:
+        case spv::OpInBoundsAccessChain:
+            if (inst.w[3] == var_id) {
+                const spv_inst* index = inst.w.size() > 4 ? get_def(ctx, inst.w[4]) : nullptr;
+                if (!index || index->op() != spv::OpConstant)
+                    return false;
+            }
+            break;
+        case spv::OpLoad:
+        case spv::OpPtrAccessChain:
+        case spv::OpInBoundsPtrAccessChain:
+        case spv::OpCopyObject:
+        case spv::OpArrayLength:
+            if (inst.w[3] == var_id)
+                return false;
+            break;
+        case spv::OpStore:
+        case spv::OpCopyMemory:
+            if (inst.w[1] == var_id || inst.w[2] == var_id)
+                return false;
+            break;
+        case spv::OpFunctionCall:
+        case spv::OpPhi:
+        case spv::OpSelect:
+            if (std::find(inst.w.begin() + 3, inst.w.end(), var_id) != inst.w.end())
+                return false;
+            break;
+        default:
+            break;
+        }
+    }
+    return true;
+}
+
+void ubo_reserve_bindings(const std::vector<uint32_t>& spirv, ubo_split_bindings* bindings)
+{
+    spv_module m;
+    if (!spv_parse(&m, spirv))
+        return;
+
+    for (const spv_inst& inst : m.insts) {
+        if (inst.op() != spv::OpVariable || inst.w[3] != spv::StorageClassUniform)
+            continue;
+        uint32_t binding;
+        if (spv_decoration(m, inst.w[2], spv::DecorationBinding, &binding))
+            bindings->next = std::max(bindings->next, binding + 1);
+    }
+}
+
+bool ubo_split_by_frequency(std::vector<uint32_t>& spirv, ubo_split_bindings* bindings,
+                            std::vector<ubo_split_part>* parts)
+{
+    spv_module m;
+    if (!spv_parse(&m, spirv))
+        return false;
+
+    ubo_context ctx;
+    std::vector<uint32_t> types;
+    init_context(&ctx, m, &types);
+
+    struct split_block {
+        uint32_t                          var_id;
+        uint32_t                          ptr_id;
+        uint32_t                          struct_id;
+        std::vector<ubo_member>           members;     // part_members[part][i] indexes this array
+        std::vector<std::vector<size_t>>  part_members;
+        std::vector<ubo_frequency>        part_freqs;
+        std::vector<uint32_t>             part_vars;
+    };
+    std::vector<split_block> blocks;
+
+    for (const spv_inst& inst : m.insts) {
+        if (inst.op() != spv::OpVariable || inst.w[3] != spv::StorageClassUniform)
+            continue;
+
+        const spv_inst* ptr_type = get_def(ctx, inst.w[1]);
+        uint32_t struct_id = ptr_type ? ptr_type->w[3] : 0;
+        const spv_inst* def = get_def(ctx, struct_id);
+        if (!def || def->op() != spv::OpTypeStruct || !spv_decoration(m, struct_id, spv::DecorationBlock) ||
+            !*get_name(m, struct_id) || !is_block_reorderable(ctx, struct_id) || !is_var_splittable(ctx, inst.w[2])) {
+            continue;
+        }
+
+        split_block block;
+        block.var_id = inst.w[2];
+        block.ptr_id = inst.w[1];
+        block.struct_id = struct_id;
+        if (!get_block_members(ctx, struct_id, &block.members))
+            continue;
+
+        // members without a frequency in their name take the frequency of the block
+        ubo_frequency block_freq = ubo_frequency_from_name(get_name(m, struct_id));
+        if (block_freq == UBO_FREQUENCY_NONE)
+            block_freq = ubo_frequency_from_name(get_name(m, block.var_id));
+        block.part_members.resize(UBO_FREQUENCY_COUNT);
+        for (size_t i = 0; i < block.members.size(); i++) {
+            ubo_frequency freq = block.members[i].freq != UBO_FREQUENCY_NONE ? block.members[i].freq : block_freq;
+            block.part_members[freq].push_back(i);
+        }
+        for (int freq = 0; freq < UBO_FREQUENCY_COUNT; freq++) {
+            if (!block.part_members[freq].empty())
+                block.part_freqs.push_back(ubo_frequency(freq));
+        }
+        if (block.part_freqs.size() < 2)
+            continue;
+
+        block.part_members.erase(std::remove_if(block.part_members.begin(), block.part_members.end(),
+                                                [](const std::vector<size_t>& p) { return p.empty(); }),
+                                 block.part_members.end());
+        blocks.push_back(block);
+    }
+
+    if (blocks.empty())
+        return true;
+
+    // old member index -> (part, new index)
+    std::vector<std::vector<uint32_t>> block_parts(blocks.size()), block_indices(blocks.size());
+    for (size_t b = 0; b < blocks.size(); b++) {
+        split_block& block = blocks[b];
+        block_parts[b].resize(block.members.size());
+        block_indices[b].resize(block.members.size());
+        for (size_t p = 0; p < block.part_members.size(); p++) {
+            for (size_t i = 0; i < block.part_members[p].size(); i++) {
+                block_parts[b][block.part_members[p][i]] = uint32_t(p);
+                block_indices[b][block.part_members[p][i]] = uint32_t(i);
+            }
+        }
+    }
+
+    // ids of the parts are struct, pointer, variable
+    for (split_block& block : blocks) {
+        for (size_t p = 0; p < block.part_members.size(); p++)
+            block.part_vars.push_back(m.header[3] + uint32_t(p) * 3 + 2);
+        m.header[3] += uint32_t(block.part_members.size()) * 3;
+    }
+
+    std::vector<std::pair<size_t, size_t>> chains;    // (instruction, block)
+    std::vector<uint32_t> index_types, index_values;
+    for (size_t i = 0; i < m.insts.size(); i++) {
+        const spv_inst& inst = m.insts[i];
+        if (inst.op() != spv::OpAccessChain && inst.op() != spv::OpInBoundsAccessChain)
+            continue;
+        for (size_t b = 0; b < blocks.size(); b++) {
+            if (inst.w[3] == blocks[b].var_id) {
+                const spv_inst* index = get_def(ctx, inst.w[4]);
+                chains.push_back(std::make_pair(i, b));
+                index_types.push_back(index->w[1]);
+                index_values.push_back(index->w[3]);
+            }
+        }
+    }
+
+    // new index constants go to the global section, the access chains in the functions move by the same amount
+    size_t num_insts = m.insts.size();
+    std::vector<uint32_t> index_ids(chains.size());
+    for (size_t i = 0; i < chains.size(); i++)
+        index_ids[i] = spv_constant(&m, index_types[i], block_indices[chains[i].second][index_values[i]]);
+
+    for (size_t i = 0; i < chains.size(); i++) {
+        spv_inst& inst = m.insts[chains[i].first + m.insts.size() - num_insts];
+        inst.w[3] = blocks[chains[i].second].part_vars[block_parts[chains[i].second][index_values[i]]];
+        inst.w[4] = index_ids[i];
+    }
+
+    // declare the parts
+    std::vector<spv_inst> decls, names, decos;
+    for (const split_block& block : blocks) {
+        const spv_inst& struct_def = m.insts[spv_find_def(m, block.struct_id)];
+        std::string struct_name = get_name(m, block.struct_id);
+        std::string var_name = get_name(m, block.var_id);
+        for (size_t p = 0; p < block.part_members.size(); p++) {
+            uint32_t var_id = block.part_vars[p];
+            uint32_t struct_id = var_id - 2;
+            uint32_t ptr_id = var_id - 1;
+            const std::vector<size_t>& members = block.part_members[p];
+
+            // members keep their relative order, offsets start from zero
+            std::vector<ubo_member> layout;
+            spv_inst type = spv_make(spv::OpTypeStruct, { struct_id });
+            uint32_t offset = 0;
+            for (size_t i = 0; i < members.size(); i++) {
+                ubo_member mem = block.members[members[i]];
+                mem.offset = align_up(offset, mem.align);
+                offset = mem.offset + mem.size;
+                layout.push_back(mem);
+                type.w.push_back(struct_def.w[2 + mem.index]);
+            }
+            spv_fix_count(&type);
+            decls.push_back(type);
+            decls.push_back(spv_make(spv::OpTypePointer, { ptr_id, spv::StorageClassUniform, struct_id }));
+            decls.push_back(spv_make(spv::OpVariable, { ptr_id, var_id, spv::StorageClassUniform }));
+
+            // the part that has no frequency keeps the name of the block
+            const char* suffix = block.part_freqs[p] != UBO_FREQUENCY_NONE ? ubo_frequency_str(block.part_freqs[p]) : nullptr;
+            std::string part_name = suffix ? struct_name + "_" + suffix : struct_name;
+
+            // the first part keeps the binding of the block
+            uint32_t binding = 0;
+            if (p > 0) {
+                auto it = bindings->parts.find(part_name);
+                if (it == bindings->parts.end())
+                    it = bindings->parts.insert(std::make_pair(part_name, bindings->next++)).first;
+                binding = it->second;
+            }
+            spv_inst name = spv_make(spv::OpName, { struct_id });
+            spv_append_string(&name, part_name.c_str());
+            names.push_back(name);
+            name = spv_make(spv::OpName, { var_id });
+            spv_append_string(&name, suffix && !var_name.empty() ? (var_name + "_" + suffix).c_str() : var_name.c_str());
+            names.push_back(name);
+
+            for (const spv_inst& inst : m.insts) {
+                if (inst.op() == spv::OpMemberName && inst.w[1] == block.struct_id) {
+                    for (size_t i = 0; i < layout.size(); i++) {
+                        if (layout[i].index == inst.w[2]) {
+                            spv_inst member_name = inst;
+                            member_name.w[1] = struct_id;
+                            member_name.w[2] = uint32_t(i);
+                            names.push_back(member_name);
+                        }
+                    }
+                } else if (inst.op() == spv::OpMemberDecorate && inst.w[1] == block.struct_id) {
+                    for (size_t i = 0; i < layout.size(); i++) {
+                        if (layout[i].index == inst.w[2]) {
+                            spv_inst deco = inst;
+                            deco.w[1] = struct_id;
+                            deco.w[2] = uint32_t(i);
+                            if (deco.w[3] == spv::DecorationOffset)
+                                deco.w[4] = layout[i].offset;
+                            decos.push_back(deco);
+                        }
+                    }
+                } else if (inst.op() == spv::OpDecorate && inst.w[1] == block.struct_id) {
+                    spv_inst deco = inst;
+                    deco.w[1] = struct_id;
+                    decos.push_back(deco);
+                } else if (inst.op() == spv::OpDecorate && inst.w[1] == block.var_id) {
+                    spv_inst deco = inst;
+                    deco.w[1] = var_id;
+                    if (p > 0 && deco.w[2] == spv::DecorationBinding)
+                        deco.w[3] = binding;
+                    decos.push_back(deco);
+                }
+            }
+
+            ubo_split_part part;
+            part.block = struct_name;
+            part.name = part_name;
+            part.freq = block.part_freqs[p];
+            part.size = offset;
+            parts->push_back(part);
+        }
+    }
+
+    // remove the original variables
+    auto is_removed = [&](const spv_inst& inst)->bool {
+        for (const split_block& block : blocks) {
+            if ((inst.op() == spv::OpVariable && inst.w[2] == block.var_id) ||
+                ((inst.op() == spv::OpName || inst.op() == spv::OpDecorate) && inst.w[1] == block.var_id)) {
+                return true;
+            }
+        }
+        return false;
+    };
+    m.insts.erase(std::remove_if(m.insts.begin(), m.insts.end(), is_removed), m.insts.end());
+
+    // and their types, if no other variable uses them
+    for (const split_block& block : blocks) {
+        bool used = false;
+        for (const spv_inst& inst : m.insts) {
+            spv::Op op = inst.op();
+            if (op == spv::OpName || op == spv::OpMemberName || op == spv::OpDecorate || op == spv::OpMemberDecorate ||
+                (op == spv::OpTypeStruct && inst.w[1] == block.struct_id) ||
+                (op == spv::OpTypePointer && inst.w[1] == block.ptr_id)) {
+                continue;
+            }
+            used |= std::find(inst.w.begin() + 1, inst.w.end(), block.ptr_id) != inst.w.end() ||
+                    std::find(inst.w.begin() + 1, inst.w.end(), block.struct_id) != inst.w.end();
+        }
+        if (used)
+            continue;
+
+        auto is_type = [&](const spv_inst& inst)->bool {
+            spv::Op op = inst.op();
+            return ((op == spv::OpTypeStruct || op == spv::OpName || op == spv::OpMemberName || op == spv::OpDecorate ||
+                     op == spv::OpMemberDecorate) && inst.w[1] == block.struct_id) ||
+                   ((op == spv::OpTypePointer || op == spv::OpName) && inst.w[1] == block.ptr_id);
+        };
+        m.insts.erase(std::remove_if(m.insts.begin(), m.insts.end(), is_type), m.insts.end());
+    }
+
+    for (spv_inst& inst : m.insts) {
+        if (inst.op() != spv::OpEntryPoint)
+            continue;
+        for (const split_block& block : blocks) {
+            auto it = std::find(inst.w.begin() + 3 + spv_string_words(inst, 3), inst.w.end(), block.var_id);
+            if (it != inst.w.end()) {
+                inst.w.erase(it);
+                inst.w.insert(inst.w.end(), block.part_vars.begin(), block.part_vars.end());
+                spv_fix_count(&inst);
+            }
+        }
+    }
+
+    m.insts.insert(m.insts.begin() + spv_first_function(m), decls.begin(), decls.end());
+    spv_insert_global(&m, names);
+    spv_insert_global(&m, decos);
+
+    spv_write(m, &spirv);
+    return true;
+}
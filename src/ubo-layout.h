@@ -0,0 +1,62 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+// Uniform block layout optimizer: reorders the members of std140 uniform blocks to remove padding
+// Members are grouped by update frequency (taken from their names), then ordered by alignment, with small
+// members filling the holes after vec3s. Offsets, member names and access chains of the SPIR-V are rewritten,
+// so reflection reports the new offsets under the original member names
+//
+#pragma once
+
+#include <stdint.h>
+#include <map>
+#include <string>
+#include <vector>
+
+// members and blocks with "frame", "material" or "draw"/"object"/"instance" in their names
+enum ubo_frequency {
+    UBO_FREQUENCY_FRAME = 0,
+    UBO_FREQUENCY_MATERIAL,
+    UBO_FREQUENCY_DRAW,
+    UBO_FREQUENCY_NONE,
+    UBO_FREQUENCY_COUNT
+};
+
+struct ubo_layout_report {
+    std::string name;       // block type name
+    uint32_t    old_size;
+    uint32_t    new_size;
+};
+
+// part of a uniform block that is split by update frequency
+struct ubo_split_part {
+    std::string   block;    // block type name of the split block
+    std::string   name;     // block type name of the part, <block>_<frequency>
+    ubo_frequency freq;
+    uint32_t      size;
+};
+
+ubo_frequency ubo_frequency_from_name(const char* name);
+const char*   ubo_frequency_str(ubo_frequency freq);
+
+// Layouts only depend on the block declaration, so stages that share a block get the same layout
+// Returns false if the module can't be parsed, in which case it's left untouched
+bool ubo_optimize_layout(std::vector<uint32_t>& spirv, std::vector<ubo_layout_report>* reports);
+
+// bindings of split parts, shared by the stages of a program so the parts of a block get the same bindings in
+// every stage that declares it
+struct ubo_split_bindings {
+    uint32_t                        next;       // first binding that no uniform block of the program uses
+    std::map<std::string, uint32_t> parts;      // part name -> binding
+};
+
+// Moves bindings->next after the bindings of the uniform blocks of the module, call it for all stages first
+void ubo_reserve_bindings(const std::vector<uint32_t>& spirv, ubo_split_bindings* bindings);
+
+// Splits uniform blocks that have members of different frequencies into a block per frequency, members without
+// a frequency take the one of the block. The first part keeps the set and binding of the block, the others get
+// free bindings from bindings. Parts are written to parts
+// Returns false if the module can't be parsed, in which case it's left untouched
+bool ubo_split_by_frequency(std::vector<uint32_t>& spirv, ubo_split_bindings* bindings,
+                            std::vector<ubo_split_part>* parts);
@@ -0,0 +1,392 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+#include "varyings.h"
+#include "spirv-module.h"
+
+#include <stdio.h>
+#include <algorithm>
+#include <unordered_map>
+
+struct varying_info {
+    uint32_t              var_id;
+    uint32_t              type_id;          // pointee type
+    uint32_t              location;
+    uint32_t              num_locations;
+    uint32_t              num_components;   // 1..3 for 32bit float scalars/vectors, 0 if it can't be packed
+    bool                  relaxed;          // RelaxedPrecision
+    bool                  interpolation;    // interpolation qualifiers or explicit components, can't be packed
+    bool                  captured;         // written to transform feedback buffers, must be kept
+    bool                  used;             // referenced by any function
+    bool                  convertible;      // only loaded, stored or access-chained, can be made private
+    std::vector<uint32_t> chains;           // access chains that are based on the variable
+};
+
+struct varying_slot {
+    uint32_t         location;
+    uint32_t         num_components;
+    bool             relaxed;               // fragment side precision decides which varyings can share a slot
+    std::vector<int> members[2];            // indices to vertex outputs and fragment inputs
+};
+
+
+static uint32_t spv_location_count(const spv_module& m, uint32_t type_id)
+{
+    static const uint32_t unknown = 0xffff;
+
+    int def = spv_find_def(m, type_id);
+    if (def < 0)
+        return unknown;
+
+    const spv_inst& t = m.insts[def];
+    switch (t.op()) {
+    case spv::OpTypeBool:
+    case spv::OpTypeInt:
+    case spv::OpTypeFloat:
+        return 1;
+    case spv::OpTypeVector: {
+        int comp = spv_find_def(m, t.w[2]);
+        bool wide = comp >= 0 && m.insts[comp].op() != spv::OpTypeBool && m.insts[comp].w[2] == 64;
+        return (wide && t.w[3] > 2) ? 2 : 1;
+    }
+    case spv::OpTypeMatrix:
+        return std::min(t.w[3] * spv_location_count(m, t.w[2]), unknown);
+    case spv::OpTypeArray: {
+        // spec constant array sizes are unknown at this point
+        int len = spv_find_def(m, t.w[3]);
+        if (len < 0 || m.insts[len].op() != spv::OpConstant)
+            return unknown;
+        return std::min(m.insts[len].w[3] * spv_location_count(m, t.w[2]), unknown);
+    }
+    case spv::OpTypeStruct: {
+        uint32_t count = 0;
+        for (size_t i = 2; i < t.w.size(); i++)
+            count += spv_location_count(m, t.w[i]);
+        return std::min(count, unknown);
+    }
+    default:
+        return unknown;
+    }
+}
+
+static uint32_t spv_float_components(const spv_module& m, uint32_t type_id)
+{
+    int def = spv_find_def(m, type_id);
+    if (def < 0)
+        return 0;
+
+    const spv_inst& t = m.insts[def];
+    if (t.op() == spv::OpTypeFloat)
+        return t.w[2] == 32 ? 1 : 0;
+    if (t.op() == spv::OpTypeVector && t.w[3] < 4)
+        return spv_float_components(m, t.w[2]) == 1 ? t.w[3] : 0;
+    return 0;
+}
+
+static uint32_t spv_scalar_type(const spv_module& m, uint32_t type_id)
+{
+    int def = spv_find_def(m, type_id);
+    return m.insts[def].op() == spv::OpTypeVector ? m.insts[def].w[2] : type_id;
+}
+
+
+static bool gather_varyings(const spv_module& m, spv::StorageClass sc, std::vector<varying_info>* vars)
+{
+    int first_func = spv_first_function(m);
+    for (int i = 0; i < first_func; i++) {
+        const spv_inst& inst = m.insts[i];
+        if (inst.op() != spv::OpVariable || inst.w[3] != uint32_t(sc))
+            continue;
+
+        int ptr = spv_find_def(m, inst.w[1]);
+        if (ptr < 0)
+            return false;
+
+        varying_info v = {};
+        v.var_id = inst.w[2];
+        v.type_id = m.insts[ptr].w[3];
+        if (spv_is_builtin(m, v.var_id, v.type_id))
+            continue;
+        if (!spv_decoration(m, v.var_id, spv::DecorationLocation, &v.location))
+            return false;
+
+        v.num_locations = spv_location_count(m, v.type_id);
+        v.num_components = spv_float_components(m, v.type_id);
+        v.relaxed = spv_decoration(m, v.var_id, spv::DecorationRelaxedPrecision);
+        v.interpolation = spv_decoration(m, v.var_id, spv::DecorationFlat) ||
+                          spv_decoration(m, v.var_id, spv::DecorationNoPerspective) ||
+                          spv_decoration(m, v.var_id, spv::DecorationCentroid) ||
+                          spv_decoration(m, v.var_id, spv::DecorationSample) ||
+                          spv_decoration(m, v.var_id, spv::DecorationPatch) ||
+                          spv_decoration(m, v.var_id, spv::DecorationComponent) ||
+                          spv_decoration(m, v.var_id, spv::DecorationInvariant);
+        v.captured = spv_decoration(m, v.var_id, spv::DecorationOffset) ||
+                     spv_decoration(m, v.var_id, spv::DecorationXfbBuffer);
+        // interface blocks stay as they are
+        int elem = spv_element_def(m, v.type_id);
+        v.convertible = elem >= 0 && m.insts[elem].op() != spv::OpTypeStruct;
+        vars->push_back(std::move(v));
+    }
+
+    // find out how the variables are referenced by the functions
+    std::unordered_map<uint32_t, int> ptrs;
+    for (int i = 0; i < (int)vars->size(); i++)
+        ptrs[(*vars)[i].var_id] = i;
+
+    for (size_t i = first_func; i < m.insts.size(); i++) {
+        const spv_inst& inst = m.insts[i];
+        bool has_result, has_type;
+        spv::HasResultAndType(inst.op(), &has_result, &has_type);
+        for (size_t k = 1 + has_result + has_type; k < inst.w.size(); k++) {
+            auto it = ptrs.find(inst.w[k]);
+            if (it == ptrs.end())
+                continue;
+
+            varying_info& v = (*vars)[it->second];
+            v.used = true;
+            spv::Op op = inst.op();
+            if ((op == spv::OpLoad && k == 3) || (op == spv::OpStore && k == 1))
+                continue;
+            if ((op == spv::OpAccessChain || op == spv::OpInBoundsAccessChain) && k == 3) {
+                v.chains.push_back(inst.w[2]);
+                ptrs[inst.w[2]] = it->second;
+                continue;
+            }
+            v.convertible = false;
+        }
+    }
+    return true;
+}
+
+// turns the interface variable into a private global, so it's not a part of the stage interface anymore
+static void make_private(spv_module* m, const varying_info& v)
+{
+    std::vector<uint32_t> ids(1, v.var_id);
+    ids.insert(ids.end(), v.chains.begin(), v.chains.end());
+    for (uint32_t id : ids) {
+        int ptr = spv_find_def(*m, m->insts[spv_find_def(*m, id)].w[1]);
+        uint32_t private_ptr = spv_pointer_type(m, spv::StorageClassPrivate, m->insts[ptr].w[3]);
+        spv_inst& def = m->insts[spv_find_def(*m, id)];
+        def.w[1] = private_ptr;
+        if (id == v.var_id)
+            def.w[3] = spv::StorageClassPrivate;
+    }
+
+    spv_inst& entry = m->insts[spv_entry_point(*m)];
+    size_t first = 3 + spv_string_words(entry, 3);
+    entry.w.erase(std::remove(entry.w.begin() + first, entry.w.end(), v.var_id), entry.w.end());
+    spv_fix_count(&entry);
+
+    m->insts.erase(std::remove_if(m->insts.begin(), m->insts.end(), [&](const spv_inst& inst) {
+        return inst.op() == spv::OpDecorate && inst.w[1] == v.var_id &&
+               inst.w[2] != spv::DecorationRelaxedPrecision;
+    }), m->insts.end());
+}
+
+// creates the packed interface variables, members are converted to private globals which are copied to
+// the packed variables before each return of the vertex shader, or extracted at the start of the fragment shader
+static void emit_packed_varyings(spv_module* m, const std::vector<varying_info>& vars,
+                                 const std::vector<varying_slot>& slots, int side)
+{
+    bool output = side == 0;
+    spv::StorageClass sc = output ? spv::StorageClassOutput : spv::StorageClassInput;
+
+    for (const varying_slot& slot : slots) {
+        for (int index : slot.members[side])
+            make_private(m, vars[index]);
+    }
+
+    uint32_t float_type = spv_scalar_type(*m, vars[slots[0].members[side][0]].type_id);
+    uint32_t vec4_type = spv_vector_type(m, float_type, 4);
+    uint32_t ptr_type = spv_pointer_type(m, sc, vec4_type);
+    uint32_t zero = output ? spv_float_zero(m, float_type) : 0;
+
+    std::vector<uint32_t> packed_ids;
+    for (const varying_slot& slot : slots) {
+        uint32_t id = m->header[3]++;
+        packed_ids.push_back(id);
+        m->insts.insert(m->insts.begin() + spv_first_function(*m), spv_make(spv::OpVariable, { ptr_type, id, uint32_t(sc) }));
+
+        spv_inst& entry = m->insts[spv_entry_point(*m)];
+        entry.w.push_back(id);
+        spv_fix_count(&entry);
+
+        // both stages use the same name, so the variables also match by name (GLES2)
+        char name[32];
+        snprintf(name, sizeof(name), "packed_varying%u", slot.location);
+        spv_add_name(m, id, name);
+        spv_insert_global(m, spv_make(spv::OpDecorate, { id, spv::DecorationLocation, slot.location }));
+
+        // vertex outputs can be more precise than the fragment inputs, only relax if all members are
+        bool relaxed = slot.relaxed;
+        for (int index : slot.members[side])
+            relaxed &= vars[index].relaxed;
+        if (relaxed)
+            spv_insert_global(m, spv_make(spv::OpDecorate, { id, spv::DecorationRelaxedPrecision }));
+    }
+
+    uint32_t entry_func = m->insts[spv_entry_point(*m)].w[2];
+    int func = spv_find_def(*m, entry_func);
+
+    if (output) {
+        for (size_t i = func; i < m->insts.size() && m->insts[i].op() != spv::OpFunctionEnd; i++) {
+            if (m->insts[i].op() != spv::OpReturn)
+                continue;
+
+            std::vector<spv_inst> code;
+            for (size_t s = 0; s < slots.size(); s++) {
+                spv_inst construct = spv_make(spv::OpCompositeConstruct, { vec4_type, m->header[3]++ });
+                for (int index : slots[s].members[side]) {
+                    uint32_t value = m->header[3]++;
+                    code.push_back(spv_make(spv::OpLoad, { vars[index].type_id, value, vars[index].var_id }));
+                    construct.w.push_back(value);
+                }
+                for (uint32_t c = slots[s].num_components; c < 4; c++)
+                    construct.w.push_back(zero);
+                spv_fix_count(&construct);
+                uint32_t value = construct.w[2];
+                code.push_back(std::move(construct));
+                code.push_back(spv_make(spv::OpStore, { packed_ids[s], value }));
+            }
+            m->insts.insert(m->insts.begin() + i, code.begin(), code.end());
+            i += code.size();
+        }
+    } else {
+        size_t i = func + 1;
+        while (m->insts[i].op() == spv::OpFunctionParameter || m->insts[i].op() == spv::OpLabel)
+            i++;
+        while (m->insts[i].op() == spv::OpVariable || m->insts[i].op() == spv::OpLine ||
+               m->insts[i].op() == spv::OpNoLine) {
+            i++;
+        }
+
+        std::vector<spv_inst> code;
+        for (size_t s = 0; s < slots.size(); s++) {
+            uint32_t packed = m->header[3]++;
+            code.push_back(spv_make(spv::OpLoad, { vec4_type, packed, packed_ids[s] }));
+
+            uint32_t offset = 0;
+            for (int index : slots[s].members[side]) {
+                const varying_info& v = vars[index];
+                uint32_t value = m->header[3]++;
+                if (v.num_components == 1) {
+                    code.push_back(spv_make(spv::OpCompositeExtract, { v.type_id, value, packed, offset }));
+                } else {
+                    spv_inst shuffle = spv_make(spv::OpVectorShuffle, { v.type_id, value, packed, packed });
+                    for (uint32_t c = 0; c < v.num_components; c++)
+                        shuffle.w.push_back(offset + c);
+                    spv_fix_count(&shuffle);
+                    code.push_back(std::move(shuffle));
+                }
+                code.push_back(spv_make(spv::OpStore, { v.var_id, value }));
+                offset += v.num_components;
+            }
+        }
+        m->insts.insert(m->insts.begin() + i, code.begin(), code.end());
+    }
+}
+
+bool varyings_link(std::vector<uint32_t>& vs_spirv, std::vector<uint32_t>& fs_spirv, bool pack)
+{
+    spv_module vs, fs;
+    if (!spv_parse(&vs, vs_spirv) || !spv_parse(&fs, fs_spirv))
+        return false;
+    if (spv_entry_point(vs) < 0 || spv_entry_point(fs) < 0)
+        return false;
+
+    std::vector<varying_info> outputs, inputs;
+    if (!gather_varyings(vs, spv::StorageClassOutput, &outputs) ||
+        !gather_varyings(fs, spv::StorageClassInput, &inputs)) {
+        return false;
+    }
+
+    // vertex outputs that don't overlap any of the locations read by the fragment shader are dead
+    std::vector<bool> removed(outputs.size(), false);
+    for (size_t i = 0; i < outputs.size(); i++) {
+        const varying_info& o = outputs[i];
+        if (!o.convertible || o.captured)
+            continue;
+
+        bool read = false;
+        for (const varying_info& in : inputs) {
+            if (in.used && in.location < o.location + o.num_locations && o.location < in.location + in.num_locations) {
+                read = true;
+                break;
+            }
+        }
+        if (!read) {
+            make_private(&vs, o);
+            removed[i] = true;
+        }
+    }
+
+    for (const varying_info& in : inputs) {
+        if (!in.used && in.convertible)
+            make_private(&fs, in);
+    }
+
+    if (pack) {
+        // float scalars/vectors with default interpolation on both sides
+        std::vector<std::pair<int, int>> candidates;
+        for (size_t i = 0; i < outputs.size(); i++) {
+            const varying_info& o = outputs[i];
+            if (removed[i] || !o.num_components || o.interpolation || !o.convertible)
+                continue;
+            for (size_t k = 0; k < inputs.size(); k++) {
+                const varying_info& in = inputs[k];
+                if (in.location == o.location && in.used && in.convertible && !in.interpolation &&
+                    in.num_components == o.num_components) {
+                    candidates.push_back(std::make_pair(int(i), int(k)));
+                    break;
+                }
+            }
+        }
+
+        // first-fit decreasing into vec4 slots
+        std::sort(candidates.begin(), candidates.end(), [&](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+            const varying_info& va = outputs[a.first];
+            const varying_info& vb = outputs[b.first];
+            if (va.num_components != vb.num_components)
+                return va.num_components > vb.num_components;
+            return va.location < vb.location;
+        });
+
+        std::vector<varying_slot> slots;
+        for (const std::pair<int, int>& c : candidates) {
+            const varying_info& o = outputs[c.first];
+            bool relaxed = inputs[c.second].relaxed;
+            varying_slot* slot = nullptr;
+            for (varying_slot& sl : slots) {
+                if (sl.relaxed == relaxed && sl.num_components + o.num_components <= 4) {
+                    slot = &sl;
+                    break;
+                }
+            }
+            if (!slot) {
+                slots.push_back(varying_slot());
+                slot = &slots.back();
+                slot->location = o.location;
+                slot->num_components = 0;
+                slot->relaxed = relaxed;
+            }
+            slot->location = std::min(slot->location, o.location);
+            slot->num_components += o.num_components;
+            slot->members[0].push_back(c.first);
+            slot->members[1].push_back(c.second);
+        }
+
+        slots.erase(std::remove_if(slots.begin(), slots.end(), [](const varying_slot& sl) {
+            return sl.members[0].size() < 2;
+        }), slots.end());
+
+        if (!slots.empty()) {
+            emit_packed_varyings(&vs, outputs, slots, 0);
+            emit_packed_varyings(&fs, inputs, slots, 1);
+        }
+    }
+
+    spv_write(vs, &vs_spirv);
+    spv_write(fs, &fs_spirv);
+    return true;
+}
@@ -0,0 +1,16 @@
+//
+// Copyright 2018 Sepehr Taghdisian (septag@github). All rights reserved.
+// License: https://github.com/septag/glslcc#license-bsd-2-clause
+//
+// Cross-stage varying optimizations: works on the SPIR-V of a linked vertex/fragment pair
+// Vertex outputs that the fragment shader never reads are turned into private globals, and float
+// varyings can optionally be packed into shared vec4 slots, with the fragment side remapped to match
+//
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+// Returns false if the modules can't be linked (missing locations, multiple entry points, ...),
+// in which case both modules are left untouched
+bool varyings_link(std::vector<uint32_t>& vs_spirv, std::vector<uint32_t>& fs_spirv, bool pack);